@@ -0,0 +1,1825 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file backward3.cpp
+///	\brief Contains the IAPWS-IF97 backward equations for IAPWS Region 3.
+///
+/// The specific volume as a function of pressure and temperature is taken from the
+/// IAPWS Revised Supplementary Release on Backward Equations for Specific Volume as
+/// a Function of Pressure and Temperature v(p,T) for Region 3 (2014), which divides
+/// Region 3 into the subregions 3a through 3z.
+///
+/// Temperature and specific volume as functions of pressure and specific enthalpy,
+/// and temperature as a function of pressure and specific entropy, are taken from the IAPWS Revised Supplementary Release on Backward Equations for
+/// the Functions T(p,h), v(p,h) and T(p,s), v(p,s) for Region 3 (2014), which divides
+/// Region 3 into the subregions 3a and 3b.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+ 
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+ 
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "iapws.h"
+#include<math.h>
+#include "utilities.h"
+
+//------------------------------------------------------------------------------
+// SUBREGION BOUNDARIES FOR v(p,T)
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3a and 3b.
+////////////////////////////////////////////////////////
+const double n_ab[5] = {
+            0.154793642129415E+04, -0.187661219490113E+03, 0.213144632222113E+02, -0.191887498864292E+04, 0.918419702359447E+03
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3c and 3d.
+////////////////////////////////////////////////////////
+const double n_cd[4] = {
+            0.585276966696349E+03, 0.278233532206915E+01, -0.127283549295878E-01, 0.159090746562729E-03
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3g and 3h.
+////////////////////////////////////////////////////////
+const double n_gh[5] = {
+            -0.249284240900418E+05, 0.428143584791546E+04, -0.26902917314013E+03, 0.751608051114157E+01, -0.787105249910383E-01
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3i and 3j.
+////////////////////////////////////////////////////////
+const double n_ij[5] = {
+            0.584814781649163E+03, -0.616179320924617E+00, 0.260763050899562E+00, -0.587071076864459E-02, 0.515308185433082E-04
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3j and 3k.
+////////////////////////////////////////////////////////
+const double n_jk[5] = {
+            0.617229772068439E+03, -0.770600270141675E+01, 0.697072596851896E+00, -0.157391839848015E-01, 0.137897492684194E-03
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3m and 3n.
+////////////////////////////////////////////////////////
+const double n_mn[4] = {
+            0.535339483742384E+03, 0.761978122720128E+01, -0.158365725441648E+00, 0.192871054508108E-02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3o and 3p.
+////////////////////////////////////////////////////////
+const double n_op[5] = {
+            0.969461372400213E+03, -0.332500170441278E+03, 0.642859598466067E+02, 0.773845935768222E+03, -0.152313732937084E+04
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3q and 3u.
+////////////////////////////////////////////////////////
+const double n_qu[4] = {
+            0.565603648239126E+03, 0.529062258221222E+01, -0.102020639611016E+00, 0.122240301070145E-02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3r and 3x.
+////////////////////////////////////////////////////////
+const double n_rx[4] = {
+            0.584561202520006E+03, -0.102961025163669E+01, 0.243293362700452E+00, -0.294905044740799E-02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3u and 3v.
+////////////////////////////////////////////////////////
+const double n_uv[4] = {
+            0.528199646263062E+03, 0.890579602135307E+01, -0.222814134903755E+00, 0.286791682263697E-02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation T(p) between
+///  subregions 3w and 3x.
+////////////////////////////////////////////////////////
+const double n_wx[5] = {
+            0.72805260914538E+01, 0.973505869861952E+02, 0.147370491183191E+02, 0.329196213998375E+03, 0.873371668682417E+03
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a subregion boundary equation of the form T = sum(n[i] * p^i)
+///
+/// \param[in] n coefficients
+/// \param[in] count length of the coefficient array
+/// \param[in] p  pressure
+///
+/// \return temperature on the boundary
+///////////////////////////////////////////////////////////////////////////////
+static double boundary_poly(const double n[], int count, double p)
+{
+	double result = n[count-1];
+	for (int i=count-2; i>=0; i--)
+		result = result*p + n[i];
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a subregion boundary equation of the form T = sum(n[i] * ln(p)^I[i])
+///  with I = {0, 1, 2, -1, -2}
+///
+/// \param[in] n coefficients
+/// \param[in] p  pressure
+///
+/// \return temperature on the boundary
+///////////////////////////////////////////////////////////////////////////////
+static double boundary_log(const double n[5], double p)
+{
+	double x = log(p);
+	return n[0] + x*(n[1] + x*n[2]) + (n[3] + n[4]/x)/x;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature on the boundary between subregions 3e and 3f,
+///  which is the critical isochore
+///
+/// \param[in] p  pressure
+///
+/// \return temperature on the boundary
+///////////////////////////////////////////////////////////////////////////////
+static double boundary_3ef(double p)
+{
+	return 3.727888004*(p - PC) + TC;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief determines the subregion of IAPWS Region 3 used by the backward equations v(p,T)
+///
+/// On the saturation line the liquid subregion is selected.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+///
+/// \return subregion letter, 'a' through 'z'
+///////////////////////////////////////////////////////////////////////////////
+char subregion_pt_3(double p, double t)
+{
+	if (p > 40)
+		return (t <= boundary_log(n_ab, p)) ? 'a' : 'b';
+	if (p > 25) {
+		if (t <= boundary_poly(n_cd, 4, p)) return 'c';
+		if (t <= boundary_log(n_ab, p)) return 'd';
+		if (t <= boundary_3ef(p)) return 'e';
+		return 'f';
+	}
+	if (p > 23.5) {
+		if (t <= boundary_poly(n_cd, 4, p)) return 'c';
+		if (t <= boundary_poly(n_gh, 5, p)) return 'g';
+		if (t <= boundary_3ef(p)) return 'h';
+		if (t <= boundary_poly(n_ij, 5, p)) return 'i';
+		if (t <= boundary_poly(n_jk, 5, p)) return 'j';
+		return 'k';
+	}
+	if (p > 23) {
+		if (t <= boundary_poly(n_cd, 4, p)) return 'c';
+		if (t <= boundary_poly(n_gh, 5, p)) return 'l';
+		if (t <= boundary_3ef(p)) return 'h';
+		if (t <= boundary_poly(n_ij, 5, p)) return 'i';
+		if (t <= boundary_poly(n_jk, 5, p)) return 'j';
+		return 'k';
+	}
+	if (p > 22.5) {
+		if (t <= boundary_poly(n_cd, 4, p)) return 'c';
+		if (t <= boundary_poly(n_gh, 5, p)) return 'l';
+		if (t <= boundary_poly(n_mn, 4, p)) return 'm';
+		if (t <= boundary_3ef(p)) return 'n';
+		if (t <= boundary_log(n_op, p)) return 'o';
+		if (t <= boundary_poly(n_ij, 5, p)) return 'p';
+		if (t <= boundary_poly(n_jk, 5, p)) return 'j';
+		return 'k';
+	}
+	if (p > 21.04336732) {  // saturation pressure at 643.15 K
+		if (t <= boundary_poly(n_cd, 4, p)) return 'c';
+		if (t <= boundary_poly(n_qu, 4, p)) return 'q';
+		if (t > boundary_poly(n_rx, 4, p))
+			return (t <= boundary_poly(n_jk, 5, p)) ? 'r' : 'k';
+		// near-critical subregions 3u through 3z
+		if (p > 22.11) {
+			if (t <= boundary_poly(n_uv, 4, p)) return 'u';
+			if (t <= boundary_3ef(p)) return 'v';
+			if (t <= boundary_log(n_wx, p)) return 'w';
+			return 'x';
+		}
+		if (p > PC) {
+			if (t <= boundary_poly(n_uv, 4, p)) return 'u';
+			if (t <= boundary_3ef(p)) return 'y';
+			if (t <= boundary_log(n_wx, p)) return 'z';
+			return 'x';
+		}
+		if (t <= TSAT_P(p)) {
+			if (p > 21.93161551)
+				return (t <= boundary_poly(n_uv, 4, p)) ? 'u' : 'y';
+			return 'u';
+		}
+		if (p > 21.90096265)
+			return (t <= boundary_log(n_wx, p)) ? 'z' : 'x';
+		return 'x';
+	}
+	if (p > 20.5) {
+		if (t <= boundary_poly(n_cd, 4, p)) return 'c';
+		if (t <= TSAT_P(p)) return 's';
+		if (t <= boundary_poly(n_jk, 5, p)) return 'r';
+		return 'k';
+	}
+	if (p > 19.00881189173929) {  // pressure where the 3c/3d boundary meets saturation
+		if (t <= boundary_poly(n_cd, 4, p)) return 'c';
+		if (t <= TSAT_P(p)) return 's';
+		return 't';
+	}
+	return (t <= TSAT_P(p)) ? 'c' : 't';
+}
+
+//------------------------------------------------------------------------------
+// BACKWARD EQUATIONS v(p,T)
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+#define REG3A_VPT_COUNT 30
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3a.
+////////////////////////////////////////////////////////
+const int I_3a[REG3A_VPT_COUNT] = {
+                                       -12, -12, -12, -10, -10, -10, -8, -8, -8, -6, -5, -5, -5, -4, -3, -3, -3, -3, -2, -2,
+                                       -2, -1, -1, -1, 0, 0, 1, 1, 2, 2
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3a.
+////////////////////////////////////////////////////////
+const int J_3a[REG3A_VPT_COUNT] = {
+                                       5, 10, 12, 5, 10, 12, 5, 8, 10, 1, 1, 5, 10, 8, 0, 1, 3, 6, 0, 2,
+                                       3, 0, 1, 2, 0, 1, 0, 2, 0, 2
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+const double n_3a[REG3A_VPT_COUNT] = {
+            0.110879558823853E-02, 0.572616740810616E+03, -0.767051948380852E+05,
+            -0.253321069529674E-01, 0.628008049345689E+04, 0.234105654131876E+06, 0.216867826045856E+00,
+            -0.156237904341963E+03, -0.269893956176613E+05, -0.180407100085505E-03, 0.116732227668261E-02,
+            0.26698704085604E+02, 0.282776617243286E+05, -0.242431520029523E+04, 0.435217323022733E-03,
+            -0.122494831387441E-01, 0.179357604019989E+01, 0.442729521058314E+02, -0.593223489018342E-02,
+            0.453186261685774E+00, 0.13582570312914E+01, 0.408748415856745E-01, 0.474686397863312E+00,
+            0.118646814997915E+01, 0.546987265727549E+00, 0.195266770452643E+00, -0.502268790869663E-01,
+            -0.369645308193377E+00, 0.63382803752842E-02, 0.797441793901017E-01
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+#define REG3B_VPT_COUNT 32
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3b.
+////////////////////////////////////////////////////////
+const int I_3b[REG3B_VPT_COUNT] = {
+                                       -12, -12, -10, -10, -8, -6, -6, -6, -5, -5, -5, -4, -4, -4, -3, -3, -3, -3, -3, -2,
+                                       -2, -2, -1, -1, 0, 0, 1, 1, 2, 3, 4, 4
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3b.
+////////////////////////////////////////////////////////
+const int J_3b[REG3B_VPT_COUNT] = {
+                                       10, 12, 8, 14, 8, 5, 6, 8, 5, 8, 10, 2, 4, 5, 0, 1, 2, 3, 5, 0,
+                                       2, 5, 0, 2, 0, 1, 0, 2, 0, 2, 0, 1
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+const double n_3b[REG3B_VPT_COUNT] = {
+            -0.827670470003621E-01, 0.416887126010565E+02, 0.483651982197059E-01,
+            -0.291032084950276E+05, -0.111422582236948E+03, -0.202300083904014E-01, 0.294002509338515E+03,
+            0.140244997609658E+03, -0.344384158811459E+03, 0.361182452612149E+03, -0.140699677420738E+04,
+            -0.202023902676481E-02, 0.171346792457471E+03, -0.425597804058632E+01, 0.691346085000334E-05,
+            0.151140509678925E-02, -0.416375290166236E-01, -0.413754957011042E+02, -0.506673295721637E+02,
+            -0.572212965569023E-03, 0.608817368401785E+01, 0.239600660256161E+02, 0.122261479925384E-01,
+            0.216356057692938E+01, 0.398198903368642E+00, -0.116892827834085E+00, -0.102845919373532E+00,
+            -0.492676637589284E+00, 0.65554045640679E-01, -0.24046253507853E+00, -0.269798180310075E-01,
+            0.128369435967012E+00
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3c.
+////////////////////////////////////////////////////////
+#define REG3C_VPT_COUNT 35
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3c.
+////////////////////////////////////////////////////////
+const int I_3c[REG3C_VPT_COUNT] = {
+                                       -12, -12, -12, -10, -10, -10, -8, -8, -8, -6, -5, -5, -5, -4, -4, -3, -3, -2, -2, -2,
+                                       -1, -1, -1, 0, 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 8
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3c.
+////////////////////////////////////////////////////////
+const int J_3c[REG3C_VPT_COUNT] = {
+                                       6, 8, 10, 6, 8, 10, 5, 6, 7, 8, 1, 4, 7, 2, 8, 0, 3, 0, 4, 5,
+                                       0, 1, 2, 0, 1, 2, 0, 2, 0, 1, 3, 7, 0, 7, 1
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3c.
+////////////////////////////////////////////////////////
+const double n_3c[REG3C_VPT_COUNT] = {
+            0.31196778876303E+01, 0.276713458847564E+05, 0.322583103403269E+08,
+            -0.342416065095363E+03, -0.899732529907377E+06, -0.793892049821251E+08, 0.953193003217388E+02,
+            0.229784742345072E+04, 0.175336675322499E+06, 0.791214365222792E+07, 0.319933345844209E-04,
+            -0.659508863555767E+02, -0.833426563212851E+06, 0.645734680583292E-01, -0.382031020570813E+07,
+            0.406398848470079E-04, 0.310327498492008E+02, -0.892996718483724E-03, 0.234604891591616E+03,
+            0.377515668966951E+04, 0.158646812591361E-01, 0.707906336241843E+00, 0.12601622514657E+02,
+            0.736143655772152E+00, 0.676544268999101E+00, -0.178100588189137E+02, -0.156531975531713E+00,
+            0.117707430048158E+02, 0.840143653860447E-01, -0.186442467471949E+00, -0.440170203949645E+02,
+            0.123290423502494E+07, -0.240650039730845E-01, -0.107077716660869E+07, 0.438319858566475E-01
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3d.
+////////////////////////////////////////////////////////
+#define REG3D_VPT_COUNT 38
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3d.
+////////////////////////////////////////////////////////
+const int I_3d[REG3D_VPT_COUNT] = {
+                                       -12, -12, -12, -12, -12, -12, -10, -10, -10, -10, -10, -10, -10, -8, -8, -8, -8, -6, -6, -5,
+                                       -5, -5, -5, -4, -4, -4, -3, -3, -2, -2, -1, -1, -1, 0, 0, 1, 1, 3
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3d.
+////////////////////////////////////////////////////////
+const int J_3d[REG3D_VPT_COUNT] = {
+                                       4, 6, 7, 10, 12, 16, 0, 2, 4, 6, 8, 10, 14, 3, 7, 8, 10, 6, 8, 1,
+                                       2, 5, 7, 0, 1, 7, 2, 4, 0, 1, 0, 1, 5, 0, 2, 0, 6, 0
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3d.
+////////////////////////////////////////////////////////
+const double n_3d[REG3D_VPT_COUNT] = {
+            -0.452484847171645E-09, 0.315210389538801E-04, -0.214991352047545E-02,
+            0.508058874808345E+03, -0.127123036845932E+08, 0.115371133120497E+13, -0.197805728776273E-15,
+            0.241554806033972E-10, -0.156481703640525E-05, 0.277211346836625E-02, -0.203578994462286E+02,
+            0.144369489909053E+07, -0.411254217946539E+11, 0.623449786243773E-05, -0.221774281146038E+02,
+            -0.689315087933158E+05, -0.195419525060713E+08, 0.316373510564015E+04, 0.224040754426988E+07,
+            -0.436701347922356E-05, -0.404213852833996E-03, -0.348153203414663E+03, -0.385294213555289E+06,
+            0.135203700099403E-06, 0.134648383271089E-03, 0.125031835351736E+06, 0.968123678455841E-01,
+            0.225660517512438E+03, -0.190102435341872E-03, -0.299628410819229E-01, 0.500833915372121E-02,
+            0.387842482998411E+00, -0.138535367777182E+04, 0.870745245971773E+00, 0.171946252068742E+01,
+            -0.326650121426383E-01, 0.498044171727877E+04, 0.551478022765087E-02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3e.
+////////////////////////////////////////////////////////
+#define REG3E_VPT_COUNT 29
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3e.
+////////////////////////////////////////////////////////
+const int I_3e[REG3E_VPT_COUNT] = {
+                                       -12, -12, -10, -10, -10, -10, -10, -8, -8, -8, -6, -5, -4, -4, -3, -3, -3, -2, -2, -2,
+                                       -2, -1, 0, 0, 1, 1, 1, 2, 2
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3e.
+////////////////////////////////////////////////////////
+const int J_3e[REG3E_VPT_COUNT] = {
+                                       14, 16, 3, 6, 10, 14, 16, 7, 8, 10, 6, 6, 2, 4, 2, 6, 7, 0, 1, 3,
+                                       4, 0, 0, 1, 0, 4, 6, 0, 2
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3e.
+////////////////////////////////////////////////////////
+const double n_3e[REG3E_VPT_COUNT] = {
+            0.715815808404721E+09, -0.114328360753449E+12, 0.37653100201572E-11,
+            -0.903983668691157E-04, 0.665695908836252E+06, 0.535364174960127E+10, 0.794977402335603E+11,
+            0.922230563421437E+02, -0.142586073991215E+06, -0.111796381424162E+07, 0.89612162964076E+04,
+            -0.669989239070491E+04, 0.451242538486834E-02, -0.339731325977713E+02, -0.120523111552278E+01,
+            0.475992667717124E+05, -0.266627750390341E+06, -0.153314954386524E-03, 0.305638404828265E+00,
+            0.123654999499486E+03, -0.104390794213011E+04, -0.157496516174308E-01, 0.685331118940253E+00,
+            0.178373462873903E+01, -0.54467412487891E+00, 0.204529931318843E+04, -0.228342359328752E+05,
+            0.413197481515899E+00, -0.341931835910405E+02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3f.
+////////////////////////////////////////////////////////
+#define REG3F_VPT_COUNT 42
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3f.
+////////////////////////////////////////////////////////
+const int I_3f[REG3F_VPT_COUNT] = {
+                                       0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 3, 4, 5, 5, 6, 7,
+                                       7, 10, 12, 12, 12, 14, 14, 14, 14, 14, 16, 16, 18, 18, 20, 20, 20, 22, 24, 24,
+                                       28, 32
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3f.
+////////////////////////////////////////////////////////
+const int J_3f[REG3F_VPT_COUNT] = {
+                                       -3, -2, -1, 0, 1, 2, -1, 1, 2, 3, 0, 1, -5, -2, 0, -3, -8, 1, -6, -4,
+                                       1, -6, -10, -8, -4, -12, -10, -8, -6, -4, -10, -8, -12, -10, -12, -10, -6, -12, -12, -4,
+                                       -12, -12
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3f.
+////////////////////////////////////////////////////////
+const double n_3f[REG3F_VPT_COUNT] = {
+            -0.251756547792325E-07, 0.601307193668763E-05, -0.100615977450049E-02,
+            0.999969140252192E+00, 0.214107759236486E+01, -0.165175571959086E+02, -0.141987303638727E-02,
+            0.269251915156554E+01, 0.349741815858722E+02, -0.300208695771783E+02, -0.131546288252539E+01,
+            -0.839091277286169E+01, 0.181545608337015E-09, -0.591099206478909E-03, 0.152115067087106E+01,
+            0.252956470663225E-04, 0.100726265203786E-14, -0.14977453386065E+01, -0.793940970562969E-09,
+            -0.150290891264717E-03, 0.151205531275133E+01, 0.470942606221652E-05, 0.195049710391712E-12,
+            -0.911627886266077E-08, 0.604374640201265E-03, -0.225132933900136E-15, 0.610916973582981E-11,
+            -0.303063908043404E-06, -0.137796070798409E-04, -0.919296736666106E-03, 0.639288223132545E-09,
+            0.753259479898699E-06, -0.400321478682929E-12, 0.756140294351614E-08, -0.912082054034891E-11,
+            -0.237612381140539E-07, 0.269586010591874E-04, -0.732828135157839E-10, 0.24199557830666E-09,
+            -0.405735532730322E-03, 0.189424143498011E-09, -0.486632965074563E-09
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3g.
+////////////////////////////////////////////////////////
+#define REG3G_VPT_COUNT 38
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3g.
+////////////////////////////////////////////////////////
+const int I_3g[REG3G_VPT_COUNT] = {
+                                       -12, -12, -12, -12, -12, -12, -10, -10, -10, -8, -8, -8, -8, -6, -6, -5, -5, -4, -3, -2,
+                                       -2, -2, -2, -1, -1, -1, 0, 0, 0, 1, 1, 1, 3, 5, 6, 8, 10, 10
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3g.
+////////////////////////////////////////////////////////
+const int J_3g[REG3G_VPT_COUNT] = {
+                                       7, 12, 14, 18, 22, 24, 14, 20, 24, 7, 8, 10, 12, 8, 22, 7, 20, 22, 7, 3,
+                                       5, 14, 24, 2, 8, 18, 0, 1, 2, 0, 1, 3, 24, 22, 12, 3, 0, 6
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3g.
+////////////////////////////////////////////////////////
+const double n_3g[REG3G_VPT_COUNT] = {
+            0.412209020652996E-04, -0.114987238280587E+07, 0.94818088503208E+10,
+            -0.195788865718971E+18, 0.49625070487130E+25, -0.105549884548496E+29, -0.758642165988278E+12,
+            -0.922172769596101E+23, 0.725379072059348E+30, -0.617718249205859E+02, 0.107555033344858E+05,
+            -0.379545802336487E+08, 0.228646846221831E+12, -0.499741093010619E+07, -0.280214310054101E+31,
+            0.104915406769586E+07, 0.613754229168619E+28, 0.802056715528378E+32, -0.298617819828065E+08,
+            -0.910782540134681E+02, 0.135033227281565E+06, -0.712949383408211E+19, -0.104578785289542E+37,
+            0.304331584444093E+02, 0.593250797959445E+10, -0.364174062110798E+28, 0.921791403532461E+00,
+            -0.337693609657471E+00, -0.724644143758508E+02, -0.110480239272601E+00, 0.536516031875059E+01,
+            -0.291441872156205E+04, 0.616338176535305E+40, -0.12088917586118E+39, 0.818396024524612E+23,
+            0.940781944835829E+09, -0.367279669545448E+05, -0.83751393179865500E+16
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3h.
+////////////////////////////////////////////////////////
+#define REG3H_VPT_COUNT 29
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3h.
+////////////////////////////////////////////////////////
+const int I_3h[REG3H_VPT_COUNT] = {
+                                       -12, -12, -10, -10, -10, -10, -10, -10, -8, -8, -8, -8, -8, -6, -6, -6, -5, -5, -5, -4,
+                                       -4, -3, -3, -2, -1, -1, 0, 1, 1
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3h.
+////////////////////////////////////////////////////////
+const int J_3h[REG3H_VPT_COUNT] = {
+                                       8, 12, 4, 6, 8, 10, 14, 16, 0, 1, 6, 7, 8, 4, 6, 8, 2, 3, 4, 2,
+                                       4, 1, 2, 0, 0, 2, 0, 0, 2
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3h.
+////////////////////////////////////////////////////////
+const double n_3h[REG3H_VPT_COUNT] = {
+            0.561379678887577E-01, 0.774135421587083E+10, 0.111482975877938E-08,
+            -0.143987128208183E-02, 0.19369655876492E+04, -0.605971823585005E+09, 0.171951568124337E+14,
+            -0.185461154985145E+17, 0.38785116807801E-16, -0.395464327846105E-13, -0.170875935679023E+03,
+            -0.21201062070122E+04, 0.177683337348191E+08, 0.110177443629575E+02, -0.234396091693313E+06,
+            -0.656174421999594E+07, 0.156362212977396E-04, -0.21294625702140E+01, 0.135249306374858E+02,
+            0.177189164145813E+00, 0.139499167345464E+04, -0.703670932036388E-02, -0.152011044389648E+00,
+            0.981916922991113E-04, 0.147199658618076E-02, 0.202618487025578E+02, 0.89934551894424E+00,
+            -0.211346402240858E+00, 0.249971752957491E+02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3i.
+////////////////////////////////////////////////////////
+#define REG3I_VPT_COUNT 42
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3i.
+////////////////////////////////////////////////////////
+const int I_3i[REG3I_VPT_COUNT] = {
+                                       0, 0, 0, 1, 1, 1, 1, 2, 3, 3, 4, 4, 4, 5, 5, 5, 7, 7, 8, 8,
+                                       10, 12, 12, 12, 14, 14, 14, 14, 18, 18, 18, 18, 18, 20, 20, 22, 24, 24, 32, 32,
+                                       36, 36
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3i.
+////////////////////////////////////////////////////////
+const int J_3i[REG3I_VPT_COUNT] = {
+                                       0, 1, 10, -4, -2, -1, 0, 0, -5, 0, -3, -2, -1, -6, -1, 12, -4, -3, -6, 10,
+                                       -8, -12, -6, -4, -10, -8, -4, 5, -12, -10, -8, -6, 2, -12, -10, -12, -12, -8, -10, -5,
+                                       -10, -8
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3i.
+////////////////////////////////////////////////////////
+const double n_3i[REG3I_VPT_COUNT] = {
+            0.106905684359136E+01, -0.148620857922333E+01, 0.2598622569804080E+15,
+            -0.446352055678749E-11, -0.566620757170032E-06, -0.235302885736849E-02, -0.269226321968839E+00,
+            0.922024992944392E+01, 0.357633505503772E-11, -0.173942565562222E+02, 0.700681785556229E-05,
+            -0.267050351075768E-03, -0.231779669675624E+01, -0.753533046979752E-12, 0.481337131452891E+01,
+            -0.223286270422356E+22, -0.118746004987383E-04, 0.646412934136496E-02, -0.410588536330937E-09,
+            0.422739537057241E+20, 0.313698180473812E-12, 0.16439533434504E-23, -0.339823323754373E-05,
+            -0.135268639905021E-01, -0.723252514211625E-14, 0.184386437538366E-08, -0.463959533752385E-01,
+            -0.992263100376750E+14, 0.688169154439335E-16, -0.222620998452197E-10, -0.540843018624083E-07,
+            0.345570606200257E-02, 0.422275800304086E+11, -0.126974478770487E-14, 0.927237985153679E-09,
+            0.612670812016489E-13, -0.722693924063497E-11, -0.383669502636822E-03, 0.374684572410204E-03,
+            -0.931976897511086E+05, -0.247690616026922E-01, 0.658110546759474E+02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3j.
+////////////////////////////////////////////////////////
+#define REG3J_VPT_COUNT 29
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3j.
+////////////////////////////////////////////////////////
+const int I_3j[REG3J_VPT_COUNT] = {
+                                       0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 4, 5, 5, 5, 6, 10, 12, 12, 14, 14,
+                                       14, 16, 18, 20, 20, 24, 24, 28, 28
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3j.
+////////////////////////////////////////////////////////
+const int J_3j[REG3J_VPT_COUNT] = {
+                                       -1, 0, 1, -2, -1, 1, -1, 1, -2, -2, 2, -3, -2, 0, 3, -6, -8, -3, -10, -8,
+                                       -5, -10, -12, -12, -10, -12, -6, -12, -5
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3j.
+////////////////////////////////////////////////////////
+const double n_3j[REG3J_VPT_COUNT] = {
+            -0.11137131739554E-03, 0.100342892423685E+01, 0.530615581928979E+01,
+            0.179058760078792E-05, -0.728541958464774E-03, -0.187576133371704E+02, 0.199060874071849E-02,
+            0.24357475537729E+02, -0.177040785499444E-03, -0.25968038522713E-02, -0.198704578406823E+03,
+            0.738627790224287E-04, -0.236264692844138E-02, -0.161023121314333E+01, 0.622322971786473E+04,
+            -0.960754116701669E-08, -0.510572269720488E-10, 0.767373781404211E-02, 0.663855469485254E-14,
+            -0.717590735526745E-09, 0.146564542926508E-04, 0.309029474277013E-11, -0.464216300971708E-15,
+            -0.390499637961161E-13, -0.236716126781431E-09, 0.454652854268717E-11, -0.422271787482497E-02,
+            0.283911742354706E-10, 0.270929002720228E+01
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3k.
+////////////////////////////////////////////////////////
+#define REG3K_VPT_COUNT 34
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3k.
+////////////////////////////////////////////////////////
+const int I_3k[REG3K_VPT_COUNT] = {
+                                       -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2,
+                                       2, 2, 2, 2, 5, 5, 5, 6, 6, 6, 6, 8, 10, 12
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3k.
+////////////////////////////////////////////////////////
+const int J_3k[REG3K_VPT_COUNT] = {
+                                       10, 12, -5, 6, -12, -6, -2, -1, 0, 1, 2, 3, 14, -3, -2, 0, 1, 2, -8, -6,
+                                       -3, -2, 0, 4, -12, -6, -3, -12, -10, -8, -5, -12, -12, -10
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3k.
+////////////////////////////////////////////////////////
+const double n_3k[REG3K_VPT_COUNT] = {
+            -0.401215699576099E+09, 0.484501478318406E+11, 0.394721471363678E-14,
+            0.372629967374147E+05, -0.369794374168666E-29, -0.380436407012452E-14, 0.475361629970233E-06,
+            -0.879148916140706E-03, 0.844317863844331E+00, 0.12243316265660E+02, -0.104529634830279E+03,
+            0.589702771277429E+03, -0.291026851164444E+14, 0.17034307284185E-05, -0.277617606975748E-03,
+            -0.344709605486686E+01, 0.221333862447095E+02, -0.194646110037079E+03, 0.808354639772825E-15,
+            -0.18084520914547E-10, -0.696664158132412E-05, -0.181057560300994E-02, 0.255830298579027E+01,
+            0.328913873658481E+04, -0.173270241249904E-18, -0.661876792558034E-06, -0.39568892342125E-02,
+            0.604203299819132E-17, -0.400879935920517E-13, 0.160751107464958E-08, 0.383719409025556E-04,
+            -0.649565446702457E-14, -0.14909532850600E-11, 0.541449377329581E-08
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3l.
+////////////////////////////////////////////////////////
+#define REG3L_VPT_COUNT 43
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3l.
+////////////////////////////////////////////////////////
+const int I_3l[REG3L_VPT_COUNT] = {
+                                       -12, -12, -12, -12, -12, -10, -10, -8, -8, -8, -8, -8, -8, -8, -6, -5, -5, -4, -4, -3,
+                                       -3, -3, -3, -2, -2, -2, -1, -1, -1, 0, 0, 0, 0, 1, 1, 2, 4, 5, 5, 6,
+                                       10, 10, 14
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3l.
+////////////////////////////////////////////////////////
+const int J_3l[REG3L_VPT_COUNT] = {
+                                       14, 16, 18, 20, 22, 14, 24, 6, 10, 12, 14, 18, 24, 36, 8, 4, 5, 7, 16, 1,
+                                       3, 18, 20, 2, 3, 10, 0, 1, 3, 0, 1, 2, 12, 0, 16, 1, 0, 0, 1, 14,
+                                       4, 12, 10
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3l.
+////////////////////////////////////////////////////////
+const double n_3l[REG3L_VPT_COUNT] = {
+            0.260702058647537E+10, -0.1882772136047040E+15, 0.554923870289667E+19,
+            -0.758966946387758E+23, 0.413865186848908E+27, -0.81503800073806E+12, -0.381458260489955E+33,
+            -0.123239564600519E-01, 0.226095631437174E+08, -0.49501780950672E+12, 0.52948299642286300E+16,
+            -0.444359478746295E+23, 0.521635864527315E+35, -0.487095672740742E+55, -0.714430209937547E+06,
+            0.127868634615495E+00, -0.100752127917598E+02, 0.77745143796099E+07, -0.108105480796471E+25,
+            -0.357578581169659E-05, -0.212857169423484E+01, 0.270706111085238E+30, -0.695953622348829E+33,
+            0.11060902747228E+00, 0.721559163361354E+02, -0.3063673075322190E+15, 0.26583961888553E-04,
+            0.253392392889754E-01, -0.214443041836579E+03, 0.937846601489667E+00, 0.22318404310170E+01,
+            0.338401222509191E+02, 0.494237237179718E+21, -0.198068404154428E+00, -0.14141534988114E+31,
+            -0.993862421613651E+02, 0.125070534142731E+03, -0.996473529004439E+03, 0.473137909872765E+05,
+            0.116662121219322E+33, -0.31587497627153300E+16, -0.445703369196945E+33, 0.642794932373694E+33
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3m.
+////////////////////////////////////////////////////////
+#define REG3M_VPT_COUNT 40
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3m.
+////////////////////////////////////////////////////////
+const int I_3m[REG3M_VPT_COUNT] = {
+                                       0, 3, 8, 20, 1, 3, 4, 5, 1, 6, 2, 4, 14, 2, 5, 3, 0, 1, 1, 1,
+                                       28, 2, 16, 0, 5, 0, 3, 4, 12, 16, 1, 8, 14, 0, 2, 3, 4, 8, 14, 24
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3m.
+////////////////////////////////////////////////////////
+const int J_3m[REG3M_VPT_COUNT] = {
+                                       0, 0, 0, 2, 5, 5, 5, 5, 6, 6, 7, 8, 8, 10, 10, 12, 14, 14, 18, 20,
+                                       20, 22, 22, 24, 24, 28, 28, 28, 28, 28, 32, 32, 32, 36, 36, 36, 36, 36, 36, 36
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3m.
+////////////////////////////////////////////////////////
+const double n_3m[REG3M_VPT_COUNT] = {
+            0.811384363481847E+00, -0.568199310990094E+04, -0.178657198172556E+11,
+            0.795537657613427E+32, -0.814568209346872E+05, -0.659774567602874E+08, -0.152861148659302E+11,
+            -0.560165667510446E+12, 0.458384828593949E+06, -0.385754000383848E+14, 0.453735800004273E+08,
+            0.939454935735563E+12, 0.266572856432938E+28, -0.547578313899097E+10, 0.2007257011123860E+15,
+            0.185007245563239E+13, 0.185135446828337E+09, -0.170451090076385E+12, 0.1578903660376140E+15,
+            -0.20253050974877400E+16, 0.36819392618357E+60, 0.170215539458936E+18, 0.639234909918741E+42,
+            -0.8216981607219560E+15, -0.795260241872306E+24, 0.23341586947851E+18, -0.600079934586803E+23,
+            0.594584382273384E+25, 0.189461279349492E+40, -0.810093428842645E+46, 0.188813911076809E+22,
+            0.111052244098768E+36, 0.291133958602503E+46, -0.32942192395146E+22, -0.137570282536696E+26,
+            0.181508996303902E+28, -0.346865122768353E+30, -0.21196114877426E+38, -0.128617899887675E+49,
+            0.479817895699239E+65
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3n.
+////////////////////////////////////////////////////////
+#define REG3N_VPT_COUNT 39
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3n.
+////////////////////////////////////////////////////////
+const int I_3n[REG3N_VPT_COUNT] = {
+                                       0, 3, 4, 6, 7, 10, 12, 14, 18, 0, 3, 5, 6, 8, 12, 0, 3, 7, 12, 2,
+                                       3, 4, 2, 4, 7, 4, 3, 5, 6, 0, 0, 3, 1, 0, 1, 0, 1, 0, 1
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3n.
+////////////////////////////////////////////////////////
+const int J_3n[REG3N_VPT_COUNT] = {
+                                       -12, -12, -12, -12, -12, -12, -12, -12, -12, -10, -10, -10, -10, -10, -10, -8, -8, -8, -8, -6,
+                                       -6, -6, -5, -5, -5, -4, -3, -3, -3, -2, -1, -1, 0, 1, 1, 2, 4, 5, 6
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3n.
+////////////////////////////////////////////////////////
+const double n_3n[REG3N_VPT_COUNT] = {
+            0.280967799943151E-38, 0.614869006573609E-30, 0.582238667048942E-27,
+            0.390628369238462E-22, 0.821445758255119E-20, 0.402137961842776E-14, 0.651718171878301E-12,
+            -0.211773355803058E-07, 0.264953354380072E-02, -0.135031446451331E-31, -0.607246643970893E-23,
+            -0.402352115234494E-18, -0.744938506925544E-16, 0.189917206526237E-12, 0.364975183508473E-05,
+            0.177274872361946E-25, -0.334952758812999E-18, -0.421537726098389E-08, -0.391048167929649E-01,
+            0.541276911564176E-13, 0.705412100773699E-11, 0.258585887897486E-08, -0.493111362030162E-10,
+            -0.158649699894543E-05, -0.52503742788610E+00, 0.220019901729615E-02, -0.643064132636925E-02,
+            0.629154149015048E+02, 0.135147318617061E+03, 0.240560808321713E-06, -0.890763306701305E-03,
+            -0.440209599407714E+04, -0.302807107747776E+03, 0.159158748314599E+04, 0.232534272709876E+06,
+            -0.79268120713260E+06, -0.869871364662769E+11, 0.354542769185671E+12, 0.4008492401293290E+15
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3o.
+////////////////////////////////////////////////////////
+#define REG3O_VPT_COUNT 24
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3o.
+////////////////////////////////////////////////////////
+const int I_3o[REG3O_VPT_COUNT] = {
+                                       0, 0, 0, 2, 3, 4, 4, 4, 4, 4, 5, 5, 6, 7, 8, 8, 8, 10, 10, 14,
+                                       14, 20, 20, 24
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3o.
+////////////////////////////////////////////////////////
+const int J_3o[REG3O_VPT_COUNT] = {
+                                       -12, -4, -1, -1, -10, -12, -8, -5, -4, -1, -4, -3, -8, -12, -10, -8, -4, -12, -8, -12,
+                                       -8, -12, -10, -12
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3o.
+////////////////////////////////////////////////////////
+const double n_3o[REG3O_VPT_COUNT] = {
+            0.128746023979718E-34, -0.735234770382342E-11, 0.28907869214915E-02,
+            0.244482731907223E+00, 0.141733492030985E-23, -0.354533853059476E-28, -0.594539202901431E-17,
+            -0.585188401782779E-08, 0.201377325411803E-05, 0.138647388209306E+01, -0.173959365084772E-04,
+            0.137680878349369E-02, 0.814897605805513E-14, 0.425596631351839E-25, -0.387449113787755E-17,
+            0.13981474793024E-12, -0.171849638951521E-02, 0.641890529513296E-21, 0.118960578072018E-10,
+            -0.155282762571611E-17, 0.233907907347507E-07, -0.174093247766213E-12, 0.377682649089149E-08,
+            -0.516720236575302E-10
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3p.
+////////////////////////////////////////////////////////
+#define REG3P_VPT_COUNT 27
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3p.
+////////////////////////////////////////////////////////
+const int I_3p[REG3P_VPT_COUNT] = {
+                                       0, 0, 0, 0, 1, 2, 3, 3, 4, 6, 7, 7, 8, 10, 12, 12, 12, 14, 14, 14,
+                                       16, 18, 20, 22, 24, 24, 36
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3p.
+////////////////////////////////////////////////////////
+const int J_3p[REG3P_VPT_COUNT] = {
+                                       -1, 0, 1, 2, 1, -1, -3, 0, -2, -2, -5, -4, -2, -3, -12, -6, -5, -10, -8, -3,
+                                       -8, -8, -10, -10, -12, -8, -12
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3p.
+////////////////////////////////////////////////////////
+const double n_3p[REG3P_VPT_COUNT] = {
+            -0.982825342010366E-04, 0.105145700850612E+01, 0.116033094095084E+03,
+            0.324664750281543E+04, -0.123592348610137E+04, -0.561403450013495E-01, 0.856677401640869E-07,
+            0.236313425393924E+03, 0.972503292350109E-02, -0.103001994531927E+01, -0.149653706199162E-08,
+            -0.215743778861592E-04, -0.834452198291445E+01, 0.586602660564988E+00, 0.343480022104968E-25,
+            0.816256095947021E-05, 0.294985697916798E-02, 0.711730466276584E-16, 0.400954763806941E-09,
+            0.107766027032853E+02, -0.409449599138182E-06, -0.729121307758902E-05, 0.677107970938909E-08,
+            0.602745973022975E-07, -0.382323011855257E-10, 0.179946628317437E-02, -0.345042834640005E-03
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3q.
+////////////////////////////////////////////////////////
+#define REG3Q_VPT_COUNT 24
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3q.
+////////////////////////////////////////////////////////
+const int I_3q[REG3Q_VPT_COUNT] = {
+                                       -12, -12, -10, -10, -10, -10, -8, -6, -5, -5, -4, -4, -3, -2, -2, -2, -2, -1, -1, -1,
+                                       0, 1, 1, 1
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3q.
+////////////////////////////////////////////////////////
+const int J_3q[REG3Q_VPT_COUNT] = {
+                                       10, 12, 6, 7, 8, 10, 8, 6, 2, 5, 3, 4, 3, 0, 1, 2, 4, 0, 1, 2,
+                                       0, 0, 1, 3
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3q.
+////////////////////////////////////////////////////////
+const double n_3q[REG3Q_VPT_COUNT] = {
+            -0.82043384325995E+05, 0.473271518461586E+11, -0.805950021005413E-01,
+            0.32860002543598E+02, -0.35661702998249E+04, -0.172985781433335E+10, 0.351769232729192E+08,
+            -0.775489259985144E+06, 0.710346691966018E-04, 0.993499883820274E+05, -0.64209417190457E+00,
+            -0.612842816820083E+04, 0.232808472983776E+03, -0.142808220416837E-04, -0.643596060678456E-02,
+            -0.428577227475614E+01, 0.225689939161918E+04, 0.10035565172151E-02, 0.333491455143516E+00,
+            0.109697576888873E+01, 0.961917379376452E+00, -0.838165632204598E-01, 0.247795908411492E+01,
+            -0.319114969006533E+04
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3r.
+////////////////////////////////////////////////////////
+#define REG3R_VPT_COUNT 27
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3r.
+////////////////////////////////////////////////////////
+const int I_3r[REG3R_VPT_COUNT] = {
+                                       -8, -8, -3, -3, -3, -3, -3, 0, 0, 0, 0, 3, 3, 8, 8, 8, 8, 10, 10, 10,
+                                       10, 10, 10, 10, 10, 12, 14
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3r.
+////////////////////////////////////////////////////////
+const int J_3r[REG3R_VPT_COUNT] = {
+                                       6, 14, -3, 3, 4, 5, 8, -1, 0, 1, 5, -6, -2, -12, -10, -8, -5, -12, -10, -8,
+                                       -6, -5, -4, -3, -2, -12, -12
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3r.
+////////////////////////////////////////////////////////
+const double n_3r[REG3R_VPT_COUNT] = {
+            0.144165955660863E-02, -0.701438599628258E+13, -0.830946716459219E-16,
+            0.261975135368109E+00, 0.393097214706245E+03, -0.104334030654021E+05, 0.490112654154211E+09,
+            -0.147104222772069E-03, 0.103602748043408E+01, 0.305308890065089E+01, -0.399745276971264E+07,
+            0.56923371959375E-11, -0.464923504407778E-01, -0.535400396512906E-17, 0.399988795693162E-12,
+            -0.536479560201811E-06, 0.159536722411202E-01, 0.270303248860217E-14, 0.244247453858506E-07,
+            -0.983430636716454E-05, 0.663513144224454E-01, -0.993456957845006E+01, 0.546491323528491E+03,
+            -0.143365406393758E+05, 0.150764974125511E+06, -0.337209709340105E-09, 0.377501980025469E-08
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3s.
+////////////////////////////////////////////////////////
+#define REG3S_VPT_COUNT 29
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3s.
+////////////////////////////////////////////////////////
+const int I_3s[REG3S_VPT_COUNT] = {
+                                       -12, -12, -10, -8, -6, -5, -5, -4, -4, -3, -3, -2, -1, -1, -1, 0, 0, 0, 0, 1,
+                                       1, 3, 3, 3, 4, 4, 4, 5, 14
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3s.
+////////////////////////////////////////////////////////
+const int J_3s[REG3S_VPT_COUNT] = {
+                                       20, 24, 22, 14, 36, 8, 16, 6, 32, 3, 8, 4, 1, 2, 3, 0, 1, 4, 28, 0,
+                                       32, 0, 1, 2, 3, 18, 24, 4, 24
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3s.
+////////////////////////////////////////////////////////
+const double n_3s[REG3S_VPT_COUNT] = {
+            -0.532466612140254E+23, 0.100415480000824E+32, -0.191540001821367E+30,
+            0.105618377808847E+17, 0.202281884477061E+59, 0.884585472596134E+08, 0.166540181638363E+23,
+            -0.313563197669111E+06, -0.185662327545324E+54, -0.624942093918942E-01, -0.50416072413259E+10,
+            0.187514491833092E+05, 0.121399979993217E-02, 0.188317043049455E+01, -0.16707350396206E+04,
+            0.965961650599775E+00, 0.294885696802488E+01, -0.653915627346115E+05, 0.604012200163444E+50,
+            -0.198339358557937E+00, -0.175984090163501E+58, 0.356314881403987E+01, -0.575991255144384E+03,
+            0.456213415338071E+05, -0.109174044987829E+08, 0.437796099975134E+34, -0.616552611135792E+46,
+            0.193568768917797E+10, 0.950898170425042E+54
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3t.
+////////////////////////////////////////////////////////
+#define REG3T_VPT_COUNT 33
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3t.
+////////////////////////////////////////////////////////
+const int I_3t[REG3T_VPT_COUNT] = {
+                                       0, 0, 0, 0, 1, 1, 2, 2, 2, 3, 3, 4, 4, 7, 7, 7, 7, 7, 10, 10,
+                                       10, 10, 10, 18, 20, 22, 22, 24, 28, 32, 32, 32, 36
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3t.
+////////////////////////////////////////////////////////
+const int J_3t[REG3T_VPT_COUNT] = {
+                                       0, 1, 4, 12, 0, 10, 0, 6, 14, 3, 8, 0, 10, 3, 4, 7, 20, 36, 10, 12,
+                                       14, 16, 22, 18, 32, 22, 36, 24, 28, 22, 32, 36, 36
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3t.
+////////////////////////////////////////////////////////
+const double n_3t[REG3T_VPT_COUNT] = {
+            0.155287249586268E+01, 0.664235115009031E+01, -0.28936623672721E+04,
+            -0.385923202309848E+13, -0.291002915783761E+01, -0.829088246858083E+12, 0.176814899675218E+01,
+            -0.534686695713469E+09, 0.160464608687834E+18, 0.196435366560186E+06, 0.156637427541729E+13,
+            -0.178154560260006E+01, -0.22974623762369200E+16, 0.385659001648006E+08, 0.110554446790543E+10,
+            -0.677073830687349E+14, -0.327910592086523E+31, -0.341552040860644E+51, -0.527251339709047E+21,
+            0.245375640937055E+24, -0.168776617209269E+27, 0.358958955867578E+29, -0.656475280339411E+36,
+            0.355286045512301E+39, 0.56902145441327E+58, -0.700584546433113E+48, -0.705772623326374E+65,
+            0.166861176200148E+53, -0.300475129680486E+61, -0.668481295196808E+51, 0.428432338620678E+69,
+            -0.444227367758304E+72, -0.281396013562745E+77
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3u.
+////////////////////////////////////////////////////////
+#define REG3U_VPT_COUNT 38
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3u.
+////////////////////////////////////////////////////////
+const int I_3u[REG3U_VPT_COUNT] = {
+                                       -12, -10, -10, -10, -8, -8, -8, -6, -6, -5, -5, -5, -3, -1, -1, -1, -1, 0, 0, 1,
+                                       2, 2, 3, 5, 5, 5, 6, 6, 8, 8, 10, 12, 12, 12, 14, 14, 14, 14
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3u.
+////////////////////////////////////////////////////////
+const int J_3u[REG3U_VPT_COUNT] = {
+                                       14, 10, 12, 14, 10, 12, 14, 8, 12, 4, 8, 12, 2, -1, 1, 12, 14, -3, 1, -2,
+                                       5, 10, -5, -4, 2, 3, -5, 2, -8, 8, -4, -12, -4, 4, -12, -10, -6, 6
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3u.
+////////////////////////////////////////////////////////
+const double n_3u[REG3U_VPT_COUNT] = {
+            0.122088349258355E+18, 0.104216468608488E+10, -0.88266693156465200E+16,
+            0.259929510849499E+20, 0.2226127791422110E+15, -0.878473585050085E+18, -0.314432577551552E+22,
+            -0.216934916996285E+13, 0.159079648196849E+21, -0.339567617303423E+03, 0.884387651337836E+13,
+            -0.843405926846418E+21, 0.114178193518022E+02, -0.122708229235641E-03, -0.106201671767107E+03,
+            0.903443213959313E+25, -0.693996270370852E+28, 0.648916718965575E-08, 0.718957567127851E+04,
+            0.105581745346187E-02, -0.6519032036025810E+15, -0.160116813274676E+25, -0.510254294237837E-08,
+            -0.152355388953402E+00, 0.677143292290144E+12, 0.2763784383789300E+15, 0.116862983141686E-01,
+            -0.301426947980171E+14, 0.16971981388484E-07, 0.104674840020929E+27, -0.10801690456014E+05,
+            -0.990623601934295E-12, 0.536116483602738E+07, 0.226145963747881E+22, -0.48873156577621E-09,
+            0.15100154888067E-04, -0.22770046464392E+05, -0.781754507698846E+28
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3v.
+////////////////////////////////////////////////////////
+#define REG3V_VPT_COUNT 39
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3v.
+////////////////////////////////////////////////////////
+const int I_3v[REG3V_VPT_COUNT] = {
+                                       -10, -8, -6, -6, -6, -6, -6, -6, -5, -5, -5, -5, -5, -5, -4, -4, -4, -4, -3, -3,
+                                       -3, -2, -2, -1, -1, 0, 0, 0, 1, 1, 3, 4, 4, 4, 5, 8, 10, 12, 14
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3v.
+////////////////////////////////////////////////////////
+const int J_3v[REG3V_VPT_COUNT] = {
+                                       -8, -12, -12, -3, 5, 6, 8, 10, 1, 2, 6, 8, 10, 14, -12, -10, -6, 10, -3, 10,
+                                       12, 2, 4, -2, 0, -2, 6, 10, -12, -10, 3, -6, 3, 10, 2, -12, -2, -3, 1
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3v.
+////////////////////////////////////////////////////////
+const double n_3v[REG3V_VPT_COUNT] = {
+            -0.415652812061591E-54, 0.177441742924043E-60, -0.357078668203377E-54,
+            0.359252213604114E-25, -0.259123736380269E+02, 0.59461976619346E+05, -0.624184007103158E+11,
+            0.313080299915944E+17, 0.105006446192036E-08, -0.192824336984852E-05, 0.654144373749937E+06,
+            0.513117462865044E+13, -0.697595750347391E+19, -0.103977184454767E+29, 0.119563135540666E-47,
+            -0.436677034051655E-41, 0.926990036530639E-29, 0.587793105620748E+21, 0.280375725094731E-17,
+            -0.192359972440634E+23, 0.742705723302738E+27, -0.517429682450605E+02, 0.820612048645469E+07,
+            -0.188214882341448E-08, 0.184587261114837E-01, -0.135830407782663E-05, -0.723681885626348E+17,
+            -0.223449194054124E+27, -0.111526741826431E-34, 0.276032601145151E-28, 0.1348564915678530E+15,
+            0.65244029334586E-09, 0.51065511977436E+17, -0.468138358908732E+32, -0.76066749118327900E+16,
+            -0.417247986986821E-18, 0.312545677756104E+14, -0.1003753338641860E+15, 0.247761392329058E+27
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3w.
+////////////////////////////////////////////////////////
+#define REG3W_VPT_COUNT 35
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3w.
+////////////////////////////////////////////////////////
+const int I_3w[REG3W_VPT_COUNT] = {
+                                       -12, -12, -10, -10, -8, -8, -8, -6, -6, -6, -6, -5, -4, -4, -3, -3, -2, -2, -1, -1,
+                                       -1, 0, 0, 1, 2, 2, 3, 3, 5, 5, 5, 8, 8, 10, 10
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3w.
+////////////////////////////////////////////////////////
+const int J_3w[REG3W_VPT_COUNT] = {
+                                       8, 14, -1, 8, 6, 8, 14, -4, -3, 2, 8, -10, -1, 3, -10, 3, 1, 2, -8, -4,
+                                       1, -12, 1, -1, -1, 2, -12, -5, -10, -8, -6, -12, -10, -12, -8
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3w.
+////////////////////////////////////////////////////////
+const double n_3w[REG3W_VPT_COUNT] = {
+            -0.586219133817016E-07, -0.894460355005526E+11, 0.531168037519774E-30,
+            0.109892402329239E+00, -0.575368389425212E-01, 0.228276853990249E+05, -0.158548609655002E+19,
+            0.329865748576503E-27, -0.634987981190669E-24, 0.615762068640611E-08, -0.961109240985747E+08,
+            -0.406274286652625E-44, -0.471103725498077E-12, 0.725937724828145E+00, 0.187768525763682E-38,
+            -0.103308436323771E+04, -0.662552816342168E-01, 0.57951404176571E+03, 0.237416732616644E-26,
+            0.271700235739893E-14, -0.90788621348360E+02, -0.171242509570207E-36, 0.156792067854621E+03,
+            0.92326135790147E+00, -0.597865988422577E+01, 0.321988767636389E+07, -0.399441390042203E-29,
+            0.493429086046981E-07, 0.812036983370565E-19, -0.207610284654137E-11, -0.340821291419719E-06,
+            0.542000573372233E-17, -0.856711586510214E-12, 0.266170454405981E-13, 0.858133791857099E-05
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3x.
+////////////////////////////////////////////////////////
+#define REG3X_VPT_COUNT 36
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3x.
+////////////////////////////////////////////////////////
+const int I_3x[REG3X_VPT_COUNT] = {
+                                       -8, -6, -5, -4, -4, -4, -3, -3, -1, 0, 0, 0, 1, 1, 2, 3, 3, 3, 4, 5,
+                                       5, 5, 6, 8, 8, 8, 8, 10, 12, 12, 12, 12, 14, 14, 14, 14
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3x.
+////////////////////////////////////////////////////////
+const int J_3x[REG3X_VPT_COUNT] = {
+                                       14, 10, 10, 1, 2, 14, -2, 12, 5, 0, 4, 10, -10, -1, 6, -12, 0, 8, 3, -6,
+                                       -2, 1, 1, -6, -3, 1, 8, -8, -10, -8, -5, -4, -12, -10, -8, -6
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3x.
+////////////////////////////////////////////////////////
+const double n_3x[REG3X_VPT_COUNT] = {
+            0.377373741298151E+19, -0.507100883722913E+13, -0.10336322559886000E+16,
+            0.184790814320773E-05, -0.924729378390945E-03, -0.425999562292738E+24, -0.462307771873973E-12,
+            0.107319065855767E+22, 0.648662492280682E+11, 0.244200600688281E+01, -0.851535733484258E+10,
+            0.169894481433592E+22, 0.21578022250902E-26, -0.320850551367334E+00, -0.38264244845861E+17,
+            -0.275386077674421E-28, -0.563199253391666E+06, -0.326068646279314E+21, 0.397949001553184E+14,
+            0.100824008584757E-06, 0.162234569738433E+05, -0.432355225319745E+11, -0.59287424559861E+12,
+            0.133061647281106E+01, 0.157338197797544E+07, 0.258189614270853E+14, 0.262413209706358E+25,
+            -0.920011937431142E-01, 0.220213765905426E-02, -0.110433759109547E+02, 0.847004870612087E+07,
+            -0.592910695762536E+09, -0.18302717326966E-04, 0.181339603516302E+00, -0.119228759669889E+04,
+            0.430867658061468E+07
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3y.
+////////////////////////////////////////////////////////
+#define REG3Y_VPT_COUNT 20
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3y.
+////////////////////////////////////////////////////////
+const int I_3y[REG3Y_VPT_COUNT] = {
+                                       0, 0, 0, 0, 1, 2, 2, 2, 2, 3, 3, 3, 4, 4, 5, 5, 8, 8, 10, 12
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3y.
+////////////////////////////////////////////////////////
+const int J_3y[REG3Y_VPT_COUNT] = {
+                                       -3, 1, 5, 8, 8, -4, -1, 4, 5, -8, 4, 8, -6, 6, -2, 1, -8, -2, -5, -8
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3y.
+////////////////////////////////////////////////////////
+const double n_3y[REG3Y_VPT_COUNT] = {
+            -0.525597995024633E-09, 0.583441305228407E+04, -0.134778968457925E+17,
+            0.118973500934212E+26, -0.159096490904708E+27, -0.315839902302021E-06, 0.496212197158239E+03,
+            0.327777227273171E+19, -0.527114657850696E+22, 0.210017506281863E-16, 0.705106224399834E+21,
+            -0.266713136106469E+31, -0.145370512554562E-07, 0.14933391705313E+28, -0.149795620287641E+08,
+            -0.38188190627110000E+16, 0.724660165585797E-04, -0.937808169550193E+14, 0.514411468376383E+10,
+            -0.828198594040141E+05
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,T)
+///  in subregion 3z.
+////////////////////////////////////////////////////////
+#define REG3Z_VPT_COUNT 23
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,T) in subregion 3z.
+////////////////////////////////////////////////////////
+const int I_3z[REG3Z_VPT_COUNT] = {
+                                       -8, -6, -5, -5, -4, -4, -4, -3, -3, -3, -2, -1, 0, 1, 2, 3, 3, 6, 6, 6,
+                                       6, 8, 8
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced temperature exponents of the backward
+///  equation v(p,T) in subregion 3z.
+////////////////////////////////////////////////////////
+const int J_3z[REG3Z_VPT_COUNT] = {
+                                       3, 6, 6, 8, 5, 6, 8, -2, 5, 6, 2, -6, 3, 1, 6, -6, -2, -6, -5, -4,
+                                       -1, -8, -4
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,T)
+///  in subregion 3z.
+////////////////////////////////////////////////////////
+const double n_3z[REG3Z_VPT_COUNT] = {
+            0.24400789229065E-10, -0.463057430331242E+07, 0.728803274777712E+10,
+            0.32777630285885600E+16, -0.110598170118409E+10, -0.323899915729957E+13, 0.92381400702324500E+16,
+            0.842250080413712E-12, 0.663221436245506E+12, -0.1671701866721390E+15, 0.253749358701391E+04,
+            -0.819731559610523E-20, 0.328380587890663E+12, -0.625004791171543E+08, 0.803197957462023E+21,
+            -0.204397011338353E-10, -0.378391047055938E+04, 0.97287654593862E-02, 0.154355721681459E+02,
+            -0.373962862928643E+04, -0.682859011374572E+11, -0.248488015614543E-03, 0.394536049497068E+07
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Reducing quantities, shifts, and exponents of a subregion backward equation
+///  v(p,T), which has the form
+///  v/vstar = [sum(n[i] * ((p/pstar - a)^c)^I[i] * ((T/tstar - b)^d)^J[i])]^e
+////////////////////////////////////////////////////////
+struct VptEquation {
+	int count;          ///< length of the exponent and coefficient arrays
+	double vstar;       ///< reducing specific volume
+	double pstar;       ///< reducing pressure
+	double tstar;       ///< reducing temperature
+	double a;           ///< shift of the reduced pressure
+	double b;           ///< shift of the reduced temperature
+	double c;           ///< exponent of the shifted reduced pressure
+	double d;           ///< exponent of the shifted reduced temperature
+	double e;           ///< exponent of the sum (1 or 4)
+	const int *I;       ///< reduced pressure exponents
+	const int *J;       ///< reduced temperature exponents
+	const double *n;    ///< coefficients
+};
+
+////////////////////////////////////////////////////////
+///	\brief Backward equations v(p,T) of subregions 3a through 3z, in order.
+///
+/// Subregion 3n has the different form v/vstar = exp(sum(n[i] * (p/pstar - a)^I[i] * (T/tstar - b)^J[i]))
+/// and its c, d, and e are unused.
+////////////////////////////////////////////////////////
+const VptEquation vpt_3[26] = {
+	{REG3A_VPT_COUNT, 0.0024, 100, 760, 0.085, 0.817, 1, 1, 1, I_3a, J_3a, n_3a},
+	{REG3B_VPT_COUNT, 0.0041, 100, 860, 0.28, 0.779, 1, 1, 1, I_3b, J_3b, n_3b},
+	{REG3C_VPT_COUNT, 0.0022, 40, 690, 0.259, 0.903, 1, 1, 1, I_3c, J_3c, n_3c},
+	{REG3D_VPT_COUNT, 0.0029, 40, 690, 0.559, 0.939, 1, 1, 4, I_3d, J_3d, n_3d},
+	{REG3E_VPT_COUNT, 0.0032, 40, 710, 0.587, 0.918, 1, 1, 1, I_3e, J_3e, n_3e},
+	{REG3F_VPT_COUNT, 0.0064, 40, 730, 0.587, 0.891, 0.5, 1, 4, I_3f, J_3f, n_3f},
+	{REG3G_VPT_COUNT, 0.0027, 25, 660, 0.872, 0.971, 1, 1, 4, I_3g, J_3g, n_3g},
+	{REG3H_VPT_COUNT, 0.0032, 25, 660, 0.898, 0.983, 1, 1, 4, I_3h, J_3h, n_3h},
+	{REG3I_VPT_COUNT, 0.0041, 25, 660, 0.91, 0.984, 0.5, 1, 4, I_3i, J_3i, n_3i},
+	{REG3J_VPT_COUNT, 0.0054, 25, 670, 0.875, 0.964, 0.5, 1, 4, I_3j, J_3j, n_3j},
+	{REG3K_VPT_COUNT, 0.0077, 25, 680, 0.802, 0.935, 1, 1, 1, I_3k, J_3k, n_3k},
+	{REG3L_VPT_COUNT, 0.0026, 24, 650, 0.908, 0.989, 1, 1, 4, I_3l, J_3l, n_3l},
+	{REG3M_VPT_COUNT, 0.0028, 23, 650, 1.0, 0.997, 1, 0.25, 1, I_3m, J_3m, n_3m},
+	{REG3N_VPT_COUNT, 0.0031, 23, 650, 0.976, 0.997, 0, 0, 0, I_3n, J_3n, n_3n},
+	{REG3O_VPT_COUNT, 0.0034, 23, 650, 0.974, 0.996, 0.5, 1, 1, I_3o, J_3o, n_3o},
+	{REG3P_VPT_COUNT, 0.0041, 23, 650, 0.972, 0.997, 0.5, 1, 1, I_3p, J_3p, n_3p},
+	{REG3Q_VPT_COUNT, 0.0022, 23, 650, 0.848, 0.983, 1, 1, 4, I_3q, J_3q, n_3q},
+	{REG3R_VPT_COUNT, 0.0054, 23, 650, 0.874, 0.982, 1, 1, 1, I_3r, J_3r, n_3r},
+	{REG3S_VPT_COUNT, 0.0022, 21, 640, 0.886, 0.99, 1, 1, 4, I_3s, J_3s, n_3s},
+	{REG3T_VPT_COUNT, 0.0088, 20, 650, 0.803, 1.02, 1, 1, 1, I_3t, J_3t, n_3t},
+	{REG3U_VPT_COUNT, 0.0026, 23, 650, 0.902, 0.988, 1, 1, 1, I_3u, J_3u, n_3u},
+	{REG3V_VPT_COUNT, 0.0031, 23, 650, 0.96, 0.995, 1, 1, 1, I_3v, J_3v, n_3v},
+	{REG3W_VPT_COUNT, 0.0039, 23, 650, 0.959, 0.995, 1, 1, 4, I_3w, J_3w, n_3w},
+	{REG3X_VPT_COUNT, 0.0049, 23, 650, 0.91, 0.988, 1, 1, 1, I_3x, J_3x, n_3x},
+	{REG3Y_VPT_COUNT, 0.0031, 22, 650, 0.996, 0.994, 1, 1, 4, I_3y, J_3y, n_3y},
+	{REG3Z_VPT_COUNT, 0.0038, 22, 650, 0.993, 0.994, 1, 1, 4, I_3z, J_3z, n_3z}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific volume as a function of pressure and temperature in IAPWS Region 3
+///  using the IAPWS backward equations
+///
+/// The backward equations agree with the forward (Helmholtz) equation to within
+/// 0.1% of the specific volume away from the critical point, and within a few percent
+/// in the immediate vicinity of the critical point.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+///
+/// \return specific volume
+///////////////////////////////////////////////////////////////////////////////
+double backward_v_pt_3(double p, double t)
+{
+	char sub = subregion_pt_3(p, t);
+	const VptEquation &eq = vpt_3[sub - 'a'];
+	double x = p / eq.pstar - eq.a;
+	double y = t / eq.tstar - eq.b;
+	if (sub == 'n')
+		return eq.vstar * exp(power_series(eq.I, eq.J, eq.n, eq.count, x, y));
+	if (eq.c != 1)
+		x = pow(x, eq.c);
+	if (eq.d != 1)
+		y = pow(y, eq.d);
+	double sum = power_series(eq.I, eq.J, eq.n, eq.count, x, y);
+	if (eq.e == 4)
+		sum *= sum * sum * sum;
+	return eq.vstar * sum;
+}
+
+//------------------------------------------------------------------------------
+// BACKWARD EQUATIONS T(p,h) AND v(p,h)
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation h(p) between
+///  subregions 3a and 3b.
+////////////////////////////////////////////////////////
+const double n_3ab_h[4] = {
+            0.201464004206875E+04, 0.374696550136983E+01, -0.219921901054187E-01, 0.87513168600995E-04
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific enthalpy on the boundary between subregions 3a and 3b
+///  of the backward equations T(p,h) and v(p,h)
+///
+/// The boundary passes through the critical point; below the critical pressure it
+/// lies inside the two-phase region.
+///
+/// \param[in] p  pressure
+///
+/// \return specific enthalpy on the boundary
+///////////////////////////////////////////////////////////////////////////////
+double b3ab_h_p(double p)
+{
+	return boundary_poly(n_3ab_h, 4, p);
+}
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,h)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+#define REG3A_TPH_COUNT 31
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,h) in subregion 3a.
+////////////////////////////////////////////////////////
+const int I_3a_tph[REG3A_TPH_COUNT] = {
+                                       -12, -12, -12, -12, -12, -12, -12, -12, -10, -10, -10, -8, -8, -8, -8, -5, -3, -2, -2, -2,
+                                       -1, -1, 0, 0, 1, 3, 3, 4, 4, 10, 12
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation T(p,h) in subregion 3a.
+////////////////////////////////////////////////////////
+const int J_3a_tph[REG3A_TPH_COUNT] = {
+                                       0, 1, 2, 6, 14, 16, 20, 22, 1, 5, 12, 0, 2, 4, 10, 2, 0, 1, 3, 4,
+                                       0, 2, 0, 1, 1, 0, 1, 0, 3, 4, 5
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,h)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+const double n_3a_tph[REG3A_TPH_COUNT] = {
+            -0.133645667811215E-06, 0.455912656802978E-05, -0.146294640700979E-04,
+            0.63934131297008E-02, 0.372783927268847E+03, -0.718654377460447E+04, 0.57349475210340E+06,
+            -0.267569329111439E+07, -0.334066283302614E-04, -0.245479214069597E-01, 0.478087847764996E+02,
+            0.764664131818904E-05, 0.128350627676972E-02, 0.171219081377331E-01, -0.851007304583213E+01,
+            -0.136513461629781E-01, -0.384460997596657E-05, 0.337423807911655E-02, -0.551624873066791E+00,
+            0.72920227710747E+00, -0.992522757376041E-02, -0.119308831407288E+00, 0.793929190615421E+00,
+            0.454270731799386E+00, 0.20999859125991E+00, -0.642109823904738E-02, -0.23515586860454E-01,
+            0.252233108341612E-02, -0.764885133368119E-02, 0.136176427574291E-01, -0.133027883575669E-01
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,h)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+#define REG3B_TPH_COUNT 33
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,h) in subregion 3b.
+////////////////////////////////////////////////////////
+const int I_3b_tph[REG3B_TPH_COUNT] = {
+                                       -12, -12, -10, -10, -10, -10, -10, -8, -8, -8, -8, -8, -6, -6, -6, -4, -4, -3, -2, -2,
+                                       -1, -1, -1, -1, -1, -1, 0, 0, 1, 3, 5, 6, 8
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation T(p,h) in subregion 3b.
+////////////////////////////////////////////////////////
+const int J_3b_tph[REG3B_TPH_COUNT] = {
+                                       0, 1, 0, 1, 5, 10, 12, 0, 1, 2, 4, 10, 0, 1, 2, 0, 1, 5, 0, 4,
+                                       2, 4, 6, 10, 14, 16, 0, 2, 1, 1, 1, 1, 1
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,h)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+const double n_3b_tph[REG3B_TPH_COUNT] = {
+            0.32325457364492E-04, -0.127575556587181E-03, -0.475851877356068E-03,
+            0.156183014181602E-02, 0.105724860113781E+00, -0.858514221132534E+02, 0.724140095480911E+03,
+            0.296475810273257E-02, -0.592721983365988E-02, -0.126305422818666E-01, -0.115716196364853E+00,
+            0.849000969739595E+02, -0.108602260086615E-01, 0.154304475328851E-01, 0.750455441524466E-01,
+            0.252520973612982E-01, -0.602507901232996E-01, -0.307622221350501E+01, -0.574011959864879E-01,
+            0.503471360939849E+01, -0.925081888584834E+00, 0.391733882917546E+01, -0.77314600713019E+02,
+            0.949308762098587E+04, -0.141043719679409E+07, 0.849166230819026E+07, 0.861095729446704E+00,
+            0.32334644281172E+00, 0.873281936020439E+00, -0.436653048526683E+00, 0.286596714529479E+00,
+            -0.131778331276228E+00, 0.676682064330275E-02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,h)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+#define REG3A_VPH_COUNT 32
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,h) in subregion 3a.
+////////////////////////////////////////////////////////
+const int I_3a_vph[REG3A_VPH_COUNT] = {
+                                       -12, -12, -12, -12, -10, -10, -10, -8, -8, -6, -6, -6, -4, -4, -3, -2, -2, -1, -1, -1,
+                                       -1, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 8
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation v(p,h) in subregion 3a.
+////////////////////////////////////////////////////////
+const int J_3a_vph[REG3A_VPH_COUNT] = {
+                                       6, 8, 12, 18, 4, 7, 10, 5, 12, 3, 4, 22, 2, 3, 7, 3, 16, 0, 1, 2,
+                                       3, 0, 1, 0, 1, 2, 0, 2, 0, 2, 2, 2
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,h)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+const double n_3a_vph[REG3A_VPH_COUNT] = {
+            0.529944062966028E-02, -0.170099690234461E+00, 0.111323814312927E+02,
+            -0.217898123145125E+04, -0.506061827980875E-03, 0.556495239685324E+00, -0.943672726094016E+01,
+            -0.297856807561527E+00, 0.939353943717186E+02, 0.192944939465981E-01, 0.421740664704763E+00,
+            -0.36891412628233E+07, -0.737566847600639E-02, -0.354753242424366E+00, -0.199768169338727E+01,
+            0.115456297059049E+01, 0.56836687581596E+04, 0.808169540124668E-02, 0.172416341519307E+00,
+            0.104270175292927E+01, -0.297691372792847E+00, 0.560394465163593E+00, 0.275234661176914E+00,
+            -0.148347894866012E+00, -0.651142513478515E-01, -0.292468715386302E+01, 0.664876096952665E-01,
+            0.352335014263844E+01, -0.146340792313332E-01, -0.224503486668184E+01, 0.110533464706142E+01,
+            -0.408757344495612E-01
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation v(p,h)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+#define REG3B_VPH_COUNT 30
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation v(p,h) in subregion 3b.
+////////////////////////////////////////////////////////
+const int I_3b_vph[REG3B_VPH_COUNT] = {
+                                       -12, -12, -8, -8, -8, -8, -8, -8, -6, -6, -6, -6, -6, -6, -4, -4, -4, -3, -3, -2,
+                                       -2, -1, -1, -1, -1, 0, 1, 1, 2, 2
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation v(p,h) in subregion 3b.
+////////////////////////////////////////////////////////
+const int J_3b_vph[REG3B_VPH_COUNT] = {
+                                       0, 1, 0, 1, 3, 6, 7, 8, 0, 1, 2, 5, 6, 10, 3, 6, 10, 0, 2, 1,
+                                       2, 0, 1, 4, 5, 0, 0, 1, 2, 6
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation v(p,h)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+const double n_3b_vph[REG3B_VPH_COUNT] = {
+            -0.225196934336318E-08, 0.140674363313486E-07, 0.23378408528056E-05,
+            -0.331833715229001E-04, 0.107956778514318E-02, -0.271382067378863E+00, 0.107202262490333E+01,
+            -0.853821329075382E+00, -0.215214194340526E-04, 0.76965608822273E-03, -0.431136580433864E-02,
+            0.453342167309331E+00, -0.507749535873652E+00, -0.100475154528389E+03, -0.219201924648793E+00,
+            -0.321087965668917E+01, 0.607567815637771E+03, 0.557686450685932E-03, 0.18749904002955E+00,
+            0.905368030448107E-02, 0.285417173048685E+00, 0.329924030996098E-01, 0.239897419685483E+00,
+            0.482754995951394E+01, -0.118035753702231E+02, 0.169490044091791E+00, -0.179967222507787E-01,
+            0.371810116332674E-01, -0.536288335065096E-01, 0.16069710109252E+01
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific enthalpy in IAPWS Region 3
+///  using the IAPWS backward equations
+///
+/// The backward equations agree with the forward (Helmholtz) equation to within 25 mK.
+///
+/// \param[in] p  pressure
+/// \param[in] h  specific enthalpy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double backward_t_ph_3(double p, double h)
+{
+	double pi = p / 100;
+	if (h <= b3ab_h_p(p))
+		return 760 * power_series(I_3a_tph, J_3a_tph, n_3a_tph, REG3A_TPH_COUNT, pi + 0.240, h/2300 - 0.615);
+	return 860 * power_series(I_3b_tph, J_3b_tph, n_3b_tph, REG3B_TPH_COUNT, pi + 0.298, h/2800 - 0.720);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific volume as a function of pressure and specific enthalpy in IAPWS Region 3
+///  using the IAPWS backward equations
+///
+/// The backward equations agree with the forward (Helmholtz) equation to within
+/// 0.01% of the specific volume.
+///
+/// \param[in] p  pressure
+/// \param[in] h  specific enthalpy
+///
+/// \return specific volume
+///////////////////////////////////////////////////////////////////////////////
+double backward_v_ph_3(double p, double h)
+{
+	double pi = p / 100;
+	if (h <= b3ab_h_p(p))
+		return 0.0028 * power_series(I_3a_vph, J_3a_vph, n_3a_vph, REG3A_VPH_COUNT, pi + 0.128, h/2100 - 0.727);
+	return 0.0088 * power_series(I_3b_vph, J_3b_vph, n_3b_vph, REG3B_VPH_COUNT, pi + 0.0661, h/2800 - 0.720);
+}
+
+//------------------------------------------------------------------------------
+// BACKWARD EQUATION T(p,s)
+
+////////////////////////////////////////////////////////
+///	\brief Specific entropy at the critical point, which divides subregions 3a
+///  and 3b of the backward equation T(p,s).
+////////////////////////////////////////////////////////
+const double s_3ab = 4.41202148223476;
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,s)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+#define REG3A_TPS_COUNT 33
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,s) in subregion 3a.
+////////////////////////////////////////////////////////
+const int I_3a_tps[REG3A_TPS_COUNT] = {
+                                      -12, -12, -10, -10, -10, -10, -8, -8, -8, -8, -6, -6, -6, -5, -5, -5, -4, -4, -4, -2,
+                                      -2, -1, -1, 0, 0, 0, 1, 2, 2, 3, 8, 8, 10
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation T(p,s) in subregion 3a.
+////////////////////////////////////////////////////////
+const int J_3a_tps[REG3A_TPS_COUNT] = {
+                                      28, 32, 4, 10, 12, 14, 5, 7, 8, 28, 2, 6, 32, 0, 14, 32, 6, 10, 36, 1,
+                                      4, 1, 6, 0, 1, 4, 0, 0, 3, 2, 0, 1, 2
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,s)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+const double n_3a_tps[REG3A_TPS_COUNT] = {
+            0.150042008263875E+10, -0.159397258480424E+12, 0.502181140217975E-03, -0.672057767855466E+02,
+            0.145058545404456E+04, -0.82388953488889E+04, -0.154852214233853E+00, 0.112305046746695E+02,
+            -0.297000213482822E+02, 0.438565132635495E+11, 0.137837838635464E-02, -0.297478527157462E+01,
+            0.971777947349413E+13, -0.571527767052398E-04, 0.28830794977842E+05, -0.744428289262703E+14,
+            0.128017324848921E+02, -0.368275545889071E+03, 0.664768904779177E+16, 0.44935925195888E-01,
+            -0.422897836099655E+01, -0.240614376434179E+00, -0.474341365254924E+01, 0.72409399912611E+00,
+            0.923874349695897E+00, 0.399043655281015E+01, 0.384066651868009E-01, -0.359344365571848E-02,
+            -0.735196448821653E+00, 0.188367048396131E+00, 0.141064266818704E-03, -0.257418501496337E-02,
+            0.123220024851555E-02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,s)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+#define REG3B_TPS_COUNT 28
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,s) in subregion 3b.
+////////////////////////////////////////////////////////
+const int I_3b_tps[REG3B_TPS_COUNT] = {
+                                      -12, -12, -12, -12, -8, -8, -8, -6, -6, -6, -5, -5, -5, -5, -5, -4, -3, -3, -2, 0,
+                                      2, 3, 4, 5, 6, 8, 12, 14
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation T(p,s) in subregion 3b.
+////////////////////////////////////////////////////////
+const int J_3b_tps[REG3B_TPS_COUNT] = {
+                                      1, 3, 4, 7, 0, 1, 3, 0, 2, 4, 0, 1, 2, 4, 6, 12, 1, 6, 2, 0,
+                                      1, 1, 0, 24, 0, 3, 1, 2
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,s)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+const double n_3b_tps[REG3B_TPS_COUNT] = {
+            0.52711170160166E+00, -0.401317830052742E+02, 0.153020073134484E+03, -0.224799398218827E+04,
+            -0.193993484669048E+00, -0.140467557893768E+01, 0.426799878114024E+02, 0.752810643416743E+00,
+            0.226657238616417E+02, -0.622873556909932E+03, -0.660823667935396E+00, 0.841267087271658E+00,
+            -0.253717501764397E+02, 0.485708963532948E+03, 0.880531517490555E+03, 0.265015592794626E+07,
+            -0.359287150025783E+00, -0.656991567673753E+03, 0.241768149185367E+01, 0.856873461222588E+00,
+            0.655143675313458E+00, -0.213535213206406E+00, 0.562974957606348E-02, -0.316955725450471E+15,
+            -0.699997000152457E-03, 0.119845803210767E-01, 0.193848122022095E-04, -0.215095749182309E-04
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy in IAPWS Region 3
+///  using the IAPWS backward equations
+///
+/// The backward equations agree with the forward (Helmholtz) equation to within 25 mK.
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double backward_t_ps_3(double p, double s)
+{
+	double pi = p / 100;
+	if (s <= s_3ab)
+		return 760 * power_series(I_3a_tps, J_3a_tps, n_3a_tps, REG3A_TPS_COUNT, pi + 0.240, s/4.4 - 0.703);
+	return 860 * power_series(I_3b_tps, J_3b_tps, n_3b_tps, REG3B_TPS_COUNT, pi + 0.760, s/5.3 - 0.818);
+}
+
+//------------------------------------------------------------------------------
+// BACKWARD EQUATIONS p(h,s)
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation p(h,s)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+#define REG3A_PHS_COUNT 33
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation p(h,s) in subregion 3a (IAPWS SR4-04).
+////////////////////////////////////////////////////////
+const int I_3a_phs[REG3A_PHS_COUNT] = {
+                                      0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 6, 7,
+                                      8, 10, 10, 14, 18, 20, 22, 22, 24, 28, 28, 32, 32
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation p(h,s) in subregion 3a.
+////////////////////////////////////////////////////////
+const int J_3a_phs[REG3A_PHS_COUNT] = {
+                                      0, 1, 5, 0, 3, 4, 8, 14, 6, 16, 0, 2, 3, 0, 1, 4, 5, 28, 28, 24,
+                                      1, 32, 36, 22, 28, 36, 16, 28, 36, 16, 36, 10, 28
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation p(h,s)
+///  in subregion 3a.
+////////////////////////////////////////////////////////
+const double n_3a_phs[REG3A_PHS_COUNT] = {
+            0.770889828326934E+01, -0.260835009128688E+02, 0.267416218930389E+03, 0.172221089496844E+02,
+            -0.293542332145970E+03, 0.614135601882478E+03, -0.610562757725674E+05, -0.651272251118219E+08,
+            0.735919313521937E+05, -0.116646505914191E+11, 0.355267086434461E+02, -0.596144543825955E+03,
+            -0.475842430145708E+03, 0.696781965359503E+02, 0.335674250377312E+03, 0.250526809130882E+05,
+            0.146997380630766E+06, 0.538069315091534E+20, 0.143619827291346E+22, 0.364985866165994E+20,
+            -0.254741561156775E+04, 0.240120197096563E+28, -0.393847464679496E+30, 0.147073407024852E+25,
+            -0.426391250432059E+32, 0.194509340621077E+39, 0.666212132114896E+24, 0.706777016552858E+34,
+            0.175563621975576E+42, 0.108408607429124E+29, 0.730872705175151E+44, 0.159145847398870E+25,
+            0.377121605943324E+41
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation p(h,s)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+#define REG3B_PHS_COUNT 35
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation p(h,s) in subregion 3b.
+////////////////////////////////////////////////////////
+const int I_3b_phs[REG3B_PHS_COUNT] = {
+                                      -12, -12, -12, -12, -12, -10, -10, -10, -10, -8, -8, -6, -6, -6, -6, -5, -4, -4, -4, -3,
+                                      -3, -3, -3, -2, -2, -1, 0, 2, 2, 5, 6, 8, 10, 14, 14
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation p(h,s) in subregion 3b.
+////////////////////////////////////////////////////////
+const int J_3b_phs[REG3B_PHS_COUNT] = {
+                                      2, 10, 12, 14, 20, 2, 10, 14, 18, 2, 8, 2, 6, 7, 8, 10, 4, 5, 8, 1,
+                                      3, 5, 6, 0, 1, 0, 3, 0, 1, 0, 1, 1, 1, 3, 7
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation p(h,s)
+///  in subregion 3b.
+////////////////////////////////////////////////////////
+const double n_3b_phs[REG3B_PHS_COUNT] = {
+            0.125244360717979E-12, -0.126599322553713E-01, 0.506878030140626E+01, 0.317847171154202E+02,
+            -0.391041161399932E+06, -0.975733406392044E-10, -0.186312419488279E+02, 0.510973543414101E+03,
+            0.373847005822362E+06, 0.299804024666572E-07, 0.200544393820342E+02, -0.498030487662829E-05,
+            -0.102301806360030E+02, 0.552819126990325E+02, -0.206211367510878E+03, -0.794012232324823E+04,
+            0.782248472028153E+01, -0.586544326902468E+02, 0.355073647696481E+04, -0.115303107290162E-03,
+            -0.175092403171802E+01, 0.257981687748160E+03, -0.727048374179467E+03, 0.121644822609198E-03,
+            0.393137871762692E-01, 0.704181005909296E-02, -0.829108200698110E+02, -0.265178818131250E+00,
+            0.137531682453991E+02, -0.522394090753046E+02, 0.240556298941048E+04, -0.227361631268929E+05,
+            0.890746343932567E+05, -0.239234565822486E+08, 0.568795808129714E+10
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates pressure as a function of specific enthalpy and specific entropy
+///  in IAPWS Region 3 using the IAPWS supplementary backward equations
+///
+/// As for T(p,s), subregion 3a lies at or below the critical entropy and subregion 3b
+/// above it.
+///
+/// \param[in] h  specific enthalpy
+/// \param[in] s  specific entropy
+///
+/// \return pressure
+///////////////////////////////////////////////////////////////////////////////
+double backward_p_hs_3(double h, double s)
+{
+	if (s <= s_3ab)
+		return 99 * power_series(I_3a_phs, J_3a_phs, n_3a_phs, REG3A_PHS_COUNT, h/2300 - 1.01, s/4.4 - 0.75);
+	return 16.6 / power_series(I_3b_phs, J_3b_phs, n_3b_phs, REG3B_PHS_COUNT, h/2800 - 0.681, s/5.3 - 0.792);
+}
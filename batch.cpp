@@ -0,0 +1,501 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file batch.cpp
+///	\brief Evaluation of the steam table functions over arrays of statepoints.
+///
+/// An array can be split across worker threads.  The statepoints are handed out in
+/// chunks, so that threads that draw slow statepoints (e.g. in Region 3) do not hold
+/// up the others, and each worker uses the solver options and property table of the
+/// calling thread.  The steam table functions keep no state other than those
+/// thread-local options and the tables built once per process, so the workers need
+/// no locking.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+ 
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+ 
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "iapws.h"
+#include "utilities.h"
+#include <algorithm>      // std::min
+#include <cmath>          // std::isnan
+#include <atomic>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+////////////////////////////////////////////////////////
+///	\brief Number of statepoints handed to a worker thread at a time.
+////////////////////////////////////////////////////////
+const long batch_chunk = 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a function over every chunk of an array, across worker threads
+///
+/// The calling thread works alongside the workers.  An array of fewer than two chunks,
+/// or a request for one thread, is evaluated in the calling thread alone.
+///
+/// \param[in] count number of statepoints
+/// \param[in] threads number of threads, or 0 for one per processor
+/// \param[in] evaluate function called with the first index of a chunk and one past
+///  its last index, returning the number of statepoints that failed
+///
+/// \return number of statepoints that failed
+///////////////////////////////////////////////////////////////////////////////
+template <class Evaluate>
+static long parallel_chunks(long count, int threads, const Evaluate &evaluate)
+{
+	if (threads <= 0)
+		threads = (int) std::max(1u, std::thread::hardware_concurrency());
+	long chunks = (count + batch_chunk - 1) / batch_chunk;
+	if ((threads == 1) || (chunks < 2))
+		return evaluate(0L, count);
+	threads = (int) std::min<long>(threads, chunks);
+
+	const Settings settings = GET_SETTINGS();
+	const TablePT *table = active_table_pt();
+	std::atomic<long> next(0);
+	std::atomic<long> failures(0);
+	auto work = [&]() {
+		long failed = 0;
+		for (;;) {
+			long begin = next.fetch_add(batch_chunk);
+			if (begin >= count)
+				break;
+			failed += evaluate(begin, std::min(begin + batch_chunk, count));
+		}
+		failures += failed;
+	};
+	auto worker = [&]() {
+		SET_SETTINGS(settings);
+		USE_TABLE_PT(table);
+		work();
+	};
+	std::vector<std::thread> workers;
+	for (int k=1; k<threads; k++) {
+		try {
+			workers.push_back(std::thread(worker));
+		}
+		catch(const std::system_error &) {
+			// carry on with the threads already started
+			break;
+		}
+	}
+	work();
+	for (size_t k=0; k<workers.size(); k++)
+		workers[k].join();
+	return failures;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a function at every index of an array, across worker threads
+///
+/// \param[in] count number of statepoints
+/// \param[in] threads number of threads, or 0 for one per processor
+/// \param[in] evaluate function called with the index of each statepoint, returning
+///  false if the statepoint failed
+///
+/// \return number of statepoints that failed
+///////////////////////////////////////////////////////////////////////////////
+template <class Evaluate>
+static long parallel_for(long count, int threads, const Evaluate &evaluate)
+{
+	return parallel_chunks(count, threads, [&](long begin, long end) {
+		long failed = 0;
+		for (long i=begin; i<end; i++) {
+			if (!evaluate(i))
+				failed++;
+		}
+		return failed;
+	});
+}
+
+////////////////////////////////////////////////////////
+///	\brief Number of statepoints gathered for the region kernels at a time.
+////////////////////////////////////////////////////////
+const long kernel_block = 256;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief statepoints of one region gathered for its vectorized kernel
+///////////////////////////////////////////////////////////////////////////////
+struct KernelBlock {
+	double p[kernel_block];          ///< pressures (MPa)
+	double t[kernel_block];          ///< temperatures (K)
+	long index[kernel_block];        ///< indices of the statepoints in the arrays
+	StatePT state[kernel_block];     ///< thermodynamic properties
+	long count;                      ///< number of statepoints gathered
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a range of (p,T) statepoints, passing those in Regions 1 and 2
+///  to the vectorized region kernels
+///
+/// The statepoints in Region 1 and in Region 2 are gathered and their thermodynamic
+/// properties are calculated together by state_pt_1_batch and state_pt_2_batch.
+/// All other statepoints, including those that are out of bounds, are left to the
+/// function for a single statepoint.
+///
+/// \param[in] x array of pressures
+/// \param[in] y array of temperatures
+/// \param[in] begin first index of the range
+/// \param[in] end one past the last index of the range
+/// \param[in] input_units input units of measure
+/// \param[in] store function called with the index, region, temperature (K), and
+///  thermodynamic properties (SI units) of each statepoint in Region 1 or 2
+/// \param[in] evaluate function called with the index of every other statepoint,
+///  returning false if the statepoint failed
+///
+/// \return number of statepoints that failed
+///////////////////////////////////////////////////////////////////////////////
+template <class Store, class Evaluate>
+static long kernel_range(const double x[], const double y[], long begin, long end, Units input_units, const Store &store, const Evaluate &evaluate)
+{
+	long failed = 0;
+	std::unique_ptr<KernelBlock[]> blocks(new KernelBlock[2]);
+	for (long block=begin; block<end; block+=kernel_block) {
+		long last = std::min(block + kernel_block, end);
+		blocks[0].count = 0;
+		blocks[1].count = 0;
+		for (long i=block; i<last; i++) {
+			double pressure = x[i];
+			double temperature = y[i];
+			if (input_units == ENGLISH) {
+				pressure = convert_pressure_english_to_si(pressure);
+				temperature = convert_temp_english_to_kelvin(temperature);
+			}
+			else {
+				temperature = convert_temp_centigrade_to_kelvin(temperature);
+			}
+			int region = 0;
+			if ((region_pt_status(pressure, temperature, region) == STATUS_OK) && ((region == 1) || (region == 2))) {
+				KernelBlock &gathered = blocks[region - 1];
+				gathered.p[gathered.count] = pressure;
+				gathered.t[gathered.count] = temperature;
+				gathered.index[gathered.count] = i;
+				gathered.count++;
+			}
+			else if (!evaluate(i)) {
+				failed++;
+			}
+		}
+		state_pt_1_batch(blocks[0].p, blocks[0].t, blocks[0].state, blocks[0].count);
+		state_pt_2_batch(blocks[1].p, blocks[1].t, blocks[1].state, blocks[1].count);
+		for (int region=1; region<=2; region++) {
+			const KernelBlock &gathered = blocks[region - 1];
+			for (long k=0; k<gathered.count; k++)
+				store(gathered.index[k], region, gathered.t[k], gathered.state[k]);
+		}
+	}
+	return failed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief a (p,T) function whose value in Regions 1 and 2 is one of the
+///  thermodynamic properties of StatePT
+///////////////////////////////////////////////////////////////////////////////
+struct KernelProperty {
+	StatusFunction2 f;                ///< status version of the steam table function
+	double StatePT::*property;        ///< property of the state
+	double (*to_english)(double);     ///< conversion of the property from SI to English units
+};
+
+////////////////////////////////////////////////////////
+///	\brief Functions that BATCH2 can evaluate with the vectorized region kernels.
+///
+/// W_PT is not among them because w_pt_1 and w_pt_2 round differently to
+/// state_pt_1 and state_pt_2.
+////////////////////////////////////////////////////////
+const KernelProperty kernel_properties[] = {
+	{H_PT_STATUS, &StatePT::h, convert_enthalpy_si_to_english},
+	{V_PT_STATUS, &StatePT::v, convert_spvolume_si_to_english},
+	{S_PT_STATUS, &StatePT::s, convert_entropy_si_to_english},
+	{CP_PT_STATUS, &StatePT::cp, convert_cp_si_to_english}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds a function among those that BATCH2 evaluates with the vectorized
+///  region kernels
+///
+/// Property tables take precedence over the equations, so none are used while a
+/// table is active.
+///
+/// \param[in] f status version of the steam table function
+///
+/// \return property of the function, or 0 if there is none
+///////////////////////////////////////////////////////////////////////////////
+static const KernelProperty *kernel_property(StatusFunction2 f)
+{
+	if (active_table_pt() != 0)
+		return 0;
+	for (size_t k=0; k<sizeof(kernel_properties)/sizeof(kernel_properties[0]); k++) {
+		if (kernel_properties[k].f == f)
+			return &kernel_properties[k];
+	}
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief checks whether BATCH2 can evaluate T_PH with the lock-step Brent searches
+///  of t_ph_1_batch and t_ph_2_batch
+///
+/// Those follow the default path of t_ph_1 and t_ph_2, which invert the forward
+/// equations, so they are not used when the backward equations or the (p,h) table
+/// are selected.
+///
+/// \param[in] f status version of the steam table function
+///
+/// \return true if f is T_PH_STATUS and the default options are in effect
+///////////////////////////////////////////////////////////////////////////////
+static bool lock_step_t_ph(StatusFunction2 f)
+{
+	const Settings &settings = active_settings();
+	return (f == T_PH_STATUS) && (settings.backward_ph == BACKWARD_OFF) && (settings.ph == PH_EXACT);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates temperature over a range of (p,h) statepoints, solving those in
+///  Regions 1 and 2 in lock step
+///
+/// The statepoints in Region 1 and in Region 2 are gathered and solved together by
+/// t_ph_1_batch and t_ph_2_batch, which evaluate the forward equation for all of the
+/// unconverged statepoints with one call to the vectorized region kernel per
+/// iteration.  All other statepoints, and any whose search fails, are left to the
+/// function for a single statepoint.
+///
+/// \param[in] x array of pressures
+/// \param[in] y array of specific enthalpies
+/// \param[out] result array that receives the temperatures
+/// \param[out] status array that receives the status of each statepoint, or 0
+/// \param[in] begin first index of the range
+/// \param[in] end one past the last index of the range
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[in] evaluate function called with the index of every other statepoint,
+///  returning false if the statepoint failed
+///
+/// \return number of statepoints that failed
+///////////////////////////////////////////////////////////////////////////////
+template <class Evaluate>
+static long t_ph_range(const double x[], const double y[], double result[], Status status[], long begin, long end, Units input_units, Units output_units, const Evaluate &evaluate)
+{
+	long failed = 0;
+	std::vector<double> p[2];
+	std::vector<double> h[2];
+	std::vector<long> index[2];
+	std::vector<double> t;
+	for (long i=begin; i<end; i++) {
+		double pressure = x[i];
+		double enthalpy = y[i];
+		if (input_units == ENGLISH) {
+			pressure = convert_pressure_english_to_si(pressure);
+			enthalpy = convert_enthalpy_english_to_si(enthalpy);
+		}
+		int region = 0;
+		if ((region_ph_status(pressure, enthalpy, region) == STATUS_OK) && ((region == 1) || (region == 2))) {
+			p[region - 1].push_back(pressure);
+			h[region - 1].push_back(enthalpy);
+			index[region - 1].push_back(i);
+		}
+		else if (!evaluate(i)) {
+			failed++;
+		}
+	}
+	for (int region=1; region<=2; region++) {
+		long count = (long) index[region - 1].size();
+		t.resize(count);
+		if (region == 1)
+			t_ph_1_batch(p[0].data(), h[0].data(), t.data(), count);
+		else
+			t_ph_2_batch(p[1].data(), h[1].data(), t.data(), count);
+		for (long k=0; k<count; k++) {
+			long i = index[region - 1][k];
+			if (std::isnan(t[k])) {
+				// no root in the bracket, so report it as the scalar function does
+				RECORD_BRANCH(BRANCH_BATCH_FALLBACK);
+				if (!evaluate(i))
+					failed++;
+				continue;
+			}
+			if (output_units == ENGLISH)
+				result[i] = convert_temp_kelvin_to_english(t[k]);
+			else
+				result[i] = convert_temp_kelvin_to_centigrade(t[k]);
+			if (status != 0)
+				status[i] = STATUS_OK;
+		}
+	}
+	return failed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief counts the statepoints of an array call that failed, by message, for the
+///  call metrics
+///
+/// \param[in,out] timer timer of the array call
+/// \param[in] function steam table function evaluated
+/// \param[in] status array of the status of each statepoint, or 0
+/// \param[in] count number of statepoints
+/// \param[in] failures number of statepoints that failed
+///////////////////////////////////////////////////////////////////////////////
+static void count_errors(MetricTimer &timer, SteamFunction function, const Status status[], long count, long failures)
+{
+	if ((failures == 0) || !timer.active())
+		return;
+	const char *name = FUNCTION_NAME(function);
+	if (status == 0) {
+		timer.error(status_message(STATUS_FAILED, name), failures);
+		return;
+	}
+	unsigned long long counts[STATUS_COUNT] = {};
+	for (long i=0; i<count; i++)
+		counts[status[i]]++;
+	for (int s=STATUS_PRESSURE; s<STATUS_COUNT; s++) {
+		if (counts[s] != 0)
+			timer.error(status_message((Status) s, name), counts[s]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a function of one property over an array of statepoints
+///
+/// Statepoints where the function fails are set to NaN and do not stop the others.
+///
+/// \param[in] f status version of the steam table function to evaluate (e.g. P_T_STATUS)
+/// \param[in] x array of input values
+/// \param[out] result array that receives the function values
+/// \param[out] status array that receives the status of each statepoint, or 0
+/// \param[in] count number of elements in the x, result, and status arrays
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[in] threads number of threads, or 0 for one per processor
+///
+/// \return number of statepoints that failed
+///////////////////////////////////////////////////////////////////////////////
+long BATCH1(StatusFunction1 f, const double x[], double result[], Status status[], long count, Units input_units, Units output_units, int threads)
+{
+	SteamFunction function = status_function(f);
+	MetricTimer timer(function, true, count);
+	long failures = parallel_for(count, threads, [&](long i) {
+		Status s = f(x[i], input_units, output_units, &result[i]);
+		if (status != 0)
+			status[i] = s;
+		return s == STATUS_OK;
+	});
+	count_errors(timer, function, status, count, failures);
+	return failures;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a function of two properties over arrays of statepoints
+///
+/// Statepoints where the function fails are set to NaN and do not stop the others.
+/// When no property table is active, the Region 1 and Region 2 statepoints of H_PT,
+/// V_PT, S_PT and CP_PT are evaluated several at a time by the vectorized region kernels,
+/// and those of T_PH are solved in lock step (see t_ph_range).
+///
+/// \param[in] f status version of the steam table function to evaluate (e.g. H_PT_STATUS)
+/// \param[in] x array of values for the first function argument
+/// \param[in] y array of values for the second function argument
+/// \param[out] result array that receives the function values
+/// \param[out] status array that receives the status of each statepoint, or 0
+/// \param[in] count number of elements in the x, y, result, and status arrays
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[in] threads number of threads, or 0 for one per processor
+///
+/// \return number of statepoints that failed
+///////////////////////////////////////////////////////////////////////////////
+long BATCH2(StatusFunction2 f, const double x[], const double y[], double result[], Status status[], long count, Units input_units, Units output_units, int threads)
+{
+	SteamFunction function = status_function(f);
+	MetricTimer timer(function, true, count);
+	auto evaluate = [&](long i) {
+		Status s = f(x[i], y[i], input_units, output_units, &result[i]);
+		if (status != 0)
+			status[i] = s;
+		return s == STATUS_OK;
+	};
+	long failures;
+	const KernelProperty *kernel = kernel_property(f);
+	if (lock_step_t_ph(f)) {
+		failures = parallel_chunks(count, threads, [&](long begin, long end) {
+			return t_ph_range(x, y, result, status, begin, end, input_units, output_units, evaluate);
+		});
+	}
+	else if (kernel == 0)
+		failures = parallel_for(count, threads, evaluate);
+	else {
+		auto store = [&](long i, int, double, const StatePT &state) {
+			double value = state.*(kernel->property);
+			result[i] = (output_units == ENGLISH) ? kernel->to_english(value) : value;
+			if (status != 0)
+				status[i] = STATUS_OK;
+		};
+		failures = parallel_chunks(count, threads, [&](long begin, long end) {
+			return kernel_range(x, y, begin, end, input_units, store, evaluate);
+		});
+	}
+	count_errors(timer, function, status, count, failures);
+	return failures;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates all of the thermodynamic and transport properties over arrays
+///  of pressure and temperature
+///
+/// Statepoints that are out of bounds are set to NaN and do not stop the others.
+/// The Region 1 and Region 2 statepoints are evaluated several at a time by the
+/// vectorized region kernels.
+///
+/// \param[in] p array of pressures
+/// \param[in] t array of temperatures
+/// \param[out] result array that receives the properties
+/// \param[out] status array that receives the status of each statepoint, or 0
+/// \param[in] count number of elements in the p, t, result, and status arrays
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[in] threads number of threads, or 0 for one per processor
+///
+/// \return number of statepoints that failed
+///////////////////////////////////////////////////////////////////////////////
+long STATE_PT_BATCH(const double p[], const double t[], StatePT result[], Status status[], long count, Units input_units, Units output_units, int threads)
+{
+	MetricTimer timer(FUNCTION_STATE_PT, true, count);
+	auto evaluate = [&](long i) {
+		Status s = STATE_PT_STATUS(p[i], t[i], input_units, output_units, &result[i]);
+		if (status != 0)
+			status[i] = s;
+		return s == STATUS_OK;
+	};
+	auto store = [&](long i, int region, double temperature, const StatePT &state) {
+		result[i] = state;
+		complete_state_pt(region, temperature, output_units, result[i]);
+		if (status != 0)
+			status[i] = STATUS_OK;
+	};
+	long failures = parallel_chunks(count, threads, [&](long begin, long end) {
+		return kernel_range(p, t, begin, end, input_units, store, evaluate);
+	});
+	count_errors(timer, FUNCTION_STATE_PT, status, count, failures);
+	return failures;
+}
@@ -0,0 +1,515 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file benchmark.cpp
+///
+///	\brief times the steam table functions and the region equations
+///
+///	Every public function of wat.h and every region function of iapws.h is
+///	timed over fixed grids of statepoints, one grid per region, plus stress
+///	sets near the critical point, the saturation line, and the region
+///	boundaries.  The grids are the same on every run, so the time per
+///	iteration (one call) can be compared between releases; run with
+///	--benchmark_out=FILE --benchmark_out_format=json to record it.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 1995-2017 Charles Alan Ford
+
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <deque>
+#include <string>
+#include <vector>
+#include "../iapws.h"
+
+/////////////////////////////////////////////////////////////////////////
+/// statepoints of a benchmark, as pairs (x[i], y[i]) of two properties in
+/// the internal units (MPa, degK, kJ/kg), or values x[i] of one property
+/////////////////////////////////////////////////////////////////////////
+struct Grid {
+	std::vector<double> x;
+	std::vector<double> y;
+};
+
+/// grids referred to by the registered benchmarks, which must outlive them
+static std::deque<Grid> grids;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the i-th of n points spaced evenly from low to high
+///////////////////////////////////////////////////////////////////////////////
+static double linear(double low, double high, int i, int n)
+{
+	return low + (high - low)*i/(n - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the i-th of n points spaced evenly in logarithm from low to high
+///////////////////////////////////////////////////////////////////////////////
+static double logarithmic(double low, double high, int i, int n)
+{
+	return low*pow(high/low, double(i)/(n - 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief builds a rectangular (p,T) grid, keeping the points in one region
+///
+/// \param[in] region IAPWS region of the points to keep, or 0 for any
+/// \param[in] p_low lowest pressure in MPa
+/// \param[in] p_high highest pressure in MPa
+/// \param[in] t_low lowest temperature in degK
+/// \param[in] t_high highest temperature in degK
+/// \param[in] n points along each side
+/// \param[in] spacing distribution of the pressures
+///
+/// \return the grid
+///////////////////////////////////////////////////////////////////////////////
+static Grid grid_pt(int region, double p_low, double p_high, double t_low, double t_high, int n,
+	double (*spacing)(double, double, int, int) = linear)
+{
+	Grid grid;
+	for (int i = 0; i < n; i++) {
+		for (int j = 0; j < n; j++) {
+			double p = spacing(p_low, p_high, i, n);
+			double t = linear(t_low, t_high, j, n);
+			int found = 0;
+			if (region_pt_status(p, t, found) != STATUS_OK || (region != 0 && found != region))
+				continue;
+			grid.x.push_back(p);
+			grid.y.push_back(t);
+		}
+	}
+	return grid;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief builds (p,T) points straddling a boundary curve p(T)
+///
+/// \param[in] boundary pressure on the boundary in MPa as a function of temperature in degK
+/// \param[in] t_low lowest temperature in degK
+/// \param[in] t_high highest temperature in degK
+/// \param[in] offset relative distance of the points from the boundary
+/// \param[in] n points along the boundary
+///
+/// \return the grid, with one point on each side of the boundary per temperature
+///////////////////////////////////////////////////////////////////////////////
+static Grid grid_boundary(double (*boundary)(double), double t_low, double t_high, double offset, int n)
+{
+	Grid grid;
+	for (int j = 0; j < n; j++) {
+		double t = linear(t_low, t_high, j, n);
+		double p = boundary(t);
+		grid.x.push_back(p*(1 - offset));
+		grid.y.push_back(t);
+		grid.x.push_back(p*(1 + offset));
+		grid.y.push_back(t);
+	}
+	return grid;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief converts a (p,T) grid into the (p,h) grid of the same statepoints
+///////////////////////////////////////////////////////////////////////////////
+static Grid grid_ph(const Grid &pt)
+{
+	Grid grid;
+	for (size_t i = 0; i < pt.x.size(); i++) {
+		double h = 0;
+		if (H_PT_STATUS(pt.x[i], pt.y[i] - 273.15, SI, SI, &h) != STATUS_OK)
+			continue;
+		grid.x.push_back(pt.x[i]);
+		grid.y.push_back(h);
+	}
+	return grid;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief builds a (p,h) grid across the two-phase region, by quality
+///
+/// \param[in] p_low lowest pressure in MPa
+/// \param[in] p_high highest pressure in MPa
+/// \param[in] n points along each side
+///
+/// \return the grid
+///////////////////////////////////////////////////////////////////////////////
+static Grid grid_two_phase(double p_low, double p_high, int n)
+{
+	Grid grid;
+	for (int i = 0; i < n; i++) {
+		double p = logarithmic(p_low, p_high, i, n);
+		double hf = HF_P(p, SI, SI);
+		double hg = HG_P(p, SI, SI);
+		for (int j = 0; j < n; j++) {
+			grid.x.push_back(p);
+			grid.y.push_back(hf + (hg - hf)*(j + 0.5)/n);
+		}
+	}
+	return grid;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief builds a grid of one property
+///
+/// \param[in] low lowest value
+/// \param[in] high highest value
+/// \param[in] n number of points
+/// \param[in] spacing distribution of the points
+///
+/// \return the grid
+///////////////////////////////////////////////////////////////////////////////
+static Grid grid_1(double low, double high, int n, double (*spacing)(double, double, int, int) = linear)
+{
+	Grid grid;
+	for (int i = 0; i < n; i++)
+		grid.x.push_back(spacing(low, high, i, n));
+	return grid;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief keeps the points of a (p,T) or (p,h) grid at which a public function succeeds,
+///  converting temperatures to degC for the SI units of wat.h
+///
+/// \param[in] grid grid in the internal units
+/// \param[in] f status version of the public function
+/// \param[in] temperature true if the second property is a temperature
+///
+/// \return the grid in the units of the public function
+///////////////////////////////////////////////////////////////////////////////
+static const Grid &public_grid(const Grid &grid, StatusFunction2 f, bool temperature)
+{
+	Grid valid;
+	for (size_t i = 0; i < grid.x.size(); i++) {
+		double y = temperature ? grid.y[i] - 273.15 : grid.y[i];
+		double value = 0;
+		if (f(grid.x[i], y, SI, SI, &value) != STATUS_OK)
+			continue;
+		valid.x.push_back(grid.x[i]);
+		valid.y.push_back(y);
+	}
+	grids.push_back(valid);
+	return grids.back();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief keeps the points of a grid of one property at which a public function succeeds
+///
+/// \param[in] grid grid in the internal units
+/// \param[in] f status version of the public function
+/// \param[in] temperature true if the property is a temperature
+///
+/// \return the grid in the units of the public function
+///////////////////////////////////////////////////////////////////////////////
+static const Grid &public_grid(const Grid &grid, StatusFunction1 f, bool temperature)
+{
+	Grid valid;
+	for (size_t i = 0; i < grid.x.size(); i++) {
+		double x = temperature ? grid.x[i] - 273.15 : grid.x[i];
+		double value = 0;
+		if (f(x, SI, SI, &value) != STATUS_OK)
+			continue;
+		valid.x.push_back(x);
+	}
+	grids.push_back(valid);
+	return grids.back();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief registers a benchmark that calls f once per iteration, cycling through the grid
+///
+/// \param[in] name benchmark name, function/grid
+/// \param[in] grid statepoints
+/// \param[in] f function of the two properties of the grid
+///////////////////////////////////////////////////////////////////////////////
+template <class Function>
+static void register_2(const std::string &name, const Grid &grid, Function f)
+{
+	if (grid.x.empty())
+		return;
+	benchmark::RegisterBenchmark(name.c_str(), [&grid, f](benchmark::State &state) {
+		const size_t count = grid.x.size();
+		size_t i = 0;
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(f(grid.x[i], grid.y[i]));
+			if (++i == count)
+				i = 0;
+		}
+		state.SetItemsProcessed(state.iterations());
+		state.counters["points"] = count;
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief registers a benchmark that calls f once per iteration, cycling through the grid
+///
+/// \param[in] name benchmark name, function/grid
+/// \param[in] grid values of the property
+/// \param[in] f function of the property of the grid
+///////////////////////////////////////////////////////////////////////////////
+template <class Function>
+static void register_1(const std::string &name, const Grid &grid, Function f)
+{
+	if (grid.x.empty())
+		return;
+	benchmark::RegisterBenchmark(name.c_str(), [&grid, f](benchmark::State &state) {
+		const size_t count = grid.x.size();
+		size_t i = 0;
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(f(grid.x[i]));
+			if (++i == count)
+				i = 0;
+		}
+		state.SetItemsProcessed(state.iterations());
+		state.counters["points"] = count;
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief registers a benchmark of a batch function over the whole grid per iteration
+///
+/// \param[in] name benchmark name, function/grid
+/// \param[in] grid statepoints in the units of the public functions
+/// \param[in] f status version of the function evaluated by BATCH2
+///////////////////////////////////////////////////////////////////////////////
+static void register_batch(const std::string &name, const Grid &grid, StatusFunction2 f)
+{
+	if (grid.x.empty())
+		return;
+	benchmark::RegisterBenchmark(name.c_str(), [&grid, f](benchmark::State &state) {
+		const long count = grid.x.size();
+		std::vector<double> result(count);
+		for (auto _ : state) {
+			BATCH2(f, grid.x.data(), grid.y.data(), result.data(), 0, count, SI, SI, 1);
+			benchmark::DoNotOptimize(result.data());
+		}
+		state.SetItemsProcessed(state.iterations()*count);
+		state.counters["points"] = count;
+	});
+}
+
+/////////////////////////////////////////////////////////////////////////
+/// a named (p,T) grid
+/////////////////////////////////////////////////////////////////////////
+struct NamedGrid {
+	const char *name;
+	const Grid *grid;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief registers the benchmarks of the region equations
+///
+/// \param[in] pt (p,T) grids of Regions 1, 2, 3, and 5, then the Region 3 points of the near-critical set
+/// \param[in] ph (p,h) grids of the same statepoints
+///////////////////////////////////////////////////////////////////////////////
+static void register_regions(const Grid *pt[], const Grid *ph[])
+{
+	const Grid &pt1 = *pt[0], &pt2 = *pt[1], &pt3 = *pt[2], &pt5 = *pt[3], &critical = *pt[4];
+	const Grid &ph1 = *ph[0], &ph2 = *ph[1], &ph3 = *ph[2], &ph5 = *ph[3], &ph_critical = *ph[4];
+
+	register_2("region1/gibbs_1", pt1, [](double p, double t) { Gibbs g; gibbs_1(p/16.53, 1386/t, g); return g.gamma; });
+	register_2("region1/h_pt_1", pt1, h_pt_1);
+	register_2("region1/v_pt_1", pt1, v_pt_1);
+	register_2("region1/s_pt_1", pt1, s_pt_1);
+	register_2("region1/cp_pt_1", pt1, cp_pt_1);
+	register_2("region1/w_pt_1", pt1, w_pt_1);
+	register_2("region1/t_ph_1", ph1, t_ph_1);
+	register_2("region1/v_ph_1", ph1, v_ph_1);
+	register_2("region1/s_ph_1", ph1, s_ph_1);
+	register_2("region1/backward_t_ph_1", ph1, backward_t_ph_1);
+
+	register_2("region2/gibbs_2", pt2, [](double p, double t) { Gibbs g0, gr; gibbs_2(p, 540/t, g0, gr); return gr.gamma; });
+	register_2("region2/h_pt_2", pt2, h_pt_2);
+	register_2("region2/v_pt_2", pt2, v_pt_2);
+	register_2("region2/s_pt_2", pt2, s_pt_2);
+	register_2("region2/cp_pt_2", pt2, cp_pt_2);
+	register_2("region2/w_pt_2", pt2, w_pt_2);
+	register_2("region2/t_ph_2", ph2, t_ph_2);
+	register_2("region2/v_ph_2", ph2, v_ph_2);
+	register_2("region2/s_ph_2", ph2, s_ph_2);
+	register_2("region2/backward_t_ph_2", ph2, backward_t_ph_2);
+
+	register_2("region3/d_pt_3", pt3, d_pt_3);
+	register_2("region3/backward_v_pt_3", pt3, backward_v_pt_3);
+	register_2("region3/t_ph_3", ph3, t_ph_3);
+	register_2("region3/d_ph_3", ph3, d_ph_3);
+	register_2("region3/s_ph_3", ph3, s_ph_3);
+	register_2("region3/backward_t_ph_3", ph3, backward_t_ph_3);
+	register_2("region3/backward_v_ph_3", ph3, backward_v_ph_3);
+	register_2("critical/d_pt_3", critical, d_pt_3);
+	register_2("critical/t_ph_3", ph_critical, t_ph_3);
+
+	register_2("region5/h_pt_5", pt5, h_pt_5);
+	register_2("region5/v_pt_5", pt5, v_pt_5);
+	register_2("region5/s_pt_5", pt5, s_pt_5);
+	register_2("region5/cp_pt_5", pt5, cp_pt_5);
+	register_2("region5/w_pt_5", pt5, w_pt_5);
+	register_2("region5/t_ph_5", ph5, t_ph_5);
+	register_2("region5/v_ph_5", ph5, v_ph_5);
+	register_2("region5/s_ph_5", ph5, s_ph_5);
+
+	register_2("region/region_pt", pt1, region_pt);
+	register_2("region/region_ph", ph2, region_ph);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief registers the benchmarks of the public functions of two properties
+///
+/// \param[in] pt named (p,T) grids
+/// \param[in] ph named (p,h) grids
+///////////////////////////////////////////////////////////////////////////////
+static void register_public(const std::vector<NamedGrid> &pt, const std::vector<NamedGrid> &ph)
+{
+	struct PublicPT {
+		const char *name;
+		double (*f)(double, double, Units, Units);
+		StatusFunction2 status;
+	};
+	const PublicPT functions_pt[] = {
+		{"H_PT", H_PT, H_PT_STATUS},
+		{"V_PT", V_PT, V_PT_STATUS},
+		{"S_PT", S_PT, S_PT_STATUS},
+		{"CP_PT", CP_PT, CP_PT_STATUS},
+		{"W_PT", W_PT, W_PT_STATUS},
+		{"VIS_PT", VIS_PT, VIS_PT_STATUS},
+		{"K_PT", K_PT, K_PT_STATUS}
+	};
+	for (const NamedGrid &grid : pt) {
+		for (const PublicPT &function : functions_pt) {
+			auto f = function.f;
+			register_2(std::string(function.name) + "/" + grid.name, public_grid(*grid.grid, function.status, true),
+				[f](double p, double t) { return f(p, t, SI, SI); });
+		}
+		register_2(std::string("STATE_PT/") + grid.name, public_grid(*grid.grid, H_PT_STATUS, true),
+			[](double p, double t) { return STATE_PT(p, t, SI, SI).h; });
+		register_batch(std::string("BATCH2_H_PT/") + grid.name, public_grid(*grid.grid, H_PT_STATUS, true), H_PT_STATUS);
+	}
+
+	const PublicPT functions_ph[] = {
+		{"T_PH", T_PH, T_PH_STATUS},
+		{"V_PH", V_PH, V_PH_STATUS},
+		{"S_PH", S_PH, S_PH_STATUS}
+	};
+	for (const NamedGrid &grid : ph) {
+		for (const PublicPT &function : functions_ph) {
+			auto f = function.f;
+			register_2(std::string(function.name) + "/" + grid.name, public_grid(*grid.grid, function.status, false),
+				[f](double p, double h) { return f(p, h, SI, SI); });
+		}
+		register_batch(std::string("BATCH2_T_PH/") + grid.name, public_grid(*grid.grid, T_PH_STATUS, false), T_PH_STATUS);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief registers the benchmarks of the saturation functions
+///
+/// \param[in] t saturation temperatures in degK
+/// \param[in] p saturation pressures in MPa
+///////////////////////////////////////////////////////////////////////////////
+static void register_saturation(const Grid &t, const Grid &p)
+{
+	struct PublicSat {
+		const char *name;
+		double (*f)(double, Units, Units);
+		StatusFunction1 status;
+	};
+	const PublicSat functions_t[] = {
+		{"P_T", P_T, P_T_STATUS},
+		{"HF_T", HF_T, HF_T_STATUS},
+		{"HG_T", HG_T, HG_T_STATUS},
+		{"SF_T", SF_T, SF_T_STATUS},
+		{"SG_T", SG_T, SG_T_STATUS},
+		{"VF_T", VF_T, VF_T_STATUS},
+		{"VG_T", VG_T, VG_T_STATUS}
+	};
+	const PublicSat functions_p[] = {
+		{"T_P", T_P, T_P_STATUS},
+		{"HF_P", HF_P, HF_P_STATUS},
+		{"HG_P", HG_P, HG_P_STATUS},
+		{"SF_P", SF_P, SF_P_STATUS},
+		{"SG_P", SG_P, SG_P_STATUS},
+		{"VF_P", VF_P, VF_P_STATUS},
+		{"VG_P", VG_P, VG_P_STATUS}
+	};
+	for (const PublicSat &function : functions_t) {
+		auto f = function.f;
+		register_1(std::string(function.name) + "/saturation", public_grid(t, function.status, true),
+			[f](double x) { return f(x, SI, SI); });
+	}
+	for (const PublicSat &function : functions_p) {
+		auto f = function.f;
+		register_1(std::string(function.name) + "/saturation", public_grid(p, function.status, false),
+			[f](double x) { return f(x, SI, SI); });
+	}
+	register_1("region4/PSAT_T", t, PSAT_T);
+	register_1("region4/TSAT_P", p, TSAT_P);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief adds a grid to the ones kept for the benchmarks
+///////////////////////////////////////////////////////////////////////////////
+static const Grid *keep(const Grid &grid)
+{
+	grids.push_back(grid);
+	return &grids.back();
+}
+
+int main(int argc, char **argv)
+{
+	// (p,T) grids: one per region, then the stress sets
+	const Grid *region1 = keep(grid_pt(1, 20, 100, 275, 620, 16));
+	const Grid *region2 = keep(grid_pt(2, 0.001, 15, 650, 1070, 16, logarithmic));
+	const Grid *region3 = keep(grid_pt(3, 25, 100, 630, 860, 16));
+	const Grid *region5 = keep(grid_pt(5, 0.5, 50, 1080, 2270, 16));
+	const Grid *critical = keep(grid_pt(0, 21.9, 22.3, 645, 649, 16));
+	const Grid *critical3 = keep(grid_pt(3, 21.9, 22.3, 645, 649, 16));
+	const Grid *b23 = keep(grid_boundary(b23_p_t, 623.15, 863.15, 1e-6, 32));
+	const Grid *saturation = keep(grid_boundary(PSAT_T, 275, 645, 1e-7, 32));
+
+	const Grid *ph1 = keep(grid_ph(*region1));
+	const Grid *ph2 = keep(grid_ph(*region2));
+	const Grid *ph3 = keep(grid_ph(*region3));
+	const Grid *ph5 = keep(grid_ph(*region5));
+	const Grid *ph_critical = keep(grid_ph(*critical));
+	const Grid *ph_critical3 = keep(grid_ph(*critical3));
+	const Grid *ph_b23 = keep(grid_ph(*b23));
+	const Grid *two_phase = keep(grid_two_phase(0.001, 21, 16));
+
+	const Grid *pt[] = {region1, region2, region3, region5, critical3};
+	const Grid *ph[] = {ph1, ph2, ph3, ph5, ph_critical3};
+	register_regions(pt, ph);
+
+	register_public({
+		{"region1", region1}, {"region2", region2}, {"region3", region3}, {"region5", region5},
+		{"critical", critical}, {"b23", b23}, {"saturation", saturation}
+	}, {
+		{"region1", ph1}, {"region2", ph2}, {"region3", ph3}, {"region5", ph5},
+		{"critical", ph_critical}, {"b23", ph_b23}, {"two_phase", two_phase}
+	});
+
+	register_saturation(*keep(grid_1(273.16, 647.0, 64)), *keep(grid_1(PT, 22.0, 64, logarithmic)));
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file counters.h
+///	\brief Per-thread blocks of counters that are summed on reading.
+///
+/// Each thread counts into its own block, registered on first use and
+/// merged into the totals of exited threads when the thread ends, so that
+/// counting takes no lock.  Counters are atomics written only by their own
+/// thread, with relaxed ordering, so that any thread can read them while
+/// the others are calculating.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef COUNTERS_H
+#define COUNTERS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+/// counter written by one thread and read by any
+typedef std::atomic<unsigned long long> Counter;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief adds to a counter owned by the calling thread
+///
+/// \param[in,out] counter counter
+/// \param[in] n amount to add
+///////////////////////////////////////////////////////////////////////////////
+inline void add(Counter &counter, unsigned long long n)
+{
+	counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief adds the value of one counter to another
+///
+/// \param[in] from counter to read
+/// \param[in,out] to counter to add to
+///////////////////////////////////////////////////////////////////////////////
+inline void merge(const Counter &from, Counter &to)
+{
+	add(to, from.load(std::memory_order_relaxed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the histogram bin of a positive value on a base-2 logarithmic scale
+///
+/// \param[in] value value
+/// \param[in] offset bin of the values in [1, 2)
+/// \param[in] bins number of bins; the end bins also hold the values beyond them
+///
+/// \return bin i, holding the values in [2^(i-offset), 2^(i-offset+1))
+///////////////////////////////////////////////////////////////////////////////
+inline int log2_bin(double value, int offset, int bins)
+{
+	if (!(value > 0))
+		return 0;
+	int exponent;
+	frexp(value, &exponent);  // value = m*2^exponent, 0.5 <= m < 1
+	int bin = exponent - 1 + offset;
+	return (bin < 0) ? 0 : (bin >= bins) ? bins - 1 : bin;
+}
+
+/////////////////////////////////////////////////////////////////////////
+/// blocks of counters of the running threads, and the totals of the exited ones
+///
+/// Block must be default-constructible with its counters at zero, and
+/// merge(const Block &from, Block &to) must add one block to another.
+/// There should be one ThreadBlocks object per Block type, with static
+/// storage duration.
+/////////////////////////////////////////////////////////////////////////
+template <class Block>
+class ThreadBlocks {
+public:
+	///////////////////////////////////////////////////////////////////////////////
+	/// \brief returns the block of the calling thread, registering it on first use
+	///////////////////////////////////////////////////////////////////////////////
+	Block &local(void)
+	{
+		static thread_local Holder holder(*this);
+		return holder.block;
+	}
+
+	///////////////////////////////////////////////////////////////////////////////
+	/// \brief calls f on the totals of the exited threads and then on the block of
+	///  each running thread, holding the registry lock
+	///////////////////////////////////////////////////////////////////////////////
+	template <class Visit>
+	void visit(const Visit &f)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		f(retired);
+		for (Block *block : running)
+			f(*block);
+	}
+
+private:
+	/// block of one thread, registered for as long as the thread runs
+	struct Holder {
+		ThreadBlocks &owner;
+		Block block;
+		Holder(ThreadBlocks &owner) : owner(owner), block()
+		{
+			std::lock_guard<std::mutex> lock(owner.mutex);
+			owner.running.push_back(&block);
+		}
+		~Holder()
+		{
+			std::lock_guard<std::mutex> lock(owner.mutex);
+			merge(block, owner.retired);
+			owner.running.erase(std::find(owner.running.begin(), owner.running.end(), &block));
+		}
+	};
+
+	std::mutex mutex;             ///< guards running and retired
+	std::vector<Block *> running; ///< blocks of the running threads that have counted anything
+	Block retired;                ///< totals of the threads that have exited
+};
+
+#endif // COUNTERS_H
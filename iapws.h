@@ -26,6 +26,9 @@
  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include "wat.h"
+#include "utilities.h"
+
 /////////////////////////////////////////////////////////////////////////
 /// specific gas constant in kJ/kg/K
 /////////////////////////////////////////////////////////////////////////
@@ -52,35 +55,203 @@ const double TT = 273.15;
 /////////////////////////////////////////////////////////////////////////
 const double PT = 611.213E-6;
 
+/////////////////////////////////////////////////////////////////////////
+/// dimensionless Gibbs free energy and its partial derivatives with respect
+/// to reduced pressure (pi) and reduced temperature (tau)
+/////////////////////////////////////////////////////////////////////////
+struct Gibbs {
+	double gamma;
+	double gammapi;
+	double gammapipi;
+	double gammatau;
+	double gammatautau;
+	double gammapitau;
+};
+
+/////////////////////////////////////////////////////////////////////////
+/// dimensionless Helmholtz free energy and its partial derivatives with
+/// respect to reduced density (del) and reduced temperature (tau)
+/////////////////////////////////////////////////////////////////////////
+struct Helmholtz {
+	double phi;
+	double phidel;
+	double phideldel;
+	double phitau;
+	double phitautau;
+	double phideltau;
+};
+
+extern const Settings default_settings;
+const Settings &active_settings(void);
+
+#ifdef WATPROP_INSTRUMENT
+void record_solve(Solver solver, int iterations, int evaluations, double width, bool converged);
+void record_branch(Branch branch);
+/// counts one run of an iterative calculation (see SOLVER_STATISTICS)
+#define RECORD_SOLVE(solver, iterations, evaluations, width, converged) record_solve(solver, iterations, evaluations, width, converged)
+/// counts one use of a branch of an iterative calculation (see BRANCH_TAKEN)
+#define RECORD_BRANCH(branch) record_branch(branch)
+#else
+#define RECORD_SOLVE(solver, iterations, evaluations, width, converged) ((void)0)
+#define RECORD_BRANCH(branch) ((void)0)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds root of [f(x) - target] using Brent's method, with the relative
+///  tolerance and iteration limit of the calling thread's solver options
+///
+/// When built with WATPROP_INSTRUMENT, the function evaluations of the search are
+/// counted and recorded against the given solver.
+///
+/// \param[in] solver iterative calculation, for the solver instrumentation
+/// \param[in] f function under investigation
+/// \param[in] ax lower end of range that must contain the root
+/// \param[in] bx upper end of the range that must contain the root
+/// \param[in] target value of f(x) corresponding to the desired root
+/// \param[in] tol acceptable tolerance
+///
+/// \return estimate of the root
+///
+/// \exception char const* the range does not contain a root, or the search did not
+///  converge within the iteration limit
+///////////////////////////////////////////////////////////////////////////////
+template <class Function>
+double zeroin_active(Solver solver, const Function &f, double ax, double bx, double target, double tol)
+{
+	const Settings &settings = active_settings();
+#ifdef WATPROP_INSTRUMENT
+	int evaluations = 0;
+	auto counted = [&f, &evaluations](double x) { evaluations++; return f(x); };
+	try {
+		double root = zeroin(counted, ax, bx, target, tol, settings.relative_tolerance, settings.max_iterations);
+		RECORD_SOLVE(solver, evaluations - 2, evaluations, bx - ax, true);
+		return root;
+	}
+	catch (...) {
+		RECORD_SOLVE(solver, (evaluations > 2) ? evaluations - 2 : 0, evaluations, bx - ax, false);
+		throw;
+	}
+#else
+	(void)solver;
+	return zeroin(f, ax, bx, target, tol, settings.relative_tolerance, settings.max_iterations);
+#endif
+}
+long zeroin_batch_active(Solver solver, void (*f)(const double[], const double[], double[], long), const double dummy[],
+	const double ax[], const double bx[], const double target[], double tol, double root[], long count);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief refines an estimate of a root with newton2, starting from a backward equation
+///
+/// When built with WATPROP_INSTRUMENT, the iteration is recorded as SOLVER_POLISH, and
+/// a failure as BRANCH_POLISH_FALLBACK.
+///
+/// \param[in] *f function under investigation, returning f(a,x) and its derivative with
+///  respect to x
+/// \param[in] dummy fixed value of first argument to function under investigation
+/// \param[in] ax lower end of the acceptable range for x
+/// \param[in] bx upper end of the acceptable range for x
+/// \param[in] target value of f(a,x) corresponding to the desired root
+/// \param[in,out] x initial estimate of the root on input, refined root on output
+///
+/// \return true if the iteration converged to a root within [ax,bx]
+///////////////////////////////////////////////////////////////////////////////
+inline bool newton_polish(void (*f)(double, double, double &, double &), double dummy, double ax, double bx, double target, double &x)
+{
+#ifdef WATPROP_INSTRUMENT
+	int iterations = 0;
+	bool converged = newton2(f, dummy, ax, bx, target, x, &iterations);
+	RECORD_SOLVE(SOLVER_POLISH, iterations, iterations, bx - ax, converged);
+	if (!converged)
+		RECORD_BRANCH(BRANCH_POLISH_FALLBACK);
+	return converged;
+#else
+	return newton2(f, dummy, ax, bx, target, x);
+#endif
+}
+
+std::string status_message(Status status, const char *function);
+SteamFunction status_function(StatusFunction1 f);
+SteamFunction status_function(StatusFunction2 f);
+
+/////////////////////////////////////////////////////////////////////////
+/// times one call of a steam table function for the call metrics (see
+/// FUNCTION_METRICS), from construction to destruction, in the calling
+/// thread; does nothing unless the metrics are enabled
+/////////////////////////////////////////////////////////////////////////
+class MetricTimer {
+public:
+	MetricTimer(SteamFunction function, bool array, long points = 1);
+	~MetricTimer();
+	bool active(void) const { return start >= 0; }
+	void error(const std::string &message, unsigned long long count = 1);
+
+private:
+	MetricTimer(const MetricTimer &);
+	MetricTimer &operator=(const MetricTimer &);
+
+	SteamFunction function;     ///< function called
+	bool array;                 ///< true for the array calls
+	long points;                ///< statepoints evaluated
+	long long start;            ///< start of the call in ns, or -1 if the metrics are disabled
+	unsigned long long errors;  ///< errors recorded by error()
+};
+
+void complete_state_pt(int region, double t, Units output_units, StatePT &state);
+
 double b23_p_t(double t);
 double b23_t_p(double p);
 double PSAT_T(double t);
 double TSAT_P(double p);
-void check_saturated_p(double pressure);
-void check_saturated_t(double temperature);
+double saturated_property(SaturatedProperty property, double p, double t);
+bool table_pt_value(TableProperty property, double p, double t, double &value);
+const TablePT *active_table_pt(void);
+bool table_ph_value(PHProperty property, double p, double h, double &value);
+Status check_saturated_p(double pressure);
+Status check_saturated_t(double temperature);
 int region_pt(double pressure, double temperature);
+Status region_pt_status(double pressure, double temperature, int &region);
 int region_ph(double pressure, double enthalpy);
+Status region_ph_status(double pressure, double enthalpy, int &region);
+Status region_ps_status(double pressure, double entropy, int &region);
 
+void gibbs_1(double pi, double tau, Gibbs &g);
+void gibbs_1_batch(const double pi[], const double tau[], Gibbs g[], long count);
+void state_pt_1(double p, double t, StatePT &state);
+void state_pt_1_batch(const double p[], const double t[], StatePT state[], long count);
 double v_pt_1(double p,double t);
 double s_pt_1(double p,double t);
 double cp_pt_1(double p,double t);
 double cv_pt_1(double p,double t);
 double w_pt_1(double p,double t);
 double h_pt_1(double p,double t);
+double backward_t_ph_1(double p, double h);
+long t_ph_1_batch(const double p[], const double h[], double t[], long count);
 
+void gibbs_2(double pi, double tau, Gibbs &ideal, Gibbs &residual);
+void gibbs_2_batch(const double pi[], const double tau[], Gibbs ideal[], Gibbs residual[], long count);
+void state_pt_2(double p, double t, StatePT &state);
+void state_pt_2_batch(const double p[], const double t[], StatePT state[], long count);
 double v_pt_2(double p,double t);
 double s_pt_2(double p,double t);
 double cp_pt_2(double p,double t);
 double cv_pt_2(double p,double t);
 double w_pt_2(double p,double t);
 double h_pt_2(double p,double t);
+double b2bc_p_h(double h);
+double b2bc_h_p(double p);
+double backward_t_ph_2(double p, double h);
+long t_ph_2_batch(const double p[], const double h[], double t[], long count);
 
+void state_pt_5(double p, double t, StatePT &state);
 double v_pt_5(double p,double t);
 double s_pt_5(double p,double t);
 double cp_pt_5(double p,double t);
 double w_pt_5(double p,double t);
 double h_pt_5(double p,double t);
 
+void helmholtz_3(double del, double tau, Helmholtz &f);
+void phidel_3(double del, double tau, double &phidel, double &phideldel);
+void state_dt_3(double d, double t, StatePT &state);
 double d_pt_3(double p,double t);
 double s_dt_3(double d,double t);
 double cp_dt_3(double d,double t);
@@ -91,6 +262,11 @@ double p_dt_3(double d, double t);
 
 double df_pt_3(double p, double t);
 double dv_pt_3(double p, double t);
+char subregion_pt_3(double p, double t);
+double backward_v_pt_3(double p, double t);
+double b3ab_h_p(double p);
+double backward_t_ph_3(double p, double h);
+double backward_v_ph_3(double p, double h);
 
 double v_ph_1(double p, double h);
 double v_ph_2(double p, double h);
@@ -109,3 +285,23 @@ double s_ph_3(double p, double h);
 double s_ph_4(double p, double h);
 double s_ph_5(double p, double h);
 
+double backward_t_ps_1(double p, double s);
+double backward_t_ps_2(double p, double s);
+double backward_t_ps_3(double p, double s);
+double t_ps_1(double p, double s);
+double t_ps_2(double p, double s);
+double t_ps_3(double p, double s);
+double t_ps_5(double p, double s);
+void state_ps_3(double p, double s, double &t, double &h, double &v);
+void state_ps_4(double p, double s, double &t, double &h, double &v);
+
+double backward_p_hs_1(double h, double s);
+double b2ab_h_s(double s);
+double backward_p_hs_2(double h, double s);
+double backward_p_hs_3(double h, double s);
+double backward_t_hs_4(double h, double s);
+bool state_hs_1(double h, double s, double &p, double &t);
+bool state_hs_2(double h, double s, double &p, double &t);
+bool state_hs_3(double h, double s, double &p, double &t);
+bool state_hs_4(double h, double s, double &p, double &t);
+
@@ -0,0 +1,256 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file instrument.cpp
+///	\brief Counts of the iterations, function evaluations, and branches of
+///  the iterative calculations, compiled in with WATPROP_INSTRUMENT.
+///
+/// Each thread counts into its own block (see counters.h), and
+/// SOLVER_STATISTICS and BRANCH_TAKEN sum the blocks on reading.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include "iapws.h"
+
+#ifdef WATPROP_INSTRUMENT
+#include "counters.h"
+
+////////////////////////////////////////////////////////
+///	\brief Counts of one iterative calculation.
+////////////////////////////////////////////////////////
+struct SolverCounters {
+	Counter solves;
+	Counter failures;
+	Counter evaluations;
+	Counter iterations[SOLVER_BINS];
+	Counter bracket[SOLVER_BINS];
+};
+
+////////////////////////////////////////////////////////
+///	\brief Counts of all of the iterative calculations of one thread.
+////////////////////////////////////////////////////////
+struct Counters {
+	SolverCounters solvers[SOLVER_COUNT];
+	Counter branches[BRANCH_COUNT];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief adds one set of counts to another
+///////////////////////////////////////////////////////////////////////////////
+static void merge(const Counters &from, Counters &to)
+{
+	for (int s=0; s<SOLVER_COUNT; s++) {
+		const SolverCounters &a = from.solvers[s];
+		SolverCounters &b = to.solvers[s];
+		merge(a.solves, b.solves);
+		merge(a.failures, b.failures);
+		merge(a.evaluations, b.evaluations);
+		for (int i=0; i<SOLVER_BINS; i++) {
+			merge(a.iterations[i], b.iterations[i]);
+			merge(a.bracket[i], b.bracket[i]);
+		}
+	}
+	for (int i=0; i<BRANCH_COUNT; i++)
+		merge(from.branches[i], to.branches[i]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief sets every count to zero
+///////////////////////////////////////////////////////////////////////////////
+static void clear(Counters &counters)
+{
+	for (int s=0; s<SOLVER_COUNT; s++) {
+		SolverCounters &c = counters.solvers[s];
+		c.solves.store(0, std::memory_order_relaxed);
+		c.failures.store(0, std::memory_order_relaxed);
+		c.evaluations.store(0, std::memory_order_relaxed);
+		for (int i=0; i<SOLVER_BINS; i++) {
+			c.iterations[i].store(0, std::memory_order_relaxed);
+			c.bracket[i].store(0, std::memory_order_relaxed);
+		}
+	}
+	for (int i=0; i<BRANCH_COUNT; i++)
+		counters.branches[i].store(0, std::memory_order_relaxed);
+}
+
+/// counts of each thread
+static ThreadBlocks<Counters> thread_counters;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the histogram bin of a count, the last bin holding all larger ones
+///////////////////////////////////////////////////////////////////////////////
+static int count_bin(int n)
+{
+	return (n < 0) ? 0 : (n >= SOLVER_BINS) ? SOLVER_BINS - 1 : n;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief counts one run of an iterative calculation in the calling thread
+///
+/// \param[in] solver iterative calculation
+/// \param[in] iterations number of iterations
+/// \param[in] evaluations number of evaluations of the property function
+/// \param[in] width width of the initial bracket (or acceptable range) of the root
+/// \param[in] converged false if the calculation failed
+///////////////////////////////////////////////////////////////////////////////
+void record_solve(Solver solver, int iterations, int evaluations, double width, bool converged)
+{
+	SolverCounters &c = thread_counters.local().solvers[solver];
+	add(c.solves, 1);
+	if (!converged)
+		add(c.failures, 1);
+	add(c.evaluations, evaluations);
+	add(c.iterations[count_bin(iterations)], 1);
+	// bin i holds the widths in [2^(i-16), 2^(i-15))
+	add(c.bracket[log2_bin(fabs(width), SOLVER_BINS/2, SOLVER_BINS)], 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief counts one use of a branch of an iterative calculation in the calling thread
+///
+/// \param[in] branch branch taken
+///////////////////////////////////////////////////////////////////////////////
+void record_branch(Branch branch)
+{
+	add(thread_counters.local().branches[branch], 1);
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds roots of [f(a,x) - target] at arrays of statepoints using Brent's
+///  method in lock step (zeroin_batch), with the relative tolerance and iteration
+///  limit of the calling thread's solver options
+///
+/// When built with WATPROP_INSTRUMENT, each search is recorded against the given solver.
+///
+/// \param[in] solver iterative calculation, for the solver instrumentation
+/// \param[in] *f function under investigation, which receives arrays of the first
+///  and second arguments and fills an array of values
+/// \param[in] dummy array of fixed values of first argument to function under investigation
+/// \param[in] ax array of lower ends of ranges that must contain the roots
+/// \param[in] bx array of upper ends of ranges that must contain the roots
+/// \param[in] target array of values of f(a,x) corresponding to the desired roots
+/// \param[in] tol acceptable tolerance
+/// \param[out] root array that receives the roots, or NaN where the search failed
+/// \param[in] count number of elements in the dummy, ax, bx, target, and root arrays
+///
+/// \return number of searches that failed
+///////////////////////////////////////////////////////////////////////////////
+long zeroin_batch_active(Solver solver, void (*f)(const double[], const double[], double[], long), const double dummy[],
+	const double ax[], const double bx[], const double target[], double tol, double root[], long count)
+{
+	const Settings &settings = active_settings();
+#ifdef WATPROP_INSTRUMENT
+	std::vector<int> iterations(count);
+	long failures = zeroin_batch(f, dummy, ax, bx, target, tol, settings.relative_tolerance, settings.max_iterations, root, count, iterations.data());
+	for (long i=0; i<count; i++)
+		RECORD_SOLVE(solver, iterations[i], iterations[i] + 2, bx[i] - ax[i], !std::isnan(root[i]));
+	return failures;
+#else
+	(void)solver;
+	return zeroin_batch(f, dummy, ax, bx, target, tol, settings.relative_tolerance, settings.max_iterations, root, count);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief tells whether the solver instrumentation was compiled in
+///
+/// \return 1 if the library was built with WATPROP_INSTRUMENT, otherwise 0
+///////////////////////////////////////////////////////////////////////////////
+int SOLVER_INSTRUMENTED(void)
+{
+#ifdef WATPROP_INSTRUMENT
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the counts of one iterative calculation, summed over all threads,
+///  since the last call to RESET_SOLVER_STATISTICS
+///
+/// \param[in] solver iterative calculation
+///
+/// \return counts, all zero if the instrumentation was not compiled in
+///////////////////////////////////////////////////////////////////////////////
+SolverStatistics SOLVER_STATISTICS(Solver solver)
+{
+	SolverStatistics statistics = {};
+#ifdef WATPROP_INSTRUMENT
+	if (solver < 0 || solver >= SOLVER_COUNT)
+		return statistics;
+	thread_counters.visit([solver, &statistics](const Counters &counters) {
+		const SolverCounters &c = counters.solvers[solver];
+		statistics.solves += c.solves.load(std::memory_order_relaxed);
+		statistics.failures += c.failures.load(std::memory_order_relaxed);
+		statistics.evaluations += c.evaluations.load(std::memory_order_relaxed);
+		for (int i=0; i<SOLVER_BINS; i++) {
+			statistics.iterations[i] += c.iterations[i].load(std::memory_order_relaxed);
+			statistics.bracket[i] += c.bracket[i].load(std::memory_order_relaxed);
+		}
+	});
+#else
+	(void)solver;
+#endif
+	return statistics;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the number of times a branch of an iterative calculation was taken,
+///  summed over all threads, since the last call to RESET_SOLVER_STATISTICS
+///
+/// \param[in] branch branch of an iterative calculation
+///
+/// \return count, zero if the instrumentation was not compiled in
+///////////////////////////////////////////////////////////////////////////////
+unsigned long long BRANCH_TAKEN(Branch branch)
+{
+	unsigned long long taken = 0;
+#ifdef WATPROP_INSTRUMENT
+	if (branch < 0 || branch >= BRANCH_COUNT)
+		return 0;
+	thread_counters.visit([branch, &taken](const Counters &counters) {
+		taken += counters.branches[branch].load(std::memory_order_relaxed);
+	});
+#else
+	(void)branch;
+#endif
+	return taken;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief clears the solver instrumentation counts of all threads
+///
+/// Counts recorded by other threads while the reset is in progress may be lost.
+///////////////////////////////////////////////////////////////////////////////
+void RESET_SOLVER_STATISTICS(void)
+{
+#ifdef WATPROP_INSTRUMENT
+	thread_counters.visit([](Counters &counters) { clear(counters); });
+#endif
+}
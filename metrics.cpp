@@ -0,0 +1,359 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file metrics.cpp
+///	\brief Counts of the calls, errors, and latencies of the steam table
+///  functions.
+///
+/// Collection is switched on by setting WATPROP_METRICS in the environment,
+/// or by SET_METRICS_ENABLED.  Each thread counts into its own block (see
+/// counters.h), and FUNCTION_METRICS and FUNCTION_ERROR sum the blocks on
+/// reading.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include "iapws.h"
+#include "counters.h"
+
+////////////////////////////////////////////////////////
+///	\brief Names of the steam table functions, in the order of SteamFunction.
+////////////////////////////////////////////////////////
+static const char *const function_names[FUNCTION_COUNT] = {
+	"cp_pt", "h_pt", "k_pt", "s_pt", "v_pt", "vis_pt", "w_pt", "state_pt",
+	"p_t", "hf_t", "hg_t", "sf_t", "sg_t", "vf_t", "vg_t",
+	"t_p", "hf_p", "hg_p", "sf_p", "sg_p", "vf_p", "vg_p",
+	"t_ph", "s_ph", "v_ph",
+	"t_ps", "h_ps", "v_ps", "p_hs", "t_hs"
+};
+
+////////////////////////////////////////////////////////
+///	\brief Status versions of the steam table functions of one property.
+////////////////////////////////////////////////////////
+static const struct {
+	StatusFunction1 f;
+	SteamFunction function;
+} status_functions_1[] = {
+	{P_T_STATUS, FUNCTION_P_T}, {HF_T_STATUS, FUNCTION_HF_T}, {HG_T_STATUS, FUNCTION_HG_T},
+	{SF_T_STATUS, FUNCTION_SF_T}, {SG_T_STATUS, FUNCTION_SG_T}, {VF_T_STATUS, FUNCTION_VF_T},
+	{VG_T_STATUS, FUNCTION_VG_T}, {T_P_STATUS, FUNCTION_T_P}, {HF_P_STATUS, FUNCTION_HF_P},
+	{HG_P_STATUS, FUNCTION_HG_P}, {SF_P_STATUS, FUNCTION_SF_P}, {SG_P_STATUS, FUNCTION_SG_P},
+	{VF_P_STATUS, FUNCTION_VF_P}, {VG_P_STATUS, FUNCTION_VG_P}
+};
+
+////////////////////////////////////////////////////////
+///	\brief Status versions of the steam table functions of two properties.
+////////////////////////////////////////////////////////
+static const struct {
+	StatusFunction2 f;
+	SteamFunction function;
+} status_functions_2[] = {
+	{CP_PT_STATUS, FUNCTION_CP_PT}, {H_PT_STATUS, FUNCTION_H_PT}, {K_PT_STATUS, FUNCTION_K_PT},
+	{S_PT_STATUS, FUNCTION_S_PT}, {V_PT_STATUS, FUNCTION_V_PT}, {VIS_PT_STATUS, FUNCTION_VIS_PT},
+	{W_PT_STATUS, FUNCTION_W_PT}, {T_PH_STATUS, FUNCTION_T_PH}, {S_PH_STATUS, FUNCTION_S_PH},
+	{V_PH_STATUS, FUNCTION_V_PH}, {T_PS_STATUS, FUNCTION_T_PS}, {H_PS_STATUS, FUNCTION_H_PS},
+	{V_PS_STATUS, FUNCTION_V_PS}, {P_HS_STATUS, FUNCTION_P_HS}, {T_HS_STATUS, FUNCTION_T_HS}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief reads the initial state of the metrics from WATPROP_METRICS
+///
+/// \return true if WATPROP_METRICS is set to anything but an empty string or 0
+///////////////////////////////////////////////////////////////////////////////
+static bool metrics_from_environment(void)
+{
+	const char *value = getenv("WATPROP_METRICS");
+	return (value != 0) && (*value != 0) && (strcmp(value, "0") != 0);
+}
+
+/// true while the metrics are being collected
+static std::atomic<bool> enabled(metrics_from_environment());
+
+////////////////////////////////////////////////////////
+///	\brief Counts of the calls of one steam table function of one kind.
+////////////////////////////////////////////////////////
+struct CallCounters {
+	Counter calls;
+	Counter errors;
+	Counter points;
+	Counter total_ns;
+	Counter latency[METRIC_BINS];
+};
+
+////////////////////////////////////////////////////////
+///	\brief Counts of the calls of all of the steam table functions in one thread.
+////////////////////////////////////////////////////////
+struct MetricCounters {
+	CallCounters calls[FUNCTION_COUNT][2];
+	std::mutex mutex;                                          ///< guards messages
+	std::map<std::string, unsigned long long> messages[FUNCTION_COUNT][2]; ///< errors by message
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief adds one set of counts to another
+///////////////////////////////////////////////////////////////////////////////
+static void merge(MetricCounters &from, MetricCounters &to)
+{
+	std::lock_guard<std::mutex> lock_from(from.mutex);
+	std::lock_guard<std::mutex> lock_to(to.mutex);
+	for (int f=0; f<FUNCTION_COUNT; f++) {
+		for (int a=0; a<2; a++) {
+			const CallCounters &x = from.calls[f][a];
+			CallCounters &y = to.calls[f][a];
+			merge(x.calls, y.calls);
+			merge(x.errors, y.errors);
+			merge(x.points, y.points);
+			merge(x.total_ns, y.total_ns);
+			for (int i=0; i<METRIC_BINS; i++)
+				merge(x.latency[i], y.latency[i]);
+			for (const auto &message : from.messages[f][a])
+				to.messages[f][a][message.first] += message.second;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief sets every count to zero
+///////////////////////////////////////////////////////////////////////////////
+static void clear(MetricCounters &counters)
+{
+	std::lock_guard<std::mutex> lock(counters.mutex);
+	for (int f=0; f<FUNCTION_COUNT; f++) {
+		for (int a=0; a<2; a++) {
+			CallCounters &c = counters.calls[f][a];
+			c.calls.store(0, std::memory_order_relaxed);
+			c.errors.store(0, std::memory_order_relaxed);
+			c.points.store(0, std::memory_order_relaxed);
+			c.total_ns.store(0, std::memory_order_relaxed);
+			for (int i=0; i<METRIC_BINS; i++)
+				c.latency[i].store(0, std::memory_order_relaxed);
+			counters.messages[f][a].clear();
+		}
+	}
+}
+
+/// counts of each thread
+static ThreadBlocks<MetricCounters> thread_metrics;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the current time in nanoseconds
+///////////////////////////////////////////////////////////////////////////////
+static long long now_ns(void)
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds the steam table function of the status version of a function of
+///  one property
+///
+/// \param[in] f status version of the function (e.g. P_T_STATUS)
+///
+/// \return steam table function, or FUNCTION_COUNT if f is not one of them
+///////////////////////////////////////////////////////////////////////////////
+SteamFunction status_function(StatusFunction1 f)
+{
+	for (const auto &entry : status_functions_1) {
+		if (entry.f == f)
+			return entry.function;
+	}
+	return FUNCTION_COUNT;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds the steam table function of the status version of a function of
+///  two properties
+///
+/// \param[in] f status version of the function (e.g. H_PT_STATUS)
+///
+/// \return steam table function, or FUNCTION_COUNT if f is not one of them
+///////////////////////////////////////////////////////////////////////////////
+SteamFunction status_function(StatusFunction2 f)
+{
+	for (const auto &entry : status_functions_2) {
+		if (entry.f == f)
+			return entry.function;
+	}
+	return FUNCTION_COUNT;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief starts timing a call, if the metrics are enabled
+///
+/// \param[in] function function called, or FUNCTION_COUNT to time nothing
+/// \param[in] array true for a call over arrays of statepoints
+/// \param[in] points number of statepoints evaluated
+///////////////////////////////////////////////////////////////////////////////
+MetricTimer::MetricTimer(SteamFunction function, bool array, long points)
+	: function(function), array(array), points(points), start(-1), errors(0)
+{
+	if (enabled.load(std::memory_order_relaxed) && (function >= 0) && (function < FUNCTION_COUNT))
+		start = now_ns();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief counts the call and its duration in the calling thread
+///////////////////////////////////////////////////////////////////////////////
+MetricTimer::~MetricTimer()
+{
+	if (!active())
+		return;
+	long long elapsed = now_ns() - start;
+	CallCounters &c = thread_metrics.local().calls[function][array];
+	add(c.calls, 1);
+	add(c.errors, errors);
+	add(c.points, points);
+	add(c.total_ns, elapsed);
+	add(c.latency[log2_bin((double) elapsed, 0, METRIC_BINS)], 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief counts errors of the call by message
+///
+/// \param[in] message error message
+/// \param[in] count number of errors (statepoints, for an array call)
+///////////////////////////////////////////////////////////////////////////////
+void MetricTimer::error(const std::string &message, unsigned long long count)
+{
+	if (!active())
+		return;
+	errors += count;
+	MetricCounters &counters = thread_metrics.local();
+	std::lock_guard<std::mutex> lock(counters.mutex);
+	counters.messages[function][array][message] += count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief tells whether the call metrics are being collected
+///
+/// \return 1 if they are, otherwise 0
+///////////////////////////////////////////////////////////////////////////////
+int METRICS_ENABLED(void)
+{
+	return enabled.load(std::memory_order_relaxed) ? 1 : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief starts or stops collecting the call metrics in all threads
+///
+/// The counts collected so far are kept.
+///
+/// \param[in] on 1 to collect, 0 to stop
+///////////////////////////////////////////////////////////////////////////////
+void SET_METRICS_ENABLED(int on)
+{
+	enabled.store(on != 0, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the name of a steam table function
+///
+/// \param[in] function steam table function
+///
+/// \return lowercase name (e.g. "h_pt"), or an empty string if function is invalid
+///////////////////////////////////////////////////////////////////////////////
+const char *FUNCTION_NAME(SteamFunction function)
+{
+	if (function < 0 || function >= FUNCTION_COUNT)
+		return "";
+	return function_names[function];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the counts of the calls of a steam table function, summed over all
+///  threads, since the last call to RESET_FUNCTION_METRICS
+///
+/// \param[in] function steam table function
+/// \param[in] array 1 for the calls over arrays, 0 for the calls of one statepoint
+///
+/// \return counts
+///////////////////////////////////////////////////////////////////////////////
+FunctionMetrics FUNCTION_METRICS(SteamFunction function, int array)
+{
+	FunctionMetrics metrics = {};
+	if (function < 0 || function >= FUNCTION_COUNT)
+		return metrics;
+	thread_metrics.visit([function, array, &metrics](const MetricCounters &counters) {
+		const CallCounters &c = counters.calls[function][array != 0];
+		metrics.calls += c.calls.load(std::memory_order_relaxed);
+		metrics.errors += c.errors.load(std::memory_order_relaxed);
+		metrics.points += c.points.load(std::memory_order_relaxed);
+		metrics.total_ns += c.total_ns.load(std::memory_order_relaxed);
+		for (int i=0; i<METRIC_BINS; i++)
+			metrics.latency[i] += c.latency[i].load(std::memory_order_relaxed);
+	});
+	return metrics;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns one of the error messages of a steam table function, summed over
+///  all threads, since the last call to RESET_FUNCTION_METRICS
+///
+/// The messages are in alphabetical order.
+///
+/// \param[in] function steam table function
+/// \param[in] array 1 for the calls over arrays, 0 for the calls of one statepoint
+/// \param[in] index index of the message, from 0
+/// \param[out] message buffer that receives the message, truncated to fit
+/// \param[in] size size of the buffer
+///
+/// \return number of errors with the message, or 0 if index is past the last message
+///////////////////////////////////////////////////////////////////////////////
+unsigned long long FUNCTION_ERROR(SteamFunction function, int array, int index, char *message, int size)
+{
+	if (size > 0)
+		message[0] = 0;
+	if (function < 0 || function >= FUNCTION_COUNT || index < 0)
+		return 0;
+	std::map<std::string, unsigned long long> messages;
+	thread_metrics.visit([function, array, &messages](MetricCounters &counters) {
+		std::lock_guard<std::mutex> lock(counters.mutex);
+		for (const auto &entry : counters.messages[function][array != 0])
+			messages[entry.first] += entry.second;
+	});
+	for (const auto &entry : messages) {
+		if (index-- == 0) {
+			if (size > 0) {
+				strncpy(message, entry.first.c_str(), size - 1);
+				message[size - 1] = 0;
+			}
+			return entry.second;
+		}
+	}
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief clears the call metrics of all threads
+///
+/// Calls counted by other threads while the reset is in progress may be lost.
+///////////////////////////////////////////////////////////////////////////////
+void RESET_FUNCTION_METRICS(void)
+{
+	thread_metrics.visit([](MetricCounters &counters) { clear(counters); });
+}
@@ -28,6 +28,7 @@
  */
 
 #include <cmath>
+#include <vector>
 #include "utilities.h"
 /////////////////////////////////////////////////////////////////////////
 /// if not already defined, this represents the difference between 1.0
@@ -65,60 +66,40 @@ double interpolate(const double x[], const double y[], int size, double given)
 
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief finds root of [f(x,a) - target] using Brent's method
-///
-/// This is a modified version of "zeroin" from NETLIB.  While the original zeroin
-/// was designed for to search for a root of a function with only one argument,
-/// this routine permits the search for a root of a function that has two arguments.
-///
-/// Algorithm
-///	G.Forsythe, M.Malcolm, C.Moler, Computer methods for mathematical
-///	computations. M., Mir, 1980, p.180 of the Russian edition
+/// \brief starts a search for a root by Brent's method
 ///
-///	The function makes use of the bissection procedure combined with
-///	the linear or quadric inverse interpolation.
-///	At every step program operates on three abscissae - a, b, and c.
-///	b - the last and the best approximation to the root
-///	a - the last but one approximation
-///	c - the last but one or even earlier approximation than a that
-///		1) |f(b)| <= |f(c)|
-///		2) f(b) and f(c) have opposite signs, i.e. b and c confine
-///		   the root
-///	At every step zeroin1 selects one of the two new approximations, the
-///	former being obtained by the bissection procedure and the latter
-///	resulting in the interpolation (if a,b, and c are all different
-///	the quadric interpolation is utilized, otherwise the linear one).
-///	If the latter (i.e. obtained by the interpolation) point is
-///	reasonable (i.e. lies within the current interval [b,c] not being
-/// too close to the boundaries) it is accepted. The bissection result
-///	is used in the other case. Therefore, the range of uncertainty is
-///	ensured to be reduced at least by the factor 1.6
-///
-/// \param[in] *f function under investigation
-/// \param[in] dummy fixed value of second argument to function under investigation
-/// \param[in] ax lower end of range for function first argument that must contain the root
-/// \param[in] bx upper end of the range for function first argument that must contain the root
-/// \param[in] target value of f(x,a) corresponding to the desired root
-/// \param[in] tol acceptable tolerance
+/// \param[out] s state of the search
+/// \param[in] ax lower end of range that must contain the root
+/// \param[in] fa value of [f - target] at ax
+/// \param[in] bx upper end of range that must contain the root
+/// \param[in] fb value of [f - target] at bx
 ///
-/// \return value an estimate for the root with accuracy 4*EPSILON*abs(x) + tol
+/// \return false if the range does not contain a root
 ///////////////////////////////////////////////////////////////////////////////
-double zeroin1(double (*f)(double, double), double dummy, double ax, double bx, double target, double tol)
+bool brent_start(BrentState &s, double ax, double fa, double bx, double fb)
 {
-  double a,b,c;				/* Abscissae, descr. see above	*/
-  double fa;				/* f(a)				*/
-  double fb;				/* f(b)				*/
-  double fc;				/* f(c)				*/
-
-  a = ax;  b = bx;  fa = (*f)(a,dummy)-target;  fb = (*f)(b,dummy)-target;
-  c = a;   fc = fa;
+  s.a = ax;  s.b = bx;  s.fa = fa;  s.fb = fb;
+  s.c = s.a;   s.fc = s.fa;
 
   // verify that we are bracketed
-  if (fa*fb > 0)
-	  throw "error in brent root routine";
+  return !(s.fa*s.fb > 0);
+}
 
-  for(;;)		/* Main iteration loop	*/
-  {
+///////////////////////////////////////////////////////////////////////////////
+/// \brief checks for convergence and, if not converged, chooses the next approximation
+///  to the root by Brent's method
+///
+/// \param[in,out] s state of the search, with the next approximation in s.b
+/// \param[in] tol acceptable tolerance
+/// \param[in] rtol acceptable tolerance relative to the root
+///
+/// \return true if s.b is an estimate for the root with accuracy
+///  (4*EPSILON + rtol)*abs(x) + tol
+///////////////////////////////////////////////////////////////////////////////
+bool brent_advance(BrentState &s, double tol, double rtol)
+{
+    double &a = s.a, &b = s.b, &c = s.c;
+    double &fa = s.fa, &fb = s.fb, &fc = s.fc;
     double prev_step = b-a;		/* Distance from the last but one*/
 					/* to the last approximation	*/
     double tol_act;			/* Actual tolerance		*/
@@ -133,17 +114,17 @@ double zeroin1(double (*f)(double, double), double dummy, double ax, double bx,
 	a = b;  b = c;  c = a;          /* best approximation		*/
 	fa=fb;  fb=fc;  fc=fa;
     }
-    tol_act = 2*DBL_EPSILON*fabs(b) + tol/2;
+    tol_act = (2*DBL_EPSILON + rtol/2)*fabs(b) + tol/2;
     new_step = (c-b)/2;
 
     if( fabs(new_step) <= tol_act || fb == (double)0 )
-      return b;				/* Acceptable approx. is found	*/
+      return true;			/* Acceptable approx. is found	*/
 
     			/* Decide if the interpolation can be tried	*/
     if( fabs(prev_step) >= tol_act	/* If prev_step was large enough*/
 	&& fabs(fa) > fabs(fb) )	/* and was in true direction,	*/
     {					/* Interpolatiom may be tried	*/
-	register double t1,cb,t2;
+	double t1,cb,t2;
 	cb = c-b;
 	if( a==c )			/* If we have only two distinct	*/
 	{				/* points linear interpolation 	*/
@@ -172,51 +153,62 @@ double zeroin1(double (*f)(double, double), double dummy, double ax, double bx,
     }
 
     if( fabs(new_step) < tol_act )	/* Adjust the step to be not less*/
-      if( new_step > (double)0 )	/* than tolerance		*/
+    {					/* than tolerance		*/
+      if( new_step > (double)0 )
 	new_step = tol_act;
       else
 	new_step = -tol_act;
+    }
 
     a = b;  fa = fb;			/* Save the previous approx.	*/
-    b += new_step;  fb = (*f)(b,dummy)-target;	/* Do step to a new approxim.	*/
-    if( (fb > 0 && fc > 0) || (fb < 0 && fc < 0) )
+    b += new_step;			/* Do step to a new approxim.	*/
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief records the value of the function at the approximation chosen by brent_advance
+///
+/// \param[in,out] s state of the search
+/// \param[in] fb value of [f - target] at s.b
+///////////////////////////////////////////////////////////////////////////////
+void brent_update(BrentState &s, double fb)
+{
+    s.fb = fb;
+    if( (s.fb > 0 && s.fc > 0) || (s.fb < 0 && s.fc < 0) )
     {                 			/* Adjust c for it to have a sign*/
-      c = a;  fc = fa;                  /* opposite to that of b	*/
+      s.c = s.a;  s.fc = s.fa;          /* opposite to that of b	*/
     }
-  }
-
 }
 
-
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief finds root of [f(a,x) - target] using Brent's method
+/// \brief finds root of [f(x,a) - target] using Brent's method
+///
+/// While the original zeroin was designed for to search for a root of a function
+/// with only one argument, this routine permits the search for a root of a function
+/// that has two arguments.  It calls f through a pointer, so new code should call
+/// the zeroin template with the function instead.
 ///
-/// This is a modified version of "zeroin" from NETLIB.  While the original zeroin
-/// was designed for to search for a root of a function with only one argument,
-/// this routine permits the search for a root of a function that has two arguments.
+/// \param[in] *f function under investigation
+/// \param[in] dummy fixed value of second argument to function under investigation
+/// \param[in] ax lower end of range for function first argument that must contain the root
+/// \param[in] bx upper end of the range for function first argument that must contain the root
+/// \param[in] target value of f(x,a) corresponding to the desired root
+/// \param[in] tol acceptable tolerance
 ///
-/// Algorithm
-///	G.Forsythe, M.Malcolm, C.Moler, Computer methods for mathematical
-///	computations. M., Mir, 1980, p.180 of the Russian edition
+/// \return value an estimate for the root with accuracy 4*EPSILON*abs(x) + tol
+///////////////////////////////////////////////////////////////////////////////
+double zeroin1(double (*f)(double, double), double dummy, double ax, double bx, double target, double tol)
+{
+  return zeroin([f, dummy](double x) { return (*f)(x,dummy); }, ax, bx, target, tol);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds root of [f(a,x) - target] using Brent's method
 ///
-///	The function makes use of the bissection procedure combined with
-///	the linear or quadric inverse interpolation.
-///	At every step program operates on three abscissae - a, b, and c.
-///	b - the last and the best approximation to the root
-///	a - the last but one approximation
-///	c - the last but one or even earlier approximation than a that
-///		1) |f(b)| <= |f(c)|
-///		2) f(b) and f(c) have opposite signs, i.e. b and c confine
-///		   the root
-///	At every step zeroin2 selects one of the two new approximations, the
-///	former being obtained by the bissection procedure and the latter
-///	resulting in the interpolation (if a,b, and c are all different
-///	the quadric interpolation is utilized, otherwise the linear one).
-///	If the latter (i.e. obtained by the interpolation) point is
-///	reasonable (i.e. lies within the current interval [b,c] not being
-/// too close to the boundaries) it is accepted. The bissection result
-///	is used in the other case. Therefore, the range of uncertainty is
-///	ensured to be reduced at least by the factor 1.6
+/// While the original zeroin was designed for to search for a root of a function
+/// with only one argument, this routine permits the search for a root of a function
+/// that has two arguments.  It calls f through a pointer, so new code should call
+/// the zeroin template with the function instead.
 ///
 /// \param[in] *f function under investigation
 /// \param[in] dummy fixed value of first argument to function under investigation
@@ -229,84 +221,179 @@ double zeroin1(double (*f)(double, double), double dummy, double ax, double bx,
 ///////////////////////////////////////////////////////////////////////////////
 double zeroin2(double (*f)(double, double), double dummy, double ax, double bx, double target, double tol)
 {
-  double a,b,c;				/* Abscissae, descr. see above	*/
-  double fa;				/* f(a)				*/
-  double fb;				/* f(b)				*/
-  double fc;				/* f(c)				*/
-
-  a = ax;  b = bx;  fa = (*f)(dummy,a)-target;  fb = (*f)(dummy,b)-target;
-  c = a;   fc = fa;
+  return zeroin([f, dummy](double x) { return (*f)(dummy,x); }, ax, bx, target, tol);
+}
 
-  // verify that we are bracketed
-  if (fa*fb > 0)
-	  throw "error in brent root routine";
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds the roots of [f(a[i],x) - target[i]] for arrays of a and target using
+///  Brent's method, advancing all of the searches in lock step
+///
+/// Each iteration evaluates the function once, for every search that has not yet
+/// converged, so that f can evaluate many statepoints together (e.g. with the
+/// vectorized region kernels).  Searches that converge are retired from the
+/// following iterations.  Every root is identical to the one zeroin would return.
+///
+/// \param[in] *f function under investigation, which receives arrays of the first
+///  argument, the second argument, the result, and their length
+/// \param[in] dummy array of fixed values of first argument to function under investigation
+/// \param[in] ax array of lower ends of ranges that must contain the roots
+/// \param[in] bx array of upper ends of ranges that must contain the roots
+/// \param[in] target array of values of f(a,x) corresponding to the desired roots
+/// \param[in] tol acceptable tolerance
+/// \param[in] rtol acceptable tolerance relative to the root
+/// \param[in] max_iterations largest number of iterations, or 0 for no limit
+/// \param[out] root array that receives the roots, or NaN where the range does not
+///  contain a root or the search did not converge
+/// \param[in] count number of elements in the dummy, ax, bx, target, and root arrays
+/// \param[out] iterations if not 0, array that receives the number of iterations of
+///  each search (each one evaluation of f beyond the two ends of the range)
+///
+/// \return number of searches that failed
+///////////////////////////////////////////////////////////////////////////////
+long zeroin_batch(void (*f)(const double[], const double[], double[], long), const double dummy[], const double ax[], const double bx[], const double target[], double tol, double rtol, int max_iterations, double root[], long count, int iterations[])
+{
+  std::vector<BrentState> state(count);
+  std::vector<long> active(count);
+  std::vector<double> fixed(count);
+  std::vector<double> x(count);
+  std::vector<double> fa(count);
+  std::vector<double> fb(count);
+  long failures = 0;
 
-  for(;;)		/* Main iteration loop	*/
-  {
-    double prev_step = b-a;		/* Distance from the last but one*/
-					/* to the last approximation	*/
-    double tol_act;			/* Actual tolerance		*/
-    double p;      			/* Interpolation step is calcu- */
-    double q;      			/* lated in the form p/q; divi- */
-  					/* sion operations is delayed   */
- 					/* until the last moment	*/
-    double new_step;      		/* Step at this iteration       */
-   
-    if( fabs(fc) < fabs(fb) )
-    {                         		/* Swap data for b to be the 	*/
-	a = b;  b = c;  c = a;          /* best approximation		*/
-	fa=fb;  fb=fc;  fc=fa;
-    }
-    tol_act = 2*DBL_EPSILON*fabs(b) + tol/2;
-    new_step = (c-b)/2;
+  (*f)(dummy, ax, fa.data(), count);
+  (*f)(dummy, bx, fb.data(), count);
+  long remaining = 0;
+  for (long i=0; i<count; i++) {
+	  if (iterations)
+		  iterations[i] = 0;
+	  if (brent_start(state[i], ax[i], fa[i]-target[i], bx[i], fb[i]-target[i])) {
+		  active[remaining++] = i;
+	  }
+	  else {
+		  root[i] = NAN;
+		  failures++;
+	  }
+  }
 
-    if( fabs(new_step) <= tol_act || fb == (double)0 )
-      return b;				/* Acceptable approx. is found	*/
+  for (int iteration=0; remaining > 0; iteration++) {
+	  // retire the converged searches and collect the next approximation of the others
+	  long n = 0;
+	  for (long k=0; k<remaining; k++) {
+		  long i = active[k];
+		  if (brent_advance(state[i], tol, rtol)) {
+			  root[i] = state[i].b;
+		  }
+		  else if ((max_iterations > 0) && (iteration >= max_iterations)) {
+			  root[i] = NAN;
+			  failures++;
+		  }
+		  else {
+			  active[n] = i;
+			  fixed[n] = dummy[i];
+			  x[n] = state[i].b;
+			  n++;
+		  }
+	  }
+	  remaining = n;
+	  if (remaining == 0)
+		  break;
+	  (*f)(fixed.data(), x.data(), fb.data(), remaining);
+	  for (long k=0; k<remaining; k++) {
+		  brent_update(state[active[k]], fb[k]-target[active[k]]);
+		  if (iterations)
+			  iterations[active[k]]++;
+	  }
+  }
+  return failures;
+}
 
-    			/* Decide if the interpolation can be tried	*/
-    if( fabs(prev_step) >= tol_act	/* If prev_step was large enough*/
-	&& fabs(fa) > fabs(fb) )	/* and was in true direction,	*/
-    {					/* Interpolatiom may be tried	*/
-	register double t1,cb,t2;
-	cb = c-b;
-	if( a==c )			/* If we have only two distinct	*/
-	{				/* points linear interpolation 	*/
-	  t1 = fb/fa;			/* can only be applied		*/
-	  p = cb*t1;
-	  q = 1.0 - t1;
- 	}
-	else				/* Quadric inverse interpolation*/
-	{
-	  q = fa/fc;  t1 = fb/fc;  t2 = fb/fa;
-	  p = t2 * ( cb*q*(q-t1) - (b-a)*(t1-1.0) );
-	  q = (q-1.0) * (t1-1.0) * (t2-1.0);
+///////////////////////////////////////////////////////////////////////////////
+/// \brief raises a number to an integer power by repeated squaring
+///
+/// \param[in] x base
+/// \param[in] k exponent
+///
+/// \return x to the power k
+///////////////////////////////////////////////////////////////////////////////
+static double ipow(double x, int k)
+{
+	if (k < 0) {
+		x = 1 / x;
+		k = -k;
 	}
-	if( p>(double)0 )		/* p was calculated with the op-*/
-	  q = -q;			/* posite sign; make p positive	*/
-	else				/* and assign possible minus to	*/
-	  p = -p;			/* q				*/
-
-	if( p < (0.75*cb*q-fabs(tol_act*q)/2)	/* If b+p/q falls in [b,c]*/
-	    && p < fabs(prev_step*q/2) )	/* and isn't too large	*/
-	  new_step = p/q;			/* it is accepted	*/
-					/* If p/q is too large then the	*/
-					/* bissection procedure can 	*/
-					/* reduce [b,c] range to more	*/
-					/* extent			*/
-    }
-
-    if( fabs(new_step) < tol_act )	/* Adjust the step to be not less*/
-      if( new_step > (double)0 )	/* than tolerance		*/
-	new_step = tol_act;
-      else
-	new_step = -tol_act;
+	double result = 1;
+	while (k) {
+		if (k & 1)
+			result *= x;
+		x *= x;
+		k >>= 1;
+	}
+	return result;
+}
 
-    a = b;  fa = fb;			/* Save the previous approx.	*/
-    b += new_step;  fb = (*f)(dummy,b)-target;	/* Do step to a new approxim.	*/
-    if( (fb > 0 && fc > 0) || (fb < 0 && fc < 0) )
-    {                 			/* Adjust c for it to have a sign*/
-      c = a;  fc = fa;                  /* opposite to that of b	*/
-    }
-  }
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a polynomial in two variables with integer exponents
+///
+/// This is the form shared by the IAPWS-IF97 backward equations, sum(n[i] * x^I[i] * y^J[i]).
+///
+/// \param[in] I exponents of x
+/// \param[in] J exponents of y
+/// \param[in] n coefficients
+/// \param[in] count length of the I, J, and n arrays
+/// \param[in] x first variable
+/// \param[in] y second variable
+///
+/// \return value of the polynomial
+///////////////////////////////////////////////////////////////////////////////
+double power_series(const int I[], const int J[], const double n[], int count, double x, double y)
+{
+	double result = 0;
+	for (int i=0; i<count; i++) {
+		result += n[i] * ipow(x, I[i]) * ipow(y, J[i]);
+	}
+	return result;
+}
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief refines an estimate of the root of [f(a,x) - target] using Newton's method
+///
+/// Intended to polish the result of a backward equation, which is already close to
+/// the root.  The iteration gives up, rather than bisecting, as soon as an iterate
+/// leaves the range [ax,bx] so that the caller can fall back to a bracketing method.
+///
+/// Convergence is declared once a step is smaller than 1E-12 times the root; because
+/// Newton's method converges quadratically the last iterate is then accurate to
+/// roughly machine precision.
+///
+/// \param[in] *f function under investigation, returning f(a,x) and its derivative with
+///  respect to x
+/// \param[in] dummy fixed value of first argument to function under investigation
+/// \param[in] ax lower end of the acceptable range for x
+/// \param[in] bx upper end of the acceptable range for x
+/// \param[in] target value of f(a,x) corresponding to the desired root
+/// \param[in,out] x initial estimate of the root on input, refined root on output
+/// \param[out] iterations if not 0, receives the number of iterations (each one
+///  evaluation of f)
+///
+/// \return true if the iteration converged to a root within [ax,bx]
+///////////////////////////////////////////////////////////////////////////////
+bool newton2(void (*f)(double, double, double &, double &), double dummy, double ax, double bx, double target, double &x, int *iterations)
+{
+	const int max_iter = 8;
+	double root = x;
+	for (int iter=0; iter<max_iter; iter++) {
+		double value, slope;
+		(*f)(dummy, root, value, slope);
+		double step = (value - target) / slope;
+		root -= step;
+		if (iterations)
+			*iterations = iter + 1;
+		if (!(root >= ax && root <= bx))
+			return false;
+		if (fabs(step) <= 1E-12*fabs(root)) {
+			x = root;
+			return true;
+		}
+	}
+	return false;
 }
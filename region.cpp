@@ -35,13 +35,14 @@
 ///
 /// \param[in] pressure requested pressure
 ///
-/// \exception std::exception "input pressure out of bounds"
+/// \return STATUS_OK, or STATUS_INPUT_PRESSURE if there is no saturation temperature
 ///////////////////////////////////////////////////////////////////////////////
-void check_saturated_p(double pressure)
+Status check_saturated_p(double pressure)
 {
 	// check for validity of pressure
 	if ((pressure < PT) || (pressure > PC))
-		throw "input pressure out of bounds";
+		return STATUS_INPUT_PRESSURE;
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -49,97 +50,200 @@ void check_saturated_p(double pressure)
 ///
 /// \param[in] temperature requested temperature
 ///
-/// \exception std::exception "input temperature out of bounds"
+/// \return STATUS_OK, or STATUS_INPUT_TEMPERATURE if there is no saturation pressure
 ///////////////////////////////////////////////////////////////////////////////
-void check_saturated_t(double temperature)
+Status check_saturated_t(double temperature)
 {
 	// check for validity of temperature
 	if ((temperature < TT) || (temperature > TC))
-		throw "input temperature out of bounds";
+		return STATUS_INPUT_TEMPERATURE;
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief determines the IAPWS region that contains a given pressure, temperature
+/// \brief determines the IAPWS region that contains a given pressure, temperature,
+///  without raising an exception
 ///
 /// \param[in] pressure requested pressure
 /// \param[in] temperature requested temperature
-/// \return IAPWS region number 1, 2, 3, or 5
-/// \exception std::exception "pressure out of bounds"
-/// \exception std::exception "temperature out of bounds"
-/// \exception std::exception "pressure/temperature combination out of bounds"
+/// \param[out] region IAPWS region number 1, 2, 3, or 5
+///
+/// \return STATUS_OK, STATUS_PRESSURE, STATUS_TEMPERATURE, or STATUS_PRESSURE_TEMPERATURE
 ///////////////////////////////////////////////////////////////////////////////
-int region_pt(double pressure, double temperature)
+Status region_pt_status(double pressure, double temperature, int &region)
 {
 	// check for gross boundary violations
 	if ((pressure > 100) || (pressure <= 0))
-		throw "pressure out of bounds";
+		return STATUS_PRESSURE;
 	if ((temperature > 2273.15) || (temperature < 273.15))
-		throw "temperature out of bounds";
+		return STATUS_TEMPERATURE;
 	// the following is set to ensure that just a wee bit of conversion error doesn't invalidate
 	// a temp of 1073.15 and pressure aboe 50 MPa
 	if ((temperature > 1073.15) && (pressure > 50))
-		throw "pressure/temperature combination out of bounds";
+		return STATUS_PRESSURE_TEMPERATURE;
 	// check for Region 1 (note that outer boundaries have already been checked)
 	if ((temperature <= 623.15) && (pressure >= PSAT_T(temperature)))
-		return 1;
+		region = 1;
 	// check for Region 2
-	if ((temperature <= 623.15) && (pressure <= PSAT_T(temperature)))
-		return 2;
-	if ((temperature <= 863.15) && (pressure <= b23_p_t(temperature)))
-		return 2;
-	if ((temperature <= 863.15) && (pressure > b23_p_t(temperature)))
-		return 3;
-	if (temperature <= 1073.15)
-		return 2;
+	else if ((temperature <= 623.15) && (pressure <= PSAT_T(temperature)))
+		region = 2;
+	else if ((temperature <= 863.15) && (pressure <= b23_p_t(temperature)))
+		region = 2;
+	else if ((temperature <= 863.15) && (pressure > b23_p_t(temperature)))
+		region = 3;
+	else if (temperature <= 1073.15)
+		region = 2;
 	// check for Region 5 (easiest one)
-	if (temperature > 1073.15)
-		return 5;
-	return 3;
+	else if (temperature > 1073.15)
+		region = 5;
+	else
+		region = 3;
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief determines the IAPWS region that contains a given pressure, enthalpy
+/// \brief determines the IAPWS region that contains a given pressure, temperature
 ///
 /// \param[in] pressure requested pressure
-/// \param[in] enthalpy requested enthalpy
-/// \return IAPWS region number 1, 2, 3, 4, or 5
+/// \param[in] temperature requested temperature
+/// \return IAPWS region number 1, 2, 3, or 5
 /// \exception std::exception "pressure out of bounds"
-/// \exception std::exception "enthalpy out of bounds"
+/// \exception std::exception "temperature out of bounds"
+/// \exception std::exception "pressure/temperature combination out of bounds"
 ///////////////////////////////////////////////////////////////////////////////
-int region_ph(double pressure, double enthalpy)
+int region_pt(double pressure, double temperature)
+{
+	int region = 0;
+	switch (region_pt_status(pressure, temperature, region)) {
+		case STATUS_PRESSURE:
+			throw "pressure out of bounds";
+		case STATUS_TEMPERATURE:
+			throw "temperature out of bounds";
+		case STATUS_PRESSURE_TEMPERATURE:
+			throw "pressure/temperature combination out of bounds";
+		default:
+			return region;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief determines the IAPWS region that contains a given pressure, enthalpy,
+///  without raising an exception
+///
+/// \param[in] pressure requested pressure
+/// \param[in] enthalpy requested enthalpy
+/// \param[out] region IAPWS region number 1, 2, 3, 4, or 5
+///
+/// \return STATUS_OK, STATUS_PRESSURE, or STATUS_ENTHALPY
+///////////////////////////////////////////////////////////////////////////////
+Status region_ph_status(double pressure, double enthalpy, int &region)
 {
 	// check for gross boundary violations
 	if ((pressure > 100) || (pressure <= 0))
-		throw "pressure out of bounds";
+		return STATUS_PRESSURE;
 	if (pressure <= 16.5292 ) {
 		// don't need to worry about region 3
 		double test_enthalpy = h_pt_5(pressure, 2273.15)+1;
 		if (enthalpy > test_enthalpy)
-			throw "enthalpy out of bounds";
+			return STATUS_ENTHALPY;
 		if (enthalpy > h_pt_2(pressure, 1073.15))
-			return 5;
-		if (enthalpy >= h_pt_2(pressure, TSAT_P(pressure)))
-			return 2;
-		if (enthalpy > h_pt_1(pressure, TSAT_P(pressure)))
-			return 4;
-		if (enthalpy < h_pt_1(pressure, 273.15))
-			throw "enthalpy out of bounds";
-		return 1;
+			region = 5;
+		else if (enthalpy >= h_pt_2(pressure, TSAT_P(pressure)))
+			region = 2;
+		else if (enthalpy > h_pt_1(pressure, TSAT_P(pressure)))
+			region = 4;
+		else if (enthalpy < h_pt_1(pressure, 273.15))
+			return STATUS_ENTHALPY;
+		else
+			region = 1;
 	}
 	else {
 		if (enthalpy <= h_pt_1(pressure, 623.15))
-			return 1;
-		if (enthalpy <= h_pt_2(pressure, b23_t_p(pressure)))
-			return 3;
-		if (enthalpy <= h_pt_2(pressure, 1073.15)+1)
-			return 2;
-		if (pressure > 50) 
-			throw "enthalpy out of bounds";
+			region = 1;
+		else if (enthalpy <= h_pt_2(pressure, b23_t_p(pressure)))
+			region = 3;
+		else if (enthalpy <= h_pt_2(pressure, 1073.15)+1)
+			region = 2;
+		else if (pressure > 50) 
+			return STATUS_ENTHALPY;
 		else {
 			double test_enthalpy = h_pt_5(pressure,2273.15)+1;
 			if (enthalpy > test_enthalpy)
-				throw "enthalpy out of bounds";
-			return 5;
+				return STATUS_ENTHALPY;
+			region = 5;
 		}
 	}
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief determines the IAPWS region that contains a given pressure, enthalpy
+///
+/// \param[in] pressure requested pressure
+/// \param[in] enthalpy requested enthalpy
+/// \return IAPWS region number 1, 2, 3, 4, or 5
+/// \exception std::exception "pressure out of bounds"
+/// \exception std::exception "enthalpy out of bounds"
+///////////////////////////////////////////////////////////////////////////////
+int region_ph(double pressure, double enthalpy)
+{
+	int region = 0;
+	switch (region_ph_status(pressure, enthalpy, region)) {
+		case STATUS_PRESSURE:
+			throw "pressure out of bounds";
+		case STATUS_ENTHALPY:
+			throw "enthalpy out of bounds";
+		default:
+			return region;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief determines the IAPWS region that contains a given pressure, entropy,
+///  without raising an exception
+///
+/// As for pressure and enthalpy, Region 4 stops at the pressure of the Region 1/3
+/// boundary; the two-phase states above it belong to Region 3.
+///
+/// \param[in] pressure requested pressure
+/// \param[in] entropy requested specific entropy
+/// \param[out] region IAPWS region number 1, 2, 3, 4, or 5
+///
+/// \return STATUS_OK, STATUS_PRESSURE, or STATUS_ENTROPY
+///////////////////////////////////////////////////////////////////////////////
+Status region_ps_status(double pressure, double entropy, int &region)
+{
+	// check for gross boundary violations
+	if ((pressure > 100) || (pressure <= 0))
+		return STATUS_PRESSURE;
+	if (entropy < s_pt_1(pressure, 273.15))
+		return STATUS_ENTROPY;
+	if (pressure <= 16.5292) {
+		// don't need to worry about region 3
+		double t_sat = TSAT_P(pressure);
+		// allow the same 1 K of round-off that the T(p,s) solvers bracket
+		if (entropy > s_pt_5(pressure, 2273.15+1))
+			return STATUS_ENTROPY;
+		if (entropy > s_pt_2(pressure, 1073.15))
+			region = 5;
+		else if (entropy >= s_pt_2(pressure, t_sat))
+			region = 2;
+		else if (entropy > s_pt_1(pressure, t_sat))
+			region = 4;
+		else
+			region = 1;
+	}
+	else {
+		if (entropy <= s_pt_1(pressure, 623.15))
+			region = 1;
+		else if (entropy <= s_pt_2(pressure, b23_t_p(pressure)))
+			region = 3;
+		else if (entropy <= s_pt_2(pressure, 1073.15+1))
+			region = 2;
+		else if ((pressure > 50) || (entropy > s_pt_5(pressure, 2273.15+1)))
+			return STATUS_ENTROPY;
+		else
+			region = 5;
+	}
+	return STATUS_OK;
 }
@@ -29,6 +29,8 @@
 
 #include "iapws.h"
 #include<math.h>
+#include <vector>
+#include "simd.h"
 #include "utilities.h"
 
 ////////////////////////////////////////////////////////
@@ -83,6 +85,231 @@ const double n[REG1_COUNT] = {
             -0.11947622640071E-22, 0.18228094581404E-23, -0.93537087292458E-25
         };
 
+////////////////////////////////////////////////////////
+///	\brief Largest reduced pressure exponent in I.
+////////////////////////////////////////////////////////
+#define REG1_I_MAX 32
+
+////////////////////////////////////////////////////////
+///	\brief Smallest and largest reduced temperature exponents in J.
+////////////////////////////////////////////////////////
+#define REG1_J_MIN -41
+#define REG1_J_MAX 17
+
+// The series below is shared by the scalar and the batch evaluations, so both give
+// the same results to the last bit.  Contracting a multiply and an add into a fused
+// multiply-add depends on the instruction set of each function, so it is turned off;
+// clang, which also defines __GNUC__, gets its own pragma and is put back to its default.
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief sums the dimensionless Gibbs free energy series and all of its first and
+///  second order partial derivatives for IAPWS Region 1
+///
+/// The series is evaluated in a single pass over the exponent and coefficient
+/// arrays.  Integer powers of (7.1 - pi) and (tau - 1.222) are built once by
+/// repeated multiplication rather than with a pair of calls to pow() per term.
+/// Each table also holds the two powers below the smallest exponent so that the
+/// derivative terms need no special cases (terms with a zero exponent are
+/// multiplied by that zero exponent).
+///
+/// V is either double or a vector of doubles, one statepoint per lane.
+///
+/// \param[in] pi reduced pressure
+/// \param[in] tau reduced temperature
+/// \param[out] g dimensionless Gibbs free energy and its partial derivatives, in the
+///  order of the members of Gibbs
+///////////////////////////////////////////////////////////////////////////////
+template <class V>
+static ALWAYS_INLINE void gibbs_1_series(const V &pi, const V &tau, V g[6])
+{
+	const V zero = V();
+	V x = 7.1 - pi;
+	V y = tau - 1.222;
+	// xpow[k + 2] = x^k for k = -2 ... REG1_I_MAX
+	V xpow[REG1_I_MAX + 3];
+	xpow[2] = zero + 1.0;
+	for (int k=3; k<REG1_I_MAX+3; k++)
+		xpow[k] = xpow[k-1] * x;
+	xpow[1] = 1.0 / x;
+	xpow[0] = xpow[1] / x;
+	// ypow[k - REG1_J_MIN + 2] = y^k for k = REG1_J_MIN-2 ... REG1_J_MAX
+	const int yzero = 2 - REG1_J_MIN;
+	V ypow[REG1_J_MAX - REG1_J_MIN + 3];
+	V yinv = 1.0 / y;
+	ypow[yzero] = xpow[2];
+	for (int k=yzero+1; k<REG1_J_MAX-REG1_J_MIN+3; k++)
+		ypow[k] = ypow[k-1] * y;
+	for (int k=yzero-1; k>=0; k--)
+		ypow[k] = ypow[k+1] * yinv;
+
+	V gamma = zero;
+	V gammapi = zero;
+	V gammapipi = zero;
+	V gammatau = zero;
+	V gammatautau = zero;
+	V gammapitau = zero;
+	for (int i=0; i<REG1_COUNT; i++) {
+		const V *xi = &xpow[I[i] + 2];
+		const V *yj = &ypow[J[i] + yzero];
+		double ni = n[i];
+		double nI = ni * I[i];
+		double nJ = ni * J[i];
+		gamma += ni * xi[0] * yj[0];
+		gammapi -= nI * xi[-1] * yj[0];
+		gammapipi += nI * (I[i] - 1) * xi[-2] * yj[0];
+		gammatau += nJ * xi[0] * yj[-1];
+		gammatautau += nJ * (J[i] - 1) * xi[0] * yj[-2];
+		gammapitau -= nI * J[i] * xi[-1] * yj[-1];
+	}
+	g[0] = gamma;
+	g[1] = gammapi;
+	g[2] = gammapipi;
+	g[3] = gammatau;
+	g[4] = gammatautau;
+	g[5] = gammapitau;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the dimensionless Gibbs free energy and all of its first and
+///  second order partial derivatives for IAPWS Region 1
+///
+/// \param[in] pi reduced pressure
+/// \param[in] tau reduced temperature
+/// \param[out] g dimensionless Gibbs free energy and its partial derivatives
+///////////////////////////////////////////////////////////////////////////////
+void gibbs_1(double pi, double tau, Gibbs &g)
+{
+	double sums[6];
+	gibbs_1_series(pi, tau, sums);
+	g.gamma = sums[0];
+	g.gammapi = sums[1];
+	g.gammapipi = sums[2];
+	g.gammatau = sums[3];
+	g.gammatautau = sums[4];
+	g.gammapitau = sums[5];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the dimensionless Gibbs free energy and its partial derivatives
+///  for IAPWS Region 1 at an array of statepoints, one statepoint per lane of a vector
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] g array that receives the Gibbs free energy and its partial derivatives
+/// \param[in] count number of elements in the pi, tau, and g arrays
+///////////////////////////////////////////////////////////////////////////////
+template <class V, int LANES>
+static ALWAYS_INLINE void gibbs_1_lanes(const double pi[], const double tau[], Gibbs g[], long count)
+{
+	long i = 0;
+	for (; i+LANES<=count; i+=LANES) {
+		V vpi;
+		V vtau;
+		for (int lane=0; lane<LANES; lane++) {
+			vpi[lane] = pi[i+lane];
+			vtau[lane] = tau[i+lane];
+		}
+		V sums[6];
+		gibbs_1_series(vpi, vtau, sums);
+		for (int lane=0; lane<LANES; lane++) {
+			g[i+lane].gamma = sums[0][lane];
+			g[i+lane].gammapi = sums[1][lane];
+			g[i+lane].gammapipi = sums[2][lane];
+			g[i+lane].gammatau = sums[3][lane];
+			g[i+lane].gammatautau = sums[4][lane];
+			g[i+lane].gammapitau = sums[5][lane];
+		}
+	}
+	for (; i<count; i++)
+		gibbs_1(pi[i], tau[i], g[i]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates the Region 1 Gibbs free energy one statepoint at a time
+///
+/// Used where the processor or compiler offers no vector instructions.
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] g array that receives the Gibbs free energy and its partial derivatives
+/// \param[in] count number of elements in the pi, tau, and g arrays
+///////////////////////////////////////////////////////////////////////////////
+static void gibbs_1_scalar(const double pi[], const double tau[], Gibbs g[], long count)
+{
+	for (long i=0; i<count; i++)
+		gibbs_1(pi[i], tau[i], g[i]);
+}
+
+#ifdef WATPROP_SIMD
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates the Region 1 Gibbs free energy four statepoints at a time with AVX2
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] g array that receives the Gibbs free energy and its partial derivatives
+/// \param[in] count number of elements in the pi, tau, and g arrays
+///////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx2")))
+static void gibbs_1_avx2(const double pi[], const double tau[], Gibbs g[], long count)
+{
+	gibbs_1_lanes<double4, 4>(pi, tau, g, count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates the Region 1 Gibbs free energy eight statepoints at a time with AVX-512
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] g array that receives the Gibbs free energy and its partial derivatives
+/// \param[in] count number of elements in the pi, tau, and g arrays
+///////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx512f")))
+static void gibbs_1_avx512(const double pi[], const double tau[], Gibbs g[], long count)
+{
+	gibbs_1_lanes<double8, 8>(pi, tau, g, count);
+}
+#endif
+
+#if defined(__clang__)
+#pragma clang fp contract(on)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief pointer to a function that evaluates the Region 1 Gibbs free energy over arrays
+///////////////////////////////////////////////////////////////////////////////
+typedef void (*GibbsBatch)(const double pi[], const double tau[], Gibbs g[], long count);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the dimensionless Gibbs free energy and all of its first and
+///  second order partial derivatives for IAPWS Region 1 at an array of statepoints
+///
+/// Several statepoints are evaluated at once in the lanes of the widest vector
+/// instructions that the processor supports (AVX-512 or AVX2), chosen the first
+/// time that this is called.  The results are identical to those of gibbs_1.
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] g array that receives the Gibbs free energy and its partial derivatives
+/// \param[in] count number of elements in the pi, tau, and g arrays
+///////////////////////////////////////////////////////////////////////////////
+void gibbs_1_batch(const double pi[], const double tau[], Gibbs g[], long count)
+{
+#ifdef WATPROP_SIMD
+	static const GibbsBatch kernel = select_kernel<GibbsBatch>(gibbs_1_scalar, gibbs_1_avx2, gibbs_1_avx512);
+#else
+	static const GibbsBatch kernel = gibbs_1_scalar;
+#endif
+	kernel(pi, tau, g, count);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief calculates dimensionless Gibbs free energy for IAPWS Region 1
 ///
@@ -93,11 +320,9 @@ const double n[REG1_COUNT] = {
 ///////////////////////////////////////////////////////////////////////////////
 double gamma(double pi, double tau)
 {
-	double answer = 0;
-	for (int i=0; i<REG1_COUNT; i++) {
-		answer += n[i] * pow(7.1 - pi,I[i]) * pow(tau - 1.222,J[i]);
-	}
-	return answer;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return g.gamma;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -112,11 +337,9 @@ double gamma(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammapi(double pi, double tau)
 {
-	double answer = 0;
-	for (int i=0; i<REG1_COUNT; i++) {
-		answer += (-n[i] * I[i] * pow(7.1 - pi,I[i]-1) * pow(tau - 1.222,J[i]));
-	}
-	return answer;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return g.gammapi;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -131,11 +354,9 @@ double gammapi(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammapipi(double pi, double tau)
 {
-	double answer = 0;
-	for (int i=0; i<REG1_COUNT; i++) {
-		answer += n[i] * I[i] * (I[i] - 1) * pow(7.1 - pi, I[i] - 2) * pow(tau - 1.222, J[i]);
-	}
-	return answer;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return g.gammapipi;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -150,11 +371,9 @@ double gammapipi(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammatau(double pi, double tau)
 {
-	double answer = 0;
-	for (int i=0; i<REG1_COUNT; i++) {
-		answer += n[i] * pow(7.1 - pi, I[i]) * J[i] * pow(tau - 1.222, J[i] - 1);
-	}
-	return answer;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return g.gammatau;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -169,11 +388,9 @@ double gammatau(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammatautau(double pi, double tau)
 {
-	double answer = 0;
-	for (int i=0; i<REG1_COUNT; i++) {
-		answer += n[i] * pow(7.1 - pi, I[i]) * J[i] * (J[i] -1) * pow(tau - 1.222, J[i] - 2);
-	}
-	return answer;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return g.gammatautau;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -188,11 +405,88 @@ double gammatautau(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammapitau(double pi, double tau)
 {
-	double answer = 0;
-	for (int i=0; i<REG1_COUNT; i++) {
-		answer += -n[i] * I[i] * pow(7.1 - pi, I[i] -1) * J[i] * pow(tau - 1.222, J[i] - 1);
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return g.gammapitau;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all thermodynamic properties from the Gibbs free energy in
+///  IAPWS Region 1
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[in] g  dimensionless Gibbs free energy and its partial derivatives at p, t
+/// \param[out] state thermodynamic properties
+///////////////////////////////////////////////////////////////////////////////
+static void state_gibbs_1(double p, double t, const Gibbs &g, StatePT &state)
+{
+	double tau = tstar/t;
+	double pi = p/pstar;
+	double zip = g.gammapi - tau*g.gammapitau;
+	// note that p has units of MPa, so multiply by 1E3 to get the proper units
+	state.v = pi * g.gammapi * R * t /(p*1E3);
+	state.s = (tau * g.gammatau - g.gamma) * R;
+	state.h = tau * g.gammatau * R * t;
+	state.cp = -tau*tau * g.gammatautau * R;
+	state.cv = (-tau*tau * g.gammatautau + zip*zip/g.gammapipi) * R;
+	// note that 1E3 added to make the units work
+	state.w = sqrt(g.gammapi*g.gammapi/(zip*zip/(tau*tau*g.gammatautau) - g.gammapipi) * R * t * 1E3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all thermodynamic properties as a function of pressure and temperature
+///  in IAPWS Region 1
+///
+/// Each derivative of the Gibbs free energy is evaluated once and shared by all
+/// of the properties.  Transport properties are not calculated.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] state thermodynamic properties
+///////////////////////////////////////////////////////////////////////////////
+void state_pt_1(double p, double t, StatePT &state)
+{
+	Gibbs g;
+	gibbs_1(p/pstar, tstar/t, g);
+	state_gibbs_1(p, t, g, state);
+}
+
+////////////////////////////////////////////////////////
+///	\brief Number of statepoints passed to the Gibbs free energy kernel at a time.
+////////////////////////////////////////////////////////
+#define REG1_BATCH_BLOCK 64
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all thermodynamic properties at an array of pressures and
+///  temperatures in IAPWS Region 1
+///
+/// The Gibbs free energy is evaluated several statepoints at a time by
+/// gibbs_1_batch, so the results are identical to those of state_pt_1.
+/// Transport properties are not calculated.
+///
+/// \param[in] p  array of pressures
+/// \param[in] t  array of temperatures
+/// \param[out] state array that receives the thermodynamic properties
+/// \param[in] count number of elements in the p, t, and state arrays
+///////////////////////////////////////////////////////////////////////////////
+void state_pt_1_batch(const double p[], const double t[], StatePT state[], long count)
+{
+	double pi[REG1_BATCH_BLOCK];
+	double tau[REG1_BATCH_BLOCK];
+	Gibbs g[REG1_BATCH_BLOCK];
+	for (long begin=0; begin<count; begin+=REG1_BATCH_BLOCK) {
+		long size = count - begin;
+		if (size > REG1_BATCH_BLOCK)
+			size = REG1_BATCH_BLOCK;
+		for (long i=0; i<size; i++) {
+			pi[i] = p[begin+i]/pstar;
+			tau[i] = tstar/t[begin+i];
+		}
+		gibbs_1_batch(pi, tau, g, size);
+		for (long i=0; i<size; i++)
+			state_gibbs_1(p[begin+i], t[begin+i], g[i], state[begin+i]);
 	}
-	return answer;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -208,7 +502,9 @@ double v_pt_1(double p,double t)
 	double tau = tstar/t;
 	double pi = p/pstar;
 	// note that p has units of MPa, so multiply by 1E3 to get the proper units
-	return pi * gammapi(pi,tau) * R * t /(p*1E3);
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return pi * g.gammapi * R * t /(p*1E3);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -223,7 +519,9 @@ double s_pt_1(double p,double t)
 {
 	double tau = tstar/t;
 	double pi = p/pstar;
-	return (tau * gammatau(pi,tau) - gamma(pi,tau)) * R;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return (tau * g.gammatau - g.gamma) * R;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -238,7 +536,9 @@ double h_pt_1(double p,double t)
 {
 	double tau = tstar/t;
 	double pi = p/pstar;
-	return tau * gammatau(pi,tau) * R * t;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return tau * g.gammatau * R * t;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -253,7 +553,9 @@ double cp_pt_1(double p,double t)
 {
 	double tau = tstar/t;
 	double pi = p/pstar;
-	return -tau*tau * gammatautau(pi,tau) * R;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	return -tau*tau * g.gammatautau * R;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -268,8 +570,10 @@ double cv_pt_1(double p,double t)
 {
 	double tau = tstar/t;
 	double pi = p/pstar;
-	double part1 = -tau*tau * gammatautau(pi,tau);
-	double part2 = pow(gammapi(pi,tau) - tau*gammapitau(pi,tau),2)/gammapipi(pi,tau);
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	double part1 = -tau*tau * g.gammatautau;
+	double part2 = pow(g.gammapi - tau*g.gammapitau,2)/g.gammapipi;
 	return (part1 + part2 ) * R;
 }
 
@@ -285,15 +589,98 @@ double w_pt_1(double p,double t)
 {
 	double tau = tstar/t;
 	double pi = p/pstar;
-	double result = (pow(gammapi(pi,tau),2)/(
-		pow(gammapi(pi,tau) - tau*gammapitau(pi,tau),2)/(tau*tau*gammatautau(pi,tau)) - gammapipi(pi,tau))) *R*t;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	double result = (pow(g.gammapi,2)/(
+		pow(g.gammapi - tau*g.gammapitau,2)/(tau*tau*g.gammatautau) - g.gammapipi)) *R*t;
 	// note that 1E3 added to make the units work
 	return pow(result*1E3,0.5);
 }
 
+//------------------------------------------------------------------------------
+// BACKWARD EQUATION T(p,h)
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,h).
+////////////////////////////////////////////////////////
+#define REG1_TPH_COUNT 20
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,h) in IAPWS Region 1.
+////////////////////////////////////////////////////////
+const int I_tph[REG1_TPH_COUNT] = {
+                                      0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 3, 3, 4, 5, 6
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation T(p,h) in IAPWS Region 1.
+////////////////////////////////////////////////////////
+const int J_tph[REG1_TPH_COUNT] = {
+                                      0, 1, 2, 6, 22, 32, 0, 1, 2, 3, 4, 10, 32, 10, 32, 10, 32, 32, 32, 32
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,h)
+///  in IAPWS Region 1.
+////////////////////////////////////////////////////////
+const double n_tph[REG1_TPH_COUNT] = {
+            -0.23872489924521E+03, 0.40421188637945E+03, 0.11349746881718E+03,
+            -0.58457616048039E+01, -0.15285482413140E-03, -0.10866707695377E-05, -0.13391744872602E+02,
+            0.43211039183559E+02, -0.54010067170506E+02, 0.30535892203916E+02, -0.65964749423638E+01,
+            0.93965400878363E-02, 0.11573647505340E-06, -0.25858641282073E-04, -0.40644363084799E-08,
+            0.66456186191635E-07, 0.80670734103027E-10, -0.93477771213947E-12, 0.58265442020601E-14,
+            -0.15020185953503E-16
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific enthalpy in IAPWS Region 1
+///  using the IAPWS-IF97 backward equation
+///
+/// The backward equation agrees with the inverse of the forward equation to within
+/// 25 mK.
+///
+/// \param[in] p  pressure
+/// \param[in] h  specific enthalpy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double backward_t_ph_1(double p, double h)
+{
+	// reference quantities are p* = 1 MPa, h* = 2500 kJ/kg, and T* = 1 K
+	double eta = h / 2500;
+	return power_series(I_tph, J_tph, n_tph, REG1_TPH_COUNT, p, eta + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific enthalpy and isobaric heat capacity as a function of
+///  pressure and temperature in IAPWS Region 1
+///
+/// Provides the value and slope of h(T) for Newton iteration on temperature.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] h  specific enthalpy
+/// \param[out] cp isobaric heat capacity
+///////////////////////////////////////////////////////////////////////////////
+static void h_cp_pt_1(double p, double t, double &h, double &cp)
+{
+	double pi = p / pstar;
+	double tau = tstar / t;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	h = tau*g.gammatau *R*t;
+	cp = -pow(tau,2)*g.gammatautau * R;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief calculates temperature as a function of pressure and specific enthalpy in IAPWS Region 1
 ///
+/// By default the forward equation is inverted with Brent's method.  The backward_ph
+/// setting selects the backward equation instead, either on its own or as the starting
+/// point of a Newton iteration on the forward equation.
+///
 /// \param[in] p  pressure
 /// \param[in] h  specific enthalpy
 ///
@@ -301,13 +688,78 @@ double w_pt_1(double p,double t)
 ///////////////////////////////////////////////////////////////////////////////
 double t_ph_1(double p, double h)
 {
+	BackwardMode mode = active_settings().backward_ph;
+	if (mode == BACKWARD_DIRECT)
+		return backward_t_ph_1(p, h);
 	double t_low = 273.15 - 1;
 	double t_high;
 	if (p < 16.5292)
 		t_high = TSAT_P(p) + 1;
 	else
 		t_high = 623.15 + 1;
-	return zeroin2(h_pt_1, p, t_low, t_high, h, tolerance);
+	if (mode == BACKWARD_POLISH) {
+		double t = backward_t_ph_1(p, h);
+		if (newton_polish(h_cp_pt_1, p, t_low, t_high, h, t))
+			return t;
+	}
+	return zeroin_active(SOLVER_T_PH_1, [p](double t) { return h_pt_1(p, t); }, t_low, t_high, h, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific enthalpy at arrays of pressure and temperature in
+///  IAPWS Region 1 with the vectorized Gibbs free energy kernel
+///
+/// \param[in] p  array of pressures
+/// \param[in] t  array of temperatures
+/// \param[out] h array that receives the specific enthalpies
+/// \param[in] count number of elements in the p, t, and h arrays
+///////////////////////////////////////////////////////////////////////////////
+static void h_pt_1_batch(const double p[], const double t[], double h[], long count)
+{
+	double pi[REG1_BATCH_BLOCK];
+	double tau[REG1_BATCH_BLOCK];
+	Gibbs g[REG1_BATCH_BLOCK];
+	for (long begin=0; begin<count; begin+=REG1_BATCH_BLOCK) {
+		long size = count - begin;
+		if (size > REG1_BATCH_BLOCK)
+			size = REG1_BATCH_BLOCK;
+		for (long i=0; i<size; i++) {
+			pi[i] = p[begin+i]/pstar;
+			tau[i] = tstar/t[begin+i];
+		}
+		gibbs_1_batch(pi, tau, g, size);
+		for (long i=0; i<size; i++)
+			h[begin+i] = tau[i] * g[i].gammatau * R * t[begin+i];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature at arrays of pressure and specific enthalpy in
+///  IAPWS Region 1 by inverting the forward equation with Brent's method
+///
+/// All of the statepoints are iterated in lock step (zeroin_batch) so that the
+/// forward equation is evaluated by the vectorized Gibbs free energy kernel.  The
+/// temperatures are identical to those of t_ph_1 when backward_ph is BACKWARD_OFF,
+/// whatever the setting, and the search has the same tolerance and iteration limit.
+///
+/// \param[in] p  array of pressures
+/// \param[in] h  array of specific enthalpies
+/// \param[out] t array that receives the temperatures, or NaN where the search failed
+/// \param[in] count number of elements in the p, h, and t arrays
+///
+/// \return number of statepoints where the search failed
+///////////////////////////////////////////////////////////////////////////////
+long t_ph_1_batch(const double p[], const double h[], double t[], long count)
+{
+	std::vector<double> t_low(count, 273.15 - 1);
+	std::vector<double> t_high(count);
+	for (long i=0; i<count; i++) {
+		if (p[i] < 16.5292)
+			t_high[i] = TSAT_P(p[i]) + 1;
+		else
+			t_high[i] = 623.15 + 1;
+	}
+	return zeroin_batch_active(SOLVER_T_PH_1, h_pt_1_batch, p, t_low.data(), t_high.data(), h, tolerance, t, count);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -337,3 +789,230 @@ double s_ph_1(double p, double h)
 	double t = t_ph_1(p, h);
 	return s_pt_1(p, t);
 }
+
+//------------------------------------------------------------------------------
+// BACKWARD EQUATION T(p,s)
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,s)
+///  in IAPWS Region 1.
+////////////////////////////////////////////////////////
+#define REG1_TPS_COUNT 20
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,s) in IAPWS Region 1.
+////////////////////////////////////////////////////////
+const int I_tps[REG1_TPS_COUNT] = {
+                                      0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 4
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation T(p,s) in IAPWS Region 1.
+////////////////////////////////////////////////////////
+const int J_tps[REG1_TPS_COUNT] = {
+                                      0, 1, 2, 3, 11, 31, 0, 1, 2, 3, 12, 31, 0, 1, 2, 9, 31, 10, 32, 32
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,s)
+///  in IAPWS Region 1.
+////////////////////////////////////////////////////////
+const double n_tps[REG1_TPS_COUNT] = {
+            0.17478268058307E+03, 0.34806930892873E+02, 0.65292584978455E+01, 0.33039981775489E+00,
+            -0.19281382923196E-06, -0.24909197244573E-22, -0.26107636489332E+00, 0.22592965981586E+00,
+            -0.64256463395226E-01, 0.78876289270526E-02, 0.35672110607366E-09, 0.17332496994895E-23,
+            0.56608900654837E-03, -0.32635483139717E-03, 0.44778286690632E-04, -0.51322156908507E-09,
+            -0.42522657042207E-25, 0.26400441360689E-12, 0.78124600459723E-28, -0.30732199903668E-30
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy in IAPWS Region 1
+///  using the IAPWS-IF97 backward equation
+///
+/// The backward equation agrees with the inverse of the forward equation to within
+/// 25 mK.
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double backward_t_ps_1(double p, double s)
+{
+	// reference quantities are p* = 1 MPa, s* = 1 kJ/kg/K, and T* = 1 K
+	return power_series(I_tps, J_tps, n_tps, REG1_TPS_COUNT, p, s + 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific entropy and its derivative with respect to temperature
+///  as a function of pressure and temperature in IAPWS Region 1
+///
+/// Provides the value and slope (cp/T) of s(T) for Newton iteration on temperature.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] s  specific entropy
+/// \param[out] slope derivative of specific entropy with respect to temperature
+///////////////////////////////////////////////////////////////////////////////
+static void s_slope_pt_1(double p, double t, double &s, double &slope)
+{
+	double pi = p / pstar;
+	double tau = tstar / t;
+	Gibbs g;
+	gibbs_1(pi, tau, g);
+	s = (tau * g.gammatau - g.gamma) * R;
+	slope = -pow(tau,2)*g.gammatautau * R / t;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy in IAPWS Region 1
+///
+/// The backward equation is the starting point of a Newton iteration on the forward
+/// equation, which gives way to Brent's method if it leaves the region.
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double t_ps_1(double p, double s)
+{
+	double t_low = 273.15 - 1;
+	double t_high;
+	if (p < 16.5292)
+		t_high = TSAT_P(p) + 1;
+	else
+		t_high = 623.15 + 1;
+	double t = backward_t_ps_1(p, s);
+	if (newton_polish(s_slope_pt_1, p, t_low, t_high, s, t))
+		return t;
+	return zeroin_active(SOLVER_T_PS_1, [p](double t) { return s_pt_1(p, t); }, t_low, t_high, s, tolerance);
+}
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation p(h,s)
+///  in IAPWS Region 1.
+////////////////////////////////////////////////////////
+#define REG1_PHS_COUNT 19
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation p(h,s) in IAPWS Region 1 (IAPWS SR2-01).
+////////////////////////////////////////////////////////
+const int I_phs[REG1_PHS_COUNT] = {
+                                      0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 4, 4, 5
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation p(h,s) in IAPWS Region 1.
+////////////////////////////////////////////////////////
+const int J_phs[REG1_PHS_COUNT] = {
+                                      0, 1, 2, 4, 5, 6, 8, 14, 0, 1, 4, 6, 0, 1, 10, 4, 1, 4, 0
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation p(h,s)
+///  in IAPWS Region 1.
+////////////////////////////////////////////////////////
+const double n_phs[REG1_PHS_COUNT] = {
+            -0.691997014660582E+00, -0.183612548787560E+02, -0.928332409297335E+01, 0.659639569909906E+02,
+            -0.162060388912024E+02, 0.450620017338667E+03, 0.854680678224170E+03, 0.607523214001162E+04,
+            0.326487682621856E+02, -0.269408844582931E+02, -0.319947848334300E+03, -0.928354307043320E+03,
+            0.303634537455249E+02, -0.650540422444146E+02, -0.430991316516130E+04, -0.747512324096068E+03,
+            0.730000345529245E+03, 0.114284032569021E+04, -0.436407041874559E+03
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates pressure as a function of specific enthalpy and specific entropy
+///  in IAPWS Region 1 using the IAPWS-IF97 supplementary backward equation
+///
+/// \param[in] h  specific enthalpy
+/// \param[in] s  specific entropy
+///
+/// \return pressure
+///////////////////////////////////////////////////////////////////////////////
+double backward_p_hs_1(double h, double s)
+{
+	// reference quantities are p* = 100 MPa, h* = 3400 kJ/kg, and s* = 7.6 kJ/kg/K
+	return 100 * power_series(I_phs, J_phs, n_phs, REG1_PHS_COUNT, h/3400 + 0.05, s/7.6 + 0.05);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief refines pressure and temperature so that the forward equation reproduces a
+///  given specific enthalpy and specific entropy in IAPWS Region 1
+///
+/// \param[in] h  specific enthalpy
+/// \param[in] s  specific entropy
+/// \param[in,out] p  initial estimate of the pressure on input, refined pressure on output
+/// \param[in,out] t  initial estimate of the temperature on input, refined temperature on output
+/// \param[out] iterations number of iterations
+///
+/// \return true if the iteration converged within the range of Region 1
+///////////////////////////////////////////////////////////////////////////////
+static bool newton_pt_hs_1(double h, double s, double &p, double &t, int &iterations)
+{
+	for (int iter=0; iter<8; iter++) {
+		double pi = p / pstar;
+		double tau = tstar / t;
+		Gibbs g;
+		gibbs_1(pi, tau, g);
+		iterations = iter + 1;
+		// residuals
+		double dh = tau*g.gammatau * R * t - h;
+		double ds = (tau*g.gammatau - g.gamma) * R - s;
+		// Jacobian
+		double h_p = tau*g.gammapitau * R * t / pstar;
+		double h_t = -tau*tau*g.gammatautau * R;
+		double s_p = (tau*g.gammapitau - g.gammapi) * R / pstar;
+		double s_t = h_t / t;
+		double det = h_p*s_t - h_t*s_p;
+		if (det == 0)
+			return false;
+		double step_p = (dh*s_t - h_t*ds) / det;
+		double step_t = (h_p*ds - dh*s_p) / det;
+		p -= step_p;
+		t -= step_t;
+		if (!((p > 0) && (p <= 100 + 1) && (t >= 273.15 - 1) && (t <= 623.15 + 1)))
+			return false;
+		// at low pressure a liquid's enthalpy hardly depends on pressure, which is then
+		// settled once the step changes the enthalpy by no more than round-off
+		bool settled = (fabs(step_p) <= 1E-12*p) || (fabs(h_p*step_p) <= 1E-12*(fabs(h) + 1));
+		if (settled && (fabs(step_t) <= 1E-12*t))
+			return true;
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates pressure and temperature as a function of specific enthalpy and
+///  specific entropy in IAPWS Region 1
+///
+/// The backward equations p(h,s) and T(p,s) are the starting point of a Newton iteration
+/// in pressure and temperature together.
+///
+/// \param[in] h  specific enthalpy
+/// \param[in] s  specific entropy
+/// \param[out] p  pressure
+/// \param[out] t  temperature
+///
+/// \return false if the iteration fails or the statepoint is not in Region 1, in which
+///  case the caller tries the other regions
+///////////////////////////////////////////////////////////////////////////////
+bool state_hs_1(double h, double s, double &p, double &t)
+{
+	// no state in Region 1 has a greater entropy than the saturated liquid at 623.15 K
+	if (s > 3.778281340)
+		return false;
+	p = backward_p_hs_1(h, s);
+	if (!((p > 0) && (p <= 100 + 1)))
+		return false;
+	t = backward_t_ps_1(p, s);
+	int iterations = 0;
+	bool converged = newton_pt_hs_1(h, s, p, t, iterations);
+	RECORD_SOLVE(SOLVER_POLISH, iterations, iterations, 623.15 + 1 - (273.15 - 1), converged);
+	// a liquid must end up at or above the saturation pressure
+	return converged && (p <= 100) && (t >= 273.15) && (t <= 623.15) && (p >= PSAT_T(t));
+}
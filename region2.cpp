@@ -29,6 +29,8 @@
 
 #include "iapws.h"
 #include<math.h>
+#include <vector>
+#include "simd.h"
 #include "utilities.h"
 
 ////////////////////////////////////////////////////////
@@ -113,6 +115,286 @@ const double N[REG2R_COUNT] = {
             -0.12768608934681E-14, 0.73087610595061E-28, 0.55414715350778E-16, -0.94369707241210E-06
         };
 
+////////////////////////////////////////////////////////
+///	\brief Smallest and largest exponents in J0.
+////////////////////////////////////////////////////////
+#define REG2I_J_MIN -5
+#define REG2I_J_MAX 3
+
+////////////////////////////////////////////////////////
+///	\brief Largest exponents in I and J.
+////////////////////////////////////////////////////////
+#define REG2R_I_MAX 24
+#define REG2R_J_MAX 58
+
+// The series below is shared by the scalar and the batch evaluations, so both give
+// the same results to the last bit (see region1.cpp).
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief sums the ideal-gas and residual series of the dimensionless Gibbs free
+///  energy and all of their first and second order partial derivatives for
+///  IAPWS Region 2
+///
+/// Both series are evaluated in a single pass over their exponent and coefficient
+/// arrays.  Integer powers of tau, pi and (tau - 0.5) are built once by repeated
+/// multiplication rather than with calls to pow() per term.  Each table also holds
+/// the two powers below the smallest exponent so that the derivative terms need
+/// no special cases (terms with a zero exponent are multiplied by that zero exponent).
+///
+/// V is either double or a vector of doubles, one statepoint per lane.
+///
+/// \param[in] pi reduced pressure
+/// \param[in] tau reduced temperature
+/// \param[out] ideal ideal-gas portion of the dimensionless Gibbs free energy and
+///  its partial derivatives, in the order of the members of Gibbs
+/// \param[out] residual residual portion of the dimensionless Gibbs free energy and
+///  its partial derivatives, in the order of the members of Gibbs
+///////////////////////////////////////////////////////////////////////////////
+template <class V>
+static ALWAYS_INLINE void gibbs_2_series(const V &pi, const V &tau, V ideal[6], V residual[6])
+{
+	const V zero = V();
+	// ideal-gas series
+	// taupow[k - REG2I_J_MIN + 2] = tau^k for k = REG2I_J_MIN-2 ... REG2I_J_MAX
+	const int tauzero = 2 - REG2I_J_MIN;
+	V taupow[REG2I_J_MAX - REG2I_J_MIN + 3];
+	V tauinv = 1.0 / tau;
+	taupow[tauzero] = zero + 1.0;
+	for (int k=tauzero+1; k<REG2I_J_MAX-REG2I_J_MIN+3; k++)
+		taupow[k] = taupow[k-1] * tau;
+	for (int k=tauzero-1; k>=0; k--)
+		taupow[k] = taupow[k+1] * tauinv;
+
+	V gamma;
+	lane_log(pi, gamma);
+	V gammatau = zero;
+	V gammatautau = zero;
+	for (int i=0; i<REG2I_COUNT; i++) {
+		const V *tj = &taupow[J0[i] + tauzero];
+		double nJ = N0[i] * J0[i];
+		gamma += N0[i] * tj[0];
+		gammatau += nJ * tj[-1];
+		gammatautau += nJ * (J0[i] - 1) * tj[-2];
+	}
+	ideal[0] = gamma;
+	ideal[1] = 1.0 / pi;
+	ideal[2] = -1.0 / (pi*pi);
+	ideal[3] = gammatau;
+	ideal[4] = gammatautau;
+	ideal[5] = zero;
+
+	// residual series
+	// pipow[k + 2] = pi^k for k = -2 ... REG2R_I_MAX
+	V pipow[REG2R_I_MAX + 3];
+	pipow[2] = zero + 1.0;
+	for (int k=3; k<REG2R_I_MAX+3; k++)
+		pipow[k] = pipow[k-1] * pi;
+	pipow[1] = 1.0 / pi;
+	pipow[0] = pipow[1] / pi;
+	// ypow[k + 2] = (tau - 0.5)^k for k = -2 ... REG2R_J_MAX
+	V y = tau - 0.5;
+	V ypow[REG2R_J_MAX + 3];
+	ypow[2] = pipow[2];
+	for (int k=3; k<REG2R_J_MAX+3; k++)
+		ypow[k] = ypow[k-1] * y;
+	// the negative powers only ever multiply a zero exponent, so keep them finite at y = 0
+	ypow[1] = (y != 0) ? 1.0 / y : zero;
+	ypow[0] = (y != 0) ? ypow[1] / y : zero;
+
+	V gammapi = zero;
+	V gammapipi = zero;
+	V gammapitau = zero;
+	gamma = zero;
+	gammatau = zero;
+	gammatautau = zero;
+	for (int i=0; i<REG2R_COUNT; i++) {
+		const V *pii = &pipow[I[i] + 2];
+		const V *yj = &ypow[J[i] + 2];
+		double nI = N[i] * I[i];
+		double nJ = N[i] * J[i];
+		gamma += N[i] * pii[0] * yj[0];
+		gammapi += nI * pii[-1] * yj[0];
+		gammapipi += nI * (I[i] - 1) * pii[-2] * yj[0];
+		gammatau += nJ * pii[0] * yj[-1];
+		gammatautau += nJ * (J[i] - 1) * pii[0] * yj[-2];
+		gammapitau += nI * J[i] * pii[-1] * yj[-1];
+	}
+	residual[0] = gamma;
+	residual[1] = gammapi;
+	residual[2] = gammapipi;
+	residual[3] = gammatau;
+	residual[4] = gammatautau;
+	residual[5] = gammapitau;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief copies the sums of a Gibbs free energy series into a Gibbs structure
+///
+/// \param[in] sums dimensionless Gibbs free energy and its partial derivatives, in
+///  the order of the members of Gibbs
+/// \param[out] g dimensionless Gibbs free energy and its partial derivatives
+///////////////////////////////////////////////////////////////////////////////
+static inline void store_gibbs(const double sums[6], Gibbs &g)
+{
+	g.gamma = sums[0];
+	g.gammapi = sums[1];
+	g.gammapipi = sums[2];
+	g.gammatau = sums[3];
+	g.gammatautau = sums[4];
+	g.gammapitau = sums[5];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the ideal-gas and residual portions of the dimensionless Gibbs
+///  free energy and all of their first and second order partial derivatives for
+///  IAPWS Region 2
+///
+/// \param[in] pi reduced pressure
+/// \param[in] tau reduced temperature
+/// \param[out] ideal ideal-gas portion of the dimensionless Gibbs free energy and
+///  its partial derivatives
+/// \param[out] residual residual portion of the dimensionless Gibbs free energy and
+///  its partial derivatives
+///////////////////////////////////////////////////////////////////////////////
+void gibbs_2(double pi, double tau, Gibbs &ideal, Gibbs &residual)
+{
+	double ideal_sums[6];
+	double residual_sums[6];
+	gibbs_2_series(pi, tau, ideal_sums, residual_sums);
+	store_gibbs(ideal_sums, ideal);
+	store_gibbs(residual_sums, residual);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the ideal-gas and residual portions of the dimensionless Gibbs
+///  free energy and their partial derivatives for IAPWS Region 2 at an array of
+///  statepoints, one statepoint per lane of a vector
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] ideal array that receives the ideal-gas portions
+/// \param[out] residual array that receives the residual portions
+/// \param[in] count number of elements in the pi, tau, ideal, and residual arrays
+///////////////////////////////////////////////////////////////////////////////
+template <class V, int LANES>
+static ALWAYS_INLINE void gibbs_2_lanes(const double pi[], const double tau[], Gibbs ideal[], Gibbs residual[], long count)
+{
+	long i = 0;
+	for (; i+LANES<=count; i+=LANES) {
+		V vpi;
+		V vtau;
+		for (int lane=0; lane<LANES; lane++) {
+			vpi[lane] = pi[i+lane];
+			vtau[lane] = tau[i+lane];
+		}
+		V ideal_sums[6];
+		V residual_sums[6];
+		gibbs_2_series(vpi, vtau, ideal_sums, residual_sums);
+		for (int lane=0; lane<LANES; lane++) {
+			double sums[6];
+			for (int k=0; k<6; k++)
+				sums[k] = ideal_sums[k][lane];
+			store_gibbs(sums, ideal[i+lane]);
+			for (int k=0; k<6; k++)
+				sums[k] = residual_sums[k][lane];
+			store_gibbs(sums, residual[i+lane]);
+		}
+	}
+	for (; i<count; i++)
+		gibbs_2(pi[i], tau[i], ideal[i], residual[i]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates the Region 2 Gibbs free energy one statepoint at a time
+///
+/// Used where the processor or compiler offers no vector instructions.
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] ideal array that receives the ideal-gas portions
+/// \param[out] residual array that receives the residual portions
+/// \param[in] count number of elements in the pi, tau, ideal, and residual arrays
+///////////////////////////////////////////////////////////////////////////////
+static void gibbs_2_scalar(const double pi[], const double tau[], Gibbs ideal[], Gibbs residual[], long count)
+{
+	for (long i=0; i<count; i++)
+		gibbs_2(pi[i], tau[i], ideal[i], residual[i]);
+}
+
+#ifdef WATPROP_SIMD
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates the Region 2 Gibbs free energy four statepoints at a time with AVX2
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] ideal array that receives the ideal-gas portions
+/// \param[out] residual array that receives the residual portions
+/// \param[in] count number of elements in the pi, tau, ideal, and residual arrays
+///////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx2")))
+static void gibbs_2_avx2(const double pi[], const double tau[], Gibbs ideal[], Gibbs residual[], long count)
+{
+	gibbs_2_lanes<double4, 4>(pi, tau, ideal, residual, count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates the Region 2 Gibbs free energy eight statepoints at a time with AVX-512
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] ideal array that receives the ideal-gas portions
+/// \param[out] residual array that receives the residual portions
+/// \param[in] count number of elements in the pi, tau, ideal, and residual arrays
+///////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx512f")))
+static void gibbs_2_avx512(const double pi[], const double tau[], Gibbs ideal[], Gibbs residual[], long count)
+{
+	gibbs_2_lanes<double8, 8>(pi, tau, ideal, residual, count);
+}
+#endif
+
+#if defined(__clang__)
+#pragma clang fp contract(on)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief pointer to a function that evaluates the Region 2 Gibbs free energy over arrays
+///////////////////////////////////////////////////////////////////////////////
+typedef void (*GibbsBatch2)(const double pi[], const double tau[], Gibbs ideal[], Gibbs residual[], long count);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the ideal-gas and residual portions of the dimensionless Gibbs
+///  free energy and all of their first and second order partial derivatives for
+///  IAPWS Region 2 at an array of statepoints
+///
+/// Several statepoints are evaluated at once in the lanes of the widest vector
+/// instructions that the processor supports (AVX-512 or AVX2), chosen the first
+/// time that this is called.  The results are identical to those of gibbs_2.
+///
+/// \param[in] pi array of reduced pressures
+/// \param[in] tau array of reduced temperatures
+/// \param[out] ideal array that receives the ideal-gas portions
+/// \param[out] residual array that receives the residual portions
+/// \param[in] count number of elements in the pi, tau, ideal, and residual arrays
+///////////////////////////////////////////////////////////////////////////////
+void gibbs_2_batch(const double pi[], const double tau[], Gibbs ideal[], Gibbs residual[], long count)
+{
+#ifdef WATPROP_SIMD
+	static const GibbsBatch2 kernel = select_kernel<GibbsBatch2>(gibbs_2_scalar, gibbs_2_avx2, gibbs_2_avx512);
+#else
+	static const GibbsBatch2 kernel = gibbs_2_scalar;
+#endif
+	kernel(pi, tau, ideal, residual, count);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief calculates ideal-gas portion of the dimensionless Gibbs free energy for IAPWS Region 2
 ///
@@ -123,12 +405,9 @@ const double N[REG2R_COUNT] = {
 ///////////////////////////////////////////////////////////////////////////////
 double gamma0(double pi, double tau)
 {
-	double sum = 0;
-	for (int i=0; i<REG2I_COUNT; i++)
-	{
-		sum += N0[i]*pow(tau,J0[i]);
-	}
-	return log(pi) + sum;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return ideal.gamma;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -143,7 +422,9 @@ double gamma0(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammapi0(double pi, double tau)
 {
-	return 1/pi;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return ideal.gammapi;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -158,7 +439,9 @@ double gammapi0(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammapipi0(double pi, double tau)
 {
-	return 1/pow(pi,2);
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return ideal.gammapipi;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -173,12 +456,9 @@ double gammapipi0(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammatau0(double pi, double tau)
 {
-	double sum = 0;
-	for (int i=0; i<REG2I_COUNT; i++)
-	{
-		sum += N0[i]*J0[i]*pow(tau,J0[i]-1);
-	}
-	return sum;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return ideal.gammatau;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -193,12 +473,9 @@ double gammatau0(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammatautau0(double pi, double tau)
 {
-	double sum = 0;
-	for (int i=0; i<REG2I_COUNT; i++)
-	{
-		sum += N0[i]*J0[i]*(J0[i]-1)*pow(tau,J0[i]-2);
-	}
-	return sum;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return ideal.gammatautau;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -213,7 +490,9 @@ double gammatautau0(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammapitau0(double pi, double tau)
 {
-	return 0;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return ideal.gammapitau;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -226,12 +505,9 @@ double gammapitau0(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammar(double pi, double tau)
 {
-	double sum = 0;
-	for (int i=0; i<REG2R_COUNT; i++)
-	{
-		sum += N[i]*pow(pi,I[i])*pow(tau-0.5,J[i]);
-	}
-	return sum;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return residual.gamma;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -246,12 +522,9 @@ double gammar(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammapir(double pi, double tau)
 {
-	double sum = 0;
-	for (int i=0; i<REG2R_COUNT; i++)
-	{
-		sum += N[i]*I[i]*pow(pi,I[i]-1)*pow(tau-0.5,J[i]);
-	}
-	return sum;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return residual.gammapi;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -266,12 +539,9 @@ double gammapir(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammapipir(double pi, double tau)
 {
-	double sum = 0;
-	for (int i=0; i<REG2R_COUNT; i++)
-	{
-		sum += N[i]*I[i]*(I[i]-1)*pow(pi,I[i]-2)*pow(tau-0.5,J[i]);
-	}
-	return sum;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return residual.gammapipi;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -286,12 +556,9 @@ double gammapipir(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammataur(double pi, double tau)
 {
-	double sum = 0;
-	for (int i=0; i<REG2R_COUNT; i++)
-	{
-		sum += N[i]*pow(pi,I[i])*J[i]*pow(tau-0.5,J[i]-1);
-	}
-	return sum;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return residual.gammatau;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -306,12 +573,9 @@ double gammataur(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammatautaur(double pi, double tau)
 {
-	double sum = 0;
-	for (int i=0; i<REG2R_COUNT; i++)
-	{
-		sum += N[i]*pow(pi,I[i])*J[i]*(J[i]-1)*pow(tau-0.5,J[i]-2);
-	}
-	return sum;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return residual.gammatautau;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -326,12 +590,100 @@ double gammatautaur(double pi, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double gammapitaur(double pi, double tau)
 {
-	double sum = 0;
-	for (int i=0; i<REG2R_COUNT; i++)
-	{
-		sum += N[i]*I[i]*pow(pi,I[i]-1)*J[i]*pow(tau-0.5,J[i]-1);
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return residual.gammapitau;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all thermodynamic properties from the Gibbs free energy in
+///  IAPWS Region 2
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[in] ideal ideal-gas portion of the dimensionless Gibbs free energy and its
+///  partial derivatives at p, t
+/// \param[in] residual residual portion of the dimensionless Gibbs free energy and
+///  its partial derivatives at p, t
+/// \param[out] state thermodynamic properties
+///////////////////////////////////////////////////////////////////////////////
+static void state_gibbs_2(double p, double t, const Gibbs &ideal, const Gibbs &residual, StatePT &state)
+{
+	double pi = p/pstar;
+	double tau = tstar/t;
+	double g = ideal.gamma + residual.gamma;
+	double gt = ideal.gammatau + residual.gammatau;
+	double gtt = ideal.gammatautau + residual.gammatautau;
+	double gpr = residual.gammapi;
+	double gppr = residual.gammapipi;
+	double gptr = residual.gammapitau;
+	double zip = 1 + pi*gpr - tau*pi*gptr;
+	// note that p has units of MPa, so multiply by 1E3 to get the proper units
+	state.v = (ideal.gammapi + gpr)*pi*R*t/(p*1E3);
+	state.s = R*(tau*gt - g);
+	state.h = tau*gt*R*t;
+	state.cp = -tau*tau*gtt*R;
+	state.cv = (-tau*tau*gtt - zip*zip/(1 - pi*pi*gppr)) * R;
+	double top = 1 + 2*pi*gpr + pi*gpr*pi*gpr;
+	double bottom = (1 - pi*pi*gppr) + zip*zip/(tau*tau*gtt);
+	// note that 1E3 added to make the units work
+	state.w = sqrt(top/bottom *R*t*1E3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all thermodynamic properties as a function of pressure and temperature
+///  in IAPWS Region 2
+///
+/// Each derivative of the Gibbs free energy is evaluated once and shared by all
+/// of the properties.  Transport properties are not calculated.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] state thermodynamic properties
+///////////////////////////////////////////////////////////////////////////////
+void state_pt_2(double p, double t, StatePT &state)
+{
+	Gibbs ideal, residual;
+	gibbs_2(p/pstar, tstar/t, ideal, residual);
+	state_gibbs_2(p, t, ideal, residual, state);
+}
+
+////////////////////////////////////////////////////////
+///	\brief Number of statepoints passed to the Gibbs free energy kernel at a time.
+////////////////////////////////////////////////////////
+#define REG2_BATCH_BLOCK 64
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all thermodynamic properties at an array of pressures and
+///  temperatures in IAPWS Region 2
+///
+/// The Gibbs free energy is evaluated several statepoints at a time by
+/// gibbs_2_batch, so the results are identical to those of state_pt_2.
+/// Transport properties are not calculated.
+///
+/// \param[in] p  array of pressures
+/// \param[in] t  array of temperatures
+/// \param[out] state array that receives the thermodynamic properties
+/// \param[in] count number of elements in the p, t, and state arrays
+///////////////////////////////////////////////////////////////////////////////
+void state_pt_2_batch(const double p[], const double t[], StatePT state[], long count)
+{
+	double pi[REG2_BATCH_BLOCK];
+	double tau[REG2_BATCH_BLOCK];
+	Gibbs ideal[REG2_BATCH_BLOCK];
+	Gibbs residual[REG2_BATCH_BLOCK];
+	for (long begin=0; begin<count; begin+=REG2_BATCH_BLOCK) {
+		long size = count - begin;
+		if (size > REG2_BATCH_BLOCK)
+			size = REG2_BATCH_BLOCK;
+		for (long i=0; i<size; i++) {
+			pi[i] = p[begin+i]/pstar;
+			tau[i] = tstar/t[begin+i];
+		}
+		gibbs_2_batch(pi, tau, ideal, residual, size);
+		for (long i=0; i<size; i++)
+			state_gibbs_2(p[begin+i], t[begin+i], ideal[i], residual[i], state[begin+i]);
 	}
-	return sum;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -347,7 +699,9 @@ double v_pt_2(double p,double t)
 	double pi = p/pstar;
 	double tau = tstar/t;
 	// note that p has units of MPa, so multiply by 1E3 to get the proper units
-	return (gammapi0(pi,tau) + gammapir(pi,tau))*pi*R*t/(p*1E3);
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return (ideal.gammapi + residual.gammapi)*pi*R*t/(p*1E3);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -362,7 +716,9 @@ double s_pt_2(double p,double t)
 {
 	double pi = p/pstar;
 	double tau = tstar/t;
-	return R*(tau*(gammatau0(pi,tau) + gammataur(pi,tau)) - (gamma0(pi,tau) + gammar(pi,tau)));
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return R*(tau*(ideal.gammatau + residual.gammatau) - (ideal.gamma + residual.gamma));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -377,7 +733,9 @@ double h_pt_2(double p,double t)
 {
 	double pi = p/pstar;
 	double tau = tstar/t;
-	return tau*(gammatau0(pi,tau) + gammataur(pi,tau)) *R*t;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return tau*(ideal.gammatau + residual.gammatau) *R*t;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -392,7 +750,9 @@ double cp_pt_2(double p,double t)
 {
 	double pi = p/pstar;
 	double tau = tstar/t;
-	return (-pow(tau,2))*(gammatautau0(pi,tau) + gammatautaur(pi,tau)) * R;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	return (-pow(tau,2))*(ideal.gammatautau + residual.gammatautau) * R;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -407,9 +767,11 @@ double cv_pt_2(double p,double t)
 {
 	double pi = p/pstar;
 	double tau = tstar/t;
-	double part1 = pow(tau,2)*(gammatautau0(pi,tau) + gammatautaur(pi,tau));
-	double zip = 1 + pi*gammapir(pi,tau) - tau*pi*gammapitaur(pi,tau);
-	double part2 = pow(zip,2)/(1 - pow(pi,2)*gammapipir(pi,tau));
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	double part1 = pow(tau,2)*(ideal.gammatautau + residual.gammatautau);
+	double zip = 1 + pi*residual.gammapi - tau*pi*residual.gammapitau;
+	double part2 = pow(zip,2)/(1 - pow(pi,2)*residual.gammapipi);
 	return (-part1 - part2) * R;
 }
 
@@ -425,16 +787,223 @@ double w_pt_2(double p,double t)
 {
 	double pi = p/pstar;
 	double tau = tstar/t;
-	double top = 1 + 2*pi*gammapir(pi,tau) + pow(pi*gammapir(pi,tau),2);
-	double bottom = pow(1 + pi*gammapir(pi,tau) - tau*pi*gammapitaur(pi,tau), 2);
-	bottom = bottom / (pow(tau,2) * (gammatautau0(pi,tau) + gammatautaur(pi,tau)));
-	bottom = (1 - pow(pi,2)*gammapipir(pi,tau)) + bottom;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	double top = 1 + 2*pi*residual.gammapi + pow(pi*residual.gammapi,2);
+	double bottom = pow(1 + pi*residual.gammapi - tau*pi*residual.gammapitau, 2);
+	bottom = bottom / (pow(tau,2) * (ideal.gammatautau + residual.gammatautau));
+	bottom = (1 - pow(pi,2)*residual.gammapipi) + bottom;
 	// note that 1E3 added to make the units work
 	return pow(top/bottom *R*t*1E3,0.5);
 }
 
+//------------------------------------------------------------------------------
+// BACKWARD EQUATIONS T(p,h)
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation between
+///  subregions 2b and 2c.
+////////////////////////////////////////////////////////
+const double n_b2bc[5] = {
+            0.90584278514723E+03, -0.67955786399241E+00, 0.12809002730136E-03,
+            0.26526571908428E+04, 0.45257578905948E+01
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,h)
+///  in subregion 2a.
+////////////////////////////////////////////////////////
+#define REG2A_TPH_COUNT 34
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,h) in subregion 2a.
+////////////////////////////////////////////////////////
+const int I_tph_2a[REG2A_TPH_COUNT] = {
+                                       0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+                                       3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation T(p,h) in subregion 2a.
+////////////////////////////////////////////////////////
+const int J_tph_2a[REG2A_TPH_COUNT] = {
+                                       0, 1, 2, 3, 7, 20, 0, 1, 2, 3, 7, 9, 11, 18, 44, 0, 2, 7, 36, 38, 40,
+                                       42, 44, 24, 44, 12, 32, 44, 32, 36, 42, 34, 44, 28
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,h)
+///  in subregion 2a.
+////////////////////////////////////////////////////////
+const double n_tph_2a[REG2A_TPH_COUNT] = {
+            0.10898952318288E+04, 0.84951654495535E+03, -0.10781748091826E+03,
+            0.33153654801263E+02, -0.74232016790248E+01, 0.11765048724356E+02, 0.18445749355790E+01,
+            -0.41792700549624E+01, 0.62478196935812E+01, -0.17344563108114E+02, -0.20058176862096E+03,
+            0.27196065473796E+03, -0.45511318285818E+03, 0.30919688604755E+04, 0.25226640357872E+06,
+            -0.61707422868339E-02, -0.31078046629583E+00, 0.11670873077107E+02, 0.12812798404046E+09,
+            -0.98554909623276E+09, 0.28224546973002E+10, -0.35948971410703E+10, 0.17227349913197E+10,
+            -0.13551334240775E+05, 0.12848734664650E+08, 0.13865724283226E+01, 0.23598832556514E+06,
+            -0.13105236545054E+08, 0.73999835474766E+04, -0.55196697030060E+06, 0.37154085996233E+07,
+            0.19127729239660E+05, -0.41535164835634E+06, -0.62459855192507E+02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,h)
+///  in subregion 2b.
+////////////////////////////////////////////////////////
+#define REG2B_TPH_COUNT 38
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,h) in subregion 2b.
+////////////////////////////////////////////////////////
+const int I_tph_2b[REG2B_TPH_COUNT] = {
+                                       0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3,
+                                       3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 6, 7, 7, 9, 9
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation T(p,h) in subregion 2b.
+////////////////////////////////////////////////////////
+const int J_tph_2b[REG2B_TPH_COUNT] = {
+                                       0, 1, 2, 12, 18, 24, 28, 40, 0, 2, 6, 12, 18, 24, 28, 40, 2, 8, 18,
+                                       40, 1, 2, 12, 24, 2, 12, 18, 24, 28, 40, 18, 24, 40, 28, 2, 28, 1, 40
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,h)
+///  in subregion 2b.
+////////////////////////////////////////////////////////
+const double n_tph_2b[REG2B_TPH_COUNT] = {
+            0.14895041079516E+04, 0.74307798314034E+03, -0.97708318797837E+02,
+            0.24742464705674E+01, -0.63281320016026E+00, 0.11385952129658E+01, -0.47811863648625E+00,
+            0.85208123431544E-02, 0.93747147377932E+00, 0.33593118604916E+01, 0.33809355601454E+01,
+            0.16844539671904E+00, 0.73875745236695E+00, -0.47128737436186E+00, 0.15020273139707E+00,
+            -0.21764114219750E-02, -0.21810755324761E-01, -0.10829784403677E+00, -0.46333324635812E-01,
+            0.71280351959551E-04, 0.11032831789999E-03, 0.18955248387902E-03, 0.30891541160537E-02,
+            0.13555504554949E-02, 0.28640237477456E-06, -0.10779857357512E-04, -0.76462712454814E-04,
+            0.14052392818316E-04, -0.31083814331434E-04, -0.10302738212103E-05, 0.28217281635040E-06,
+            0.12704902271945E-05, 0.73803353468292E-07, -0.11030139238909E-07, -0.81456365207833E-13,
+            -0.25180545682962E-10, -0.17565233969407E-17, 0.86934156344163E-14
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,h)
+///  in subregion 2c.
+////////////////////////////////////////////////////////
+#define REG2C_TPH_COUNT 23
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,h) in subregion 2c.
+////////////////////////////////////////////////////////
+const int I_tph_2c[REG2C_TPH_COUNT] = {
+                                       -7, -7, -6, -6, -5, -5, -2, -2, -1, -1, 0, 0, 1, 1, 2, 6, 6, 6, 6,
+                                       6, 6, 6, 6
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation T(p,h) in subregion 2c.
+////////////////////////////////////////////////////////
+const int J_tph_2c[REG2C_TPH_COUNT] = {
+                                       0, 4, 0, 2, 0, 2, 0, 1, 0, 2, 0, 1, 4, 8, 4, 0, 1, 4, 10, 12, 16,
+                                       20, 22
+                                   };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,h)
+///  in subregion 2c.
+////////////////////////////////////////////////////////
+const double n_tph_2c[REG2C_TPH_COUNT] = {
+            -0.32368398555242E+13, 0.73263350902181E+13, 0.35825089945447E+12,
+            -0.58340131851590E+12, -0.10783068217470E+11, 0.20825544563171E+11, 0.61074783564516E+06,
+            0.85977722535580E+06, -0.25745723604170E+05, 0.31081088422714E+05, 0.12082315865936E+04,
+            0.48219755109255E+03, 0.37966001272486E+01, -0.10842984880077E+02, -0.45364172676660E-01,
+            0.14559115658698E-12, 0.11261597407230E-11, -0.17804982240686E-10, 0.12324579690832E-06,
+            -0.11606921130984E-05, 0.27846367088554E-04, -0.59270038474176E-03, 0.12918582991878E-02
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates pressure on the boundary between subregions 2b and 2c as a
+///  function of specific enthalpy
+///
+/// \param[in] h  specific enthalpy
+///
+/// \return pressure
+///////////////////////////////////////////////////////////////////////////////
+double b2bc_p_h(double h)
+{
+	return n_b2bc[0] + n_b2bc[1]*h + n_b2bc[2]*h*h;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific enthalpy on the boundary between subregions 2b and 2c
+///  as a function of pressure
+///
+/// \param[in] p  pressure
+///
+/// \return specific enthalpy
+///////////////////////////////////////////////////////////////////////////////
+double b2bc_h_p(double p)
+{
+	return n_b2bc[3] + sqrt((p - n_b2bc[4]) / n_b2bc[2]);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief calculates temperature as a function of pressure and specific enthalpy in IAPWS Region 2
+///  using the IAPWS-IF97 backward equations
+///
+/// Region 2 is split into subregion 2a (p <= 4 MPa), and subregions 2b and 2c on either
+/// side of the 2b/2c boundary.  The backward equations agree with the inverse of the
+/// forward equations to within 10 mK (2a), 25 mK (2b), or 25 mK (2c).
+///
+/// \param[in] p  pressure
+/// \param[in] h  specific enthalpy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double backward_t_ph_2(double p, double h)
+{
+	// reference quantities are p* = 1 MPa, h* = 2000 kJ/kg, and T* = 1 K
+	double eta = h / 2000;
+	if (p <= 4)
+		return power_series(I_tph_2a, J_tph_2a, n_tph_2a, REG2A_TPH_COUNT, p, eta - 2.1);
+	if (p <= b2bc_p_h(h))
+		return power_series(I_tph_2b, J_tph_2b, n_tph_2b, REG2B_TPH_COUNT, p - 2, eta - 2.6);
+	return power_series(I_tph_2c, J_tph_2c, n_tph_2c, REG2C_TPH_COUNT, p + 25, eta - 1.8);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific enthalpy and isobaric heat capacity as a function of
+///  pressure and temperature in IAPWS Region 2
+///
+/// Provides the value and slope of h(T) for Newton iteration on temperature.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] h  specific enthalpy
+/// \param[out] cp isobaric heat capacity
+///////////////////////////////////////////////////////////////////////////////
+static void h_cp_pt_2(double p, double t, double &h, double &cp)
+{
+	double pi = p / pstar;
+	double tau = tstar / t;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	h = tau*(ideal.gammatau + residual.gammatau) *R*t;
+	cp = (-pow(tau,2))*(ideal.gammatautau + residual.gammatautau) * R;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific enthalpy in IAPWS Region 2
+///
+/// By default the forward equation is inverted with Brent's method.  The backward_ph
+/// setting selects the backward equations instead, either on their own or as the
+/// starting point of a Newton iteration on the forward equation.
 ///
 /// \param[in] p  pressure
 /// \param[in] h  specific enthalpy
@@ -443,13 +1012,79 @@ double w_pt_2(double p,double t)
 ///////////////////////////////////////////////////////////////////////////////
 double t_ph_2(double p, double h)
 {
+	BackwardMode mode = active_settings().backward_ph;
+	if (mode == BACKWARD_DIRECT)
+		return backward_t_ph_2(p, h);
 	double t_low;
 	if (p < 16.5292)
 		t_low = TSAT_P(p) - 1;
 	else
 		t_low = b23_t_p(p) - 1;
 	double t_high = 1073.15 + 1;
-	return zeroin2(h_pt_2, p, t_low, t_high, h, tolerance);
+	if (mode == BACKWARD_POLISH) {
+		double t = backward_t_ph_2(p, h);
+		if (newton_polish(h_cp_pt_2, p, t_low, t_high, h, t))
+			return t;
+	}
+	return zeroin_active(SOLVER_T_PH_2, [p](double t) { return h_pt_2(p, t); }, t_low, t_high, h, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific enthalpy at arrays of pressure and temperature in
+///  IAPWS Region 2 with the vectorized Gibbs free energy kernel
+///
+/// \param[in] p  array of pressures
+/// \param[in] t  array of temperatures
+/// \param[out] h array that receives the specific enthalpies
+/// \param[in] count number of elements in the p, t, and h arrays
+///////////////////////////////////////////////////////////////////////////////
+static void h_pt_2_batch(const double p[], const double t[], double h[], long count)
+{
+	double pi[REG2_BATCH_BLOCK];
+	double tau[REG2_BATCH_BLOCK];
+	Gibbs ideal[REG2_BATCH_BLOCK];
+	Gibbs residual[REG2_BATCH_BLOCK];
+	for (long begin=0; begin<count; begin+=REG2_BATCH_BLOCK) {
+		long size = count - begin;
+		if (size > REG2_BATCH_BLOCK)
+			size = REG2_BATCH_BLOCK;
+		for (long i=0; i<size; i++) {
+			pi[i] = p[begin+i]/pstar;
+			tau[i] = tstar/t[begin+i];
+		}
+		gibbs_2_batch(pi, tau, ideal, residual, size);
+		for (long i=0; i<size; i++)
+			h[begin+i] = tau[i]*(ideal[i].gammatau + residual[i].gammatau) *R*t[begin+i];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature at arrays of pressure and specific enthalpy in
+///  IAPWS Region 2 by inverting the forward equation with Brent's method
+///
+/// All of the statepoints are iterated in lock step (zeroin_batch) so that the
+/// forward equation is evaluated by the vectorized Gibbs free energy kernel.  The
+/// temperatures are identical to those of t_ph_2 when backward_ph is BACKWARD_OFF,
+/// whatever the setting, and the search has the same tolerance and iteration limit.
+///
+/// \param[in] p  array of pressures
+/// \param[in] h  array of specific enthalpies
+/// \param[out] t array that receives the temperatures, or NaN where the search failed
+/// \param[in] count number of elements in the p, h, and t arrays
+///
+/// \return number of statepoints where the search failed
+///////////////////////////////////////////////////////////////////////////////
+long t_ph_2_batch(const double p[], const double h[], double t[], long count)
+{
+	std::vector<double> t_low(count);
+	std::vector<double> t_high(count, 1073.15 + 1);
+	for (long i=0; i<count; i++) {
+		if (p[i] < 16.5292)
+			t_low[i] = TSAT_P(p[i]) - 1;
+		else
+			t_low[i] = b23_t_p(p[i]) - 1;
+	}
+	return zeroin_batch_active(SOLVER_T_PH_2, h_pt_2_batch, p, t_low.data(), t_high.data(), h, tolerance, t, count);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -479,3 +1114,455 @@ double s_ph_2(double p, double h)
 	double t = t_ph_2(p, h);
 	return s_pt_2(p, t);
 }
+
+//------------------------------------------------------------------------------
+// BACKWARD EQUATIONS T(p,s)
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,s)
+///  in subregion 2a.
+////////////////////////////////////////////////////////
+#define REG2A_TPS_COUNT 46
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the exponents, in quarters, of the reduced pressure of the backward
+///  equation T(p,s) in subregion 2a.
+////////////////////////////////////////////////////////
+const int I_tps_2a[REG2A_TPS_COUNT] = {
+                                      -6, -6, -6, -6, -6, -6, -5, -5, -5, -4, -4, -4, -4, -4, -4, -3, -3, -2, -2, -2,
+                                      -2, -1, -1, -1, -1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+                                      4, 4, 5, 5, 6, 6
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation T(p,s) in subregion 2a.
+////////////////////////////////////////////////////////
+const int J_tps_2a[REG2A_TPS_COUNT] = {
+                                      -24, -23, -19, -13, -11, -10, -19, -15, -6, -26, -21, -17, -16, -9, -8, -15, -14, -26, -13, -9,
+                                      -7, -27, -25, -11, -6, 1, 4, 8, 11, 0, 1, 5, 6, 10, 14, 16, 0, 4, 9, 17,
+                                      7, 18, 3, 15, 5, 18
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,s)
+///  in subregion 2a.
+////////////////////////////////////////////////////////
+const double n_tps_2a[REG2A_TPS_COUNT] = {
+            -0.39235983861984E+06, 0.5152657382727E+06, 0.40482443161048E+05, -0.32193790923902E+03,
+            0.96961424218694E+02, -0.22867846371773E+02, -0.44942914124357E+06, -0.50118336020166E+04,
+            0.35684463560015E+00, 0.4423533584819E+05, -0.13673388811708E+05, 0.42163260207864E+06,
+            0.22516925837475E+05, 0.47442144865646E+03, -0.14931130797647E+03, -0.19781126320452E+06,
+            -0.2355439947076E+05, -0.19070616302076E+05, 0.55375669883164E+05, 0.38293691437363E+04,
+            -0.60391860580567E+03, 0.19363102620331E+04, 0.4266064369861E+04, -0.59780638872718E+04,
+            -0.70401463926862E+03, 0.33836784107553E+03, 0.20862786635187E+02, 0.33834172656196E-01,
+            -0.43124428414893E-04, 0.16653791356412E+03, -0.13986292055898E+03, -0.78849547999872E+00,
+            0.72132411753872E-01, -0.59754839398283E-02, -0.12141358953904E-04, 0.23227096733871E-06,
+            -0.10538463566194E+02, 0.20718925496502E+01, -0.72193155260427E-01, 0.2074988708112E-06,
+            -0.18340657911379E-01, 0.29036272348696E-06, 0.21037527893619E+00, 0.25681239729999E-03,
+            -0.12799002933781E-01, -0.82198102652018E-05
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,s)
+///  in subregion 2b.
+////////////////////////////////////////////////////////
+#define REG2B_TPS_COUNT 44
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,s) in subregion 2b.
+////////////////////////////////////////////////////////
+const int I_tps_2b[REG2B_TPS_COUNT] = {
+                                      -6, -6, -5, -5, -4, -4, -4, -3, -3, -3, -3, -2, -2, -2, -2, -1, -1, -1, -1, -1,
+                                      0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4,
+                                      4, 5, 5, 5
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation T(p,s) in subregion 2b.
+////////////////////////////////////////////////////////
+const int J_tps_2b[REG2B_TPS_COUNT] = {
+                                      0, 11, 0, 11, 0, 1, 11, 0, 1, 11, 12, 0, 1, 6, 10, 0, 1, 5, 8, 9,
+                                      0, 1, 2, 4, 5, 6, 9, 0, 1, 2, 3, 7, 8, 0, 1, 5, 0, 1, 3, 0,
+                                      1, 0, 1, 2
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,s)
+///  in subregion 2b.
+////////////////////////////////////////////////////////
+const double n_tps_2b[REG2B_TPS_COUNT] = {
+            0.31687665083497E+06, 0.20864175881858E+02, -0.39859399803599E+06, -0.21816058518877E+02,
+            0.22369785194242E+06, -0.27841703445817E+04, 0.9920743607148E+01, -0.75197512299157E+05,
+            0.29708605951158E+04, -0.34406878548526E+01, 0.38815564249115E+00, 0.1751129508575E+05,
+            -0.14237112854449E+04, 0.10943803364167E+01, 0.89971619308495E+00, -0.33759740098958E+04,
+            0.47162885818355E+03, -0.19188241993679E+01, 0.41078580492196E+00, -0.33465378172097E+00,
+            0.13870034777505E+04, -0.40663326195838E+03, 0.4172734715961E+02, 0.21932549434532E+01,
+            -0.10320050009077E+01, 0.35882943516703E+00, 0.52511453726066E-02, 0.12838916450705E+02,
+            -0.28642437219381E+01, 0.56912683664855E+00, -0.99962954584931E-01, -0.32632037778459E-02,
+            0.23320922576723E-03, -0.1533480985745E+00, 0.29072288239902E-01, 0.37534702741167E-03,
+            0.17296691702411E-02, -0.38556050844504E-03, -0.35017712292608E-04, -0.14566393631492E-04,
+            0.56420857267269E-05, 0.41286150074605E-07, -0.20684671118824E-07, 0.16409393674725E-08
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation T(p,s)
+///  in subregion 2c.
+////////////////////////////////////////////////////////
+#define REG2C_TPS_COUNT 30
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced pressure exponents of the backward
+///  equation T(p,s) in subregion 2c.
+////////////////////////////////////////////////////////
+const int I_tps_2c[REG2C_TPS_COUNT] = {
+                                      -2, -2, -1, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4,
+                                      5, 5, 5, 6, 6, 7, 7, 7, 7, 7
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation T(p,s) in subregion 2c.
+////////////////////////////////////////////////////////
+const int J_tps_2c[REG2C_TPS_COUNT] = {
+                                      0, 1, 0, 0, 1, 2, 3, 0, 1, 3, 4, 0, 1, 2, 0, 1, 5, 0, 1, 4,
+                                      0, 1, 2, 0, 1, 0, 1, 3, 4, 5
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T(p,s)
+///  in subregion 2c.
+////////////////////////////////////////////////////////
+const double n_tps_2c[REG2C_TPS_COUNT] = {
+            0.90968501005365E+03, 0.2404566708842E+04, -0.5916232638713E+03, 0.54145404128074E+03,
+            -0.27098308411192E+03, 0.97976525097926E+03, -0.46966772959435E+03, 0.14399274604723E+02,
+            -0.19104204230429E+02, 0.53299167111971E+01, -0.21252975375934E+02, -0.3114733441376E+00,
+            0.60334840894623E+00, -0.42764839702509E-01, 0.58185597255259E-02, -0.14597008284753E-01,
+            0.56631175631027E-02, -0.76155864584577E-04, 0.22440342919332E-03, -0.12561095013413E-04,
+            0.63323132660934E-06, -0.20541989675375E-05, 0.36405370390082E-07, -0.29759897789215E-08,
+            0.10136618529763E-07, 0.59925719692351E-11, -0.20677870105164E-10, -0.20874278181886E-10,
+            0.10162166825089E-09, -0.16429828281347E-09
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy in IAPWS Region 2
+///  using the IAPWS-IF97 backward equations
+///
+/// Region 2 is split into subregion 2a (p <= 4 MPa), and subregions 2b and 2c on either
+/// side of the isentrope s = 5.85 kJ/kg/K.  The backward equations agree with the inverse
+/// of the forward equations to within 10 mK (2a), 10 mK (2b), or 25 mK (2c).
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double backward_t_ps_2(double p, double s)
+{
+	// reference quantities are p* = 1 MPa and T* = 1 K, and s* = 2, 0.7853, or 2.9251 kJ/kg/K
+	if (p <= 4)
+		// the pressure exponents of subregion 2a are multiples of 1/4, tabulated in quarters
+		return power_series(I_tps_2a, J_tps_2a, n_tps_2a, REG2A_TPS_COUNT, pow(p, 0.25), s/2 - 2);
+	if (s >= 5.85)
+		return power_series(I_tps_2b, J_tps_2b, n_tps_2b, REG2B_TPS_COUNT, p, 10 - s/0.7853);
+	return power_series(I_tps_2c, J_tps_2c, n_tps_2c, REG2C_TPS_COUNT, p, 2 - s/2.9251);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific entropy and its derivative with respect to temperature
+///  as a function of pressure and temperature in IAPWS Region 2
+///
+/// Provides the value and slope (cp/T) of s(T) for Newton iteration on temperature.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] s  specific entropy
+/// \param[out] slope derivative of specific entropy with respect to temperature
+///////////////////////////////////////////////////////////////////////////////
+static void s_slope_pt_2(double p, double t, double &s, double &slope)
+{
+	double pi = p / pstar;
+	double tau = tstar / t;
+	Gibbs ideal, residual;
+	gibbs_2(pi, tau, ideal, residual);
+	s = R*(tau*(ideal.gammatau + residual.gammatau) - (ideal.gamma + residual.gamma));
+	slope = (-pow(tau,2))*(ideal.gammatautau + residual.gammatautau) * R / t;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy in IAPWS Region 2
+///
+/// The backward equations are the starting point of a Newton iteration on the forward
+/// equation, which gives way to Brent's method if it leaves the region.
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double t_ps_2(double p, double s)
+{
+	double t_low;
+	if (p < 16.5292)
+		t_low = TSAT_P(p) - 1;
+	else
+		t_low = b23_t_p(p) - 1;
+	double t_high = 1073.15 + 1;
+	double t = backward_t_ps_2(p, s);
+	if (newton_polish(s_slope_pt_2, p, t_low, t_high, s, t))
+		return t;
+	return zeroin_active(SOLVER_T_PS_2, [p](double t) { return s_pt_2(p, t); }, t_low, t_high, s, tolerance);
+}
+
+//------------------------------------------------------------------------------
+// BACKWARD EQUATIONS p(h,s)
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the boundary equation between
+///  subregions 2a and 2b as a function of specific entropy (IAPWS SR2-01).
+////////////////////////////////////////////////////////
+const double n_b2ab_hs[4] = {
+            -0.349898083432139E+04, 0.257560716905876E+04, -0.421073558227969E+03, 0.276349063799944E+02
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation p(h,s)
+///  in subregion 2a.
+////////////////////////////////////////////////////////
+#define REG2A_PHS_COUNT 29
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation p(h,s) in subregion 2a.
+////////////////////////////////////////////////////////
+const int I_phs_2a[REG2A_PHS_COUNT] = {
+                                      0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 3,
+                                      3, 3, 3, 3, 4, 5, 5, 6, 7
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation p(h,s) in subregion 2a.
+////////////////////////////////////////////////////////
+const int J_phs_2a[REG2A_PHS_COUNT] = {
+                                      1, 3, 6, 16, 20, 22, 0, 1, 2, 3, 5, 6, 10, 16, 20, 22, 3, 16, 20, 0,
+                                      2, 3, 6, 16, 16, 3, 16, 3, 1
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation p(h,s)
+///  in subregion 2a.
+////////////////////////////////////////////////////////
+const double n_phs_2a[REG2A_PHS_COUNT] = {
+            -0.182575361923032E-01, -0.125229548799536E+00, 0.592290437320145E+00, 0.604769706185122E+01,
+            0.238624965444474E+03, -0.298639090222922E+03, 0.512250813040750E-01, -0.437266515606486E+00,
+            0.413336902999504E+00, -0.516468254574773E+01, -0.557014838445711E+01, 0.128555037824478E+02,
+            0.114144108953290E+02, -0.119504225652714E+03, -0.284777985961560E+04, 0.431757846408006E+04,
+            0.112894040802650E+01, 0.197409186206319E+04, 0.151612444706087E+04, 0.141324451421235E-01,
+            0.585501282219601E+00, -0.297258075863012E+01, 0.594567314847319E+01, -0.623656565798905E+04,
+            0.965986235133332E+04, 0.681500934948134E+01, -0.633207286824489E+04, -0.558919224465760E+01,
+            0.400645798472063E-01
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation p(h,s)
+///  in subregion 2b.
+////////////////////////////////////////////////////////
+#define REG2B_PHS_COUNT 33
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation p(h,s) in subregion 2b.
+////////////////////////////////////////////////////////
+const int I_phs_2b[REG2B_PHS_COUNT] = {
+                                      0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4,
+                                      5, 5, 6, 6, 6, 7, 7, 8, 8, 8, 8, 12, 14
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation p(h,s) in subregion 2b.
+////////////////////////////////////////////////////////
+const int J_phs_2b[REG2B_PHS_COUNT] = {
+                                      0, 1, 2, 4, 8, 0, 1, 2, 3, 5, 12, 1, 6, 18, 0, 1, 7, 12, 1, 16,
+                                      1, 12, 1, 8, 18, 1, 16, 1, 3, 14, 18, 10, 16
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation p(h,s)
+///  in subregion 2b.
+////////////////////////////////////////////////////////
+const double n_phs_2b[REG2B_PHS_COUNT] = {
+            0.801496989929495E-01, -0.543862807146111E+00, 0.337455597421283E+00, 0.890555451157450E+01,
+            0.313840736431485E+03, 0.797367065977789E+00, -0.121616973556240E+01, 0.872803386937477E+01,
+            -0.169769781757602E+02, -0.186552827328416E+03, 0.951159274344237E+05, -0.189168510120494E+02,
+            -0.433407037194840E+04, 0.543212633012715E+09, 0.144793408386013E+00, 0.128024559637516E+03,
+            -0.672309534071268E+05, 0.336972380095287E+08, -0.586634196762720E+03, -0.221403224769889E+11,
+            0.171606668708389E+04, -0.570817595806302E+09, -0.312109693178482E+04, -0.207841384633010E+07,
+            0.305605946157786E+13, 0.322157004314333E+04, 0.326810259797295E+12, -0.144104158934487E+04,
+            0.410694867802691E+03, 0.109077066873024E+12, -0.247964654258893E+14, 0.188801906865134E+10,
+            -0.123651009018773E+15
+        };
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation p(h,s)
+///  in subregion 2c.
+////////////////////////////////////////////////////////
+#define REG2C_PHS_COUNT 31
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation p(h,s) in subregion 2c.
+////////////////////////////////////////////////////////
+const int I_phs_2c[REG2C_PHS_COUNT] = {
+                                      0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+                                      3, 4, 5, 5, 5, 5, 6, 6, 10, 12, 16
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation p(h,s) in subregion 2c.
+////////////////////////////////////////////////////////
+const int J_phs_2c[REG2C_PHS_COUNT] = {
+                                      0, 1, 2, 3, 4, 8, 0, 2, 5, 8, 14, 2, 3, 7, 10, 18, 0, 5, 8, 16,
+                                      18, 18, 1, 4, 6, 14, 8, 18, 7, 7, 10
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation p(h,s)
+///  in subregion 2c.
+////////////////////////////////////////////////////////
+const double n_phs_2c[REG2C_PHS_COUNT] = {
+            0.112225607199012E+00, -0.339005953606712E+01, -0.320503911730094E+02, -0.197597305104900E+03,
+            -0.407693861553446E+03, 0.132943775222331E+05, 0.170846839774007E+01, 0.373694198142245E+02,
+            0.358144365815434E+04, 0.423014446424664E+06, -0.751071025760063E+09, 0.523446127607898E+02,
+            -0.228351290812417E+03, -0.960652417056937E+06, -0.807059292526074E+08, 0.162698017225669E+13,
+            0.772465073604171E+00, 0.463929973837746E+05, -0.137317885134128E+08, 0.170470392630512E+13,
+            -0.251104628187308E+14, 0.317748830835520E+14, 0.538685623675312E+02, -0.553089094625169E+05,
+            -0.102861522421405E+07, 0.204249418756234E+13, 0.273918446626977E+09, -0.263963146312685E+16,
+            -0.107890854108088E+10, -0.296492620980124E+11, -0.111754907323424E+16
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific enthalpy on the boundary between subregions 2a and 2b
+///  as a function of specific entropy
+///
+/// \param[in] s  specific entropy
+///
+/// \return specific enthalpy
+///////////////////////////////////////////////////////////////////////////////
+double b2ab_h_s(double s)
+{
+	return n_b2ab_hs[0] + s*(n_b2ab_hs[1] + s*(n_b2ab_hs[2] + s*n_b2ab_hs[3]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates pressure as a function of specific enthalpy and specific entropy
+///  in IAPWS Region 2 using the IAPWS-IF97 supplementary backward equations
+///
+/// Subregion 2c lies below s = 5.85 kJ/kg/K, and subregions 2a and 2b on either side of
+/// the enthalpy b2ab_h_s(s) above it.
+///
+/// \param[in] h  specific enthalpy
+/// \param[in] s  specific entropy
+///
+/// \return pressure
+///////////////////////////////////////////////////////////////////////////////
+double backward_p_hs_2(double h, double s)
+{
+	// the backward equations give a fourth root of the reduced pressure
+	double pi;
+	if (s < 5.85) {
+		pi = power_series(I_phs_2c, J_phs_2c, n_phs_2c, REG2C_PHS_COUNT, h/3500 - 0.7, s/5.9 - 1.1);
+		return 100 * pow(pi, 4);
+	}
+	if (h <= b2ab_h_s(s)) {
+		pi = power_series(I_phs_2a, J_phs_2a, n_phs_2a, REG2A_PHS_COUNT, h/4200 - 0.5, s/12 - 1.2);
+		return 4 * pow(pi, 4);
+	}
+	pi = power_series(I_phs_2b, J_phs_2b, n_phs_2b, REG2B_PHS_COUNT, h/4100 - 0.6, s/7.9 - 1.01);
+	return 100 * pow(pi, 4);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief refines pressure and temperature so that the forward equation reproduces a
+///  given specific enthalpy and specific entropy in IAPWS Region 2
+///
+/// \param[in] h  specific enthalpy
+/// \param[in] s  specific entropy
+/// \param[in,out] p  initial estimate of the pressure on input, refined pressure on output
+/// \param[in,out] t  initial estimate of the temperature on input, refined temperature on output
+/// \param[out] iterations number of iterations
+///
+/// \return true if the iteration converged within the range of Region 2
+///////////////////////////////////////////////////////////////////////////////
+static bool newton_pt_hs_2(double h, double s, double &p, double &t, int &iterations)
+{
+	for (int iter=0; iter<8; iter++) {
+		double pi = p / pstar;
+		double tau = tstar / t;
+		Gibbs ideal, residual;
+		gibbs_2(pi, tau, ideal, residual);
+		iterations = iter + 1;
+		double gamma = ideal.gamma + residual.gamma;
+		double gammapi = ideal.gammapi + residual.gammapi;
+		double gammatau = ideal.gammatau + residual.gammatau;
+		double gammatautau = ideal.gammatautau + residual.gammatautau;
+		double gammapitau = ideal.gammapitau + residual.gammapitau;
+		// residuals
+		double dh = tau*gammatau * R * t - h;
+		double ds = (tau*gammatau - gamma) * R - s;
+		// Jacobian
+		double h_p = tau*gammapitau * R * t / pstar;
+		double h_t = -tau*tau*gammatautau * R;
+		double s_p = (tau*gammapitau - gammapi) * R / pstar;
+		double s_t = h_t / t;
+		double det = h_p*s_t - h_t*s_p;
+		if (det == 0)
+			return false;
+		double step_p = (dh*s_t - h_t*ds) / det;
+		double step_t = (h_p*ds - dh*s_p) / det;
+		p -= step_p;
+		t -= step_t;
+		if (!((p > 0) && (p <= 100 + 1) && (t >= 273.15 - 1) && (t <= 1073.15 + 1)))
+			return false;
+		if ((fabs(step_p) <= 1E-12*p) && (fabs(step_t) <= 1E-12*t))
+			return true;
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates pressure and temperature as a function of specific enthalpy and
+///  specific entropy in IAPWS Region 2
+///
+/// The backward equations p(h,s) and T(p,s) are the starting point of a Newton iteration
+/// in pressure and temperature together.
+///
+/// \param[in] h  specific enthalpy
+/// \param[in] s  specific entropy
+/// \param[out] p  pressure
+/// \param[out] t  temperature
+///
+/// \return false if the iteration fails or the statepoint is not in Region 2, in which
+///  case the caller tries the other regions
+///////////////////////////////////////////////////////////////////////////////
+bool state_hs_2(double h, double s, double &p, double &t)
+{
+	// no state in Region 2 has a lower entropy than at 100 MPa on the Region 2/3 boundary
+	if (s < 5.048)
+		return false;
+	p = backward_p_hs_2(h, s);
+	if (!((p > 0) && (p <= 100 + 1)))
+		return false;
+	t = backward_t_ps_2(p, s);
+	int iterations = 0;
+	bool converged = newton_pt_hs_2(h, s, p, t, iterations);
+	RECORD_SOLVE(SOLVER_POLISH, iterations, iterations, 1073.15 + 1 - (273.15 - 1), converged);
+	if (!(converged && (p <= 100) && (t >= 273.15) && (t <= 1073.15)))
+		return false;
+	// a vapor must end up at or below the saturation pressure, or the Region 2/3 boundary
+	return p <= ((t <= 623.15) ? PSAT_T(t) : b23_p_t(t));
+}
@@ -43,6 +43,17 @@ const double tstar = 647.096;   // K
 ///	\brief Convergence tolerance when searching for zeros of polynomials.
 ////////////////////////////////////////////////////////
 const double tolerance = 1E-18;
+////////////////////////////////////////////////////////
+///	\brief Relative size of the Newton step at which the density iteration has converged.
+///
+/// Newton converges quadratically, so the density after a step of this size is
+/// accurate to machine precision.
+////////////////////////////////////////////////////////
+const double newton_tolerance = 1E-13;
+////////////////////////////////////////////////////////
+///	\brief Maximum number of Newton iterations before falling back to Brent's method.
+////////////////////////////////////////////////////////
+#define NEWTON_MAX_ITER 50
 //------------------------------------------------------------------------------
 // DATA TO SUPPORT SEARCHING FOR SATURATION DENSITIES
 
@@ -138,6 +149,102 @@ const double N[REG3_COUNT] = {
             -0.44923899061815E-04
         };
 
+////////////////////////////////////////////////////////
+///	\brief Largest exponents in I and J.
+////////////////////////////////////////////////////////
+#define REG3_I_MAX 11
+#define REG3_J_MAX 26
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief fills tables of integer powers of the reduced density and reduced temperature
+///
+/// pow[k + 2] = x^k for k = -2 ... the largest exponent, so that the derivative
+/// terms can index one or two powers below the exponent of each term.
+///
+/// \param[in] del reduced density
+/// \param[in] tau reduced temperature
+/// \param[out] delpow powers of the reduced density
+/// \param[out] taupow powers of the reduced temperature
+///////////////////////////////////////////////////////////////////////////////
+static void powers_3(double del, double tau, double delpow[REG3_I_MAX + 3], double taupow[REG3_J_MAX + 3])
+{
+	delpow[2] = 1;
+	for (int k=3; k<REG3_I_MAX+3; k++)
+		delpow[k] = delpow[k-1] * del;
+	delpow[1] = 1 / del;
+	delpow[0] = delpow[1] / del;
+	taupow[2] = 1;
+	for (int k=3; k<REG3_J_MAX+3; k++)
+		taupow[k] = taupow[k-1] * tau;
+	taupow[1] = 1 / tau;
+	taupow[0] = taupow[1] / tau;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the dimensionless Helmholtz free energy and all of its first
+///  and second order partial derivatives for IAPWS Region 3
+///
+/// The series is evaluated in a single pass over the exponent and coefficient arrays,
+/// with integer powers of del and tau built once by repeated multiplication.
+///
+/// \param[in] del reduced density
+/// \param[in] tau reduced temperature
+/// \param[out] f dimensionless Helmholtz free energy and its partial derivatives
+///////////////////////////////////////////////////////////////////////////////
+void helmholtz_3(double del, double tau, Helmholtz &f)
+{
+	double delpow[REG3_I_MAX + 3];
+	double taupow[REG3_J_MAX + 3];
+	powers_3(del, tau, delpow, taupow);
+
+	f.phi = N[0]*log(del);
+	f.phidel = N[0]/del;
+	f.phideldel = -N[0]/del/del;
+	f.phitau = 0;
+	f.phitautau = 0;
+	f.phideltau = 0;
+	for (int i=1; i<REG3_COUNT; i++) {
+		const double *di = &delpow[I[i] + 2];
+		const double *tj = &taupow[J[i] + 2];
+		double nI = N[i] * I[i];
+		double nJ = N[i] * J[i];
+		f.phi += N[i] * di[0] * tj[0];
+		f.phidel += nI * di[-1] * tj[0];
+		f.phideldel += nI * (I[i] - 1) * di[-2] * tj[0];
+		f.phitau += nJ * di[0] * tj[-1];
+		f.phitautau += nJ * (J[i] - 1) * di[0] * tj[-2];
+		f.phideltau += nI * J[i] * di[-1] * tj[-1];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the first and second order partial derivatives of the dimensionless
+///  Helmholtz free energy with respect to reduced density for IAPWS Region 3
+///
+/// These are the only derivatives needed to evaluate pressure and its slope with
+/// respect to density, e.g. when iterating on density at constant temperature.
+///
+/// \param[in] del reduced density
+/// \param[in] tau reduced temperature
+/// \param[out] phidel partial derivative with respect to reduced density
+/// \param[out] phideldel second order partial derivative with respect to reduced density
+///////////////////////////////////////////////////////////////////////////////
+void phidel_3(double del, double tau, double &phidel, double &phideldel)
+{
+	double delpow[REG3_I_MAX + 3];
+	double taupow[REG3_J_MAX + 3];
+	powers_3(del, tau, delpow, taupow);
+
+	phidel = N[0]/del;
+	phideldel = -N[0]/del/del;
+	for (int i=1; i<REG3_COUNT; i++) {
+		const double *di = &delpow[I[i] + 2];
+		double nI = N[i] * I[i] * taupow[J[i] + 2];
+		phidel += nI * di[-1];
+		phideldel += nI * (I[i] - 1) * di[-2];
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief calculates ideal-gas portion of the dimensionless Helmholtz free energy for IAPWS Region 3
 ///
@@ -148,11 +255,9 @@ const double N[REG3_COUNT] = {
 ///////////////////////////////////////////////////////////////////////////////
 double phi(double del, double tau)
 {
-	double result = N[0]*log(del);
-	for (int i=1; i<REG3_COUNT; i++) {
-		result += N[i]*pow(del,I[i])*pow(tau,J[i]);
-	}
-	return result;
+	Helmholtz f;
+	helmholtz_3(del, tau, f);
+	return f.phi;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -167,11 +272,9 @@ double phi(double del, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double phidel(double del, double tau)
 {
-	double result = N[0]/del;
-	for (int i=1; i<REG3_COUNT; i++) {
-		result += N[i]*I[i]*pow(del,I[i]-1)*pow(tau,J[i]);
-	}
-	return result;
+	double fd, fdd;
+	phidel_3(del, tau, fd, fdd);
+	return fd;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -186,11 +289,9 @@ double phidel(double del, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double phideldel(double del, double tau)
 {
-	double result = -N[0]/del/del;
-	for (int i=1; i<REG3_COUNT; i++) {
-		result += N[i]*I[i]*(I[i]-1)*pow(del,I[i]-2)*pow(tau,J[i]);
-	}
-	return result;
+	double fd, fdd;
+	phidel_3(del, tau, fd, fdd);
+	return fdd;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -205,11 +306,9 @@ double phideldel(double del, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double phitau(double del, double tau)
 {
-	double result = 0;
-	for (int i=1; i<REG3_COUNT; i++) {
-		result += N[i]*pow(del,I[i])*J[i]*pow(tau,J[i]-1);
-	}
-	return result;
+	Helmholtz f;
+	helmholtz_3(del, tau, f);
+	return f.phitau;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -224,11 +323,9 @@ double phitau(double del, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double phitautau(double del, double tau)
 {
-	double result = 0;
-	for (int i=1; i<REG3_COUNT; i++) {
-		result += N[i]*pow(del,I[i])*J[i]*(J[i]-1)*pow(tau,J[i]-2);
-	}
-	return result;
+	Helmholtz f;
+	helmholtz_3(del, tau, f);
+	return f.phitautau;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -243,15 +340,47 @@ double phitautau(double del, double tau)
 ///////////////////////////////////////////////////////////////////////////////
 double phideltau(double del, double tau)
 {
-	double result = 0;
-	for (int i=1; i<REG3_COUNT; i++) {
-		result += N[i]*I[i]*pow(del,I[i]-1)*J[i]*pow(tau,J[i]-1);
-	}
-	return result;
+	Helmholtz f;
+	helmholtz_3(del, tau, f);
+	return f.phideltau;
 }
 
 //-------------------------------------------------------------------------
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all thermodynamic properties as a function of density and temperature
+///  in IAPWS Region 3
+///
+/// Each derivative of the Helmholtz free energy is evaluated once and shared by all
+/// of the properties.  Transport properties are not calculated.
+///
+/// \param[in] d  density
+/// \param[in] t  temperature
+/// \param[out] state thermodynamic properties
+///////////////////////////////////////////////////////////////////////////////
+void state_dt_3(double d, double t, StatePT &state)
+{
+	double del = d / rhostar;
+	double tau = tstar / t;
+	Helmholtz helm;
+	helmholtz_3(del, tau, helm);
+	double f = helm.phi;
+	double fd = helm.phidel;
+	double fdd = helm.phideldel;
+	double ft = helm.phitau;
+	double ftt = helm.phitautau;
+	double fdt = helm.phideltau;
+	double zip = del*fd - del*tau*fdt;
+	double compress = 2*del*fd + del*del*fdd;
+	state.v = 1. / d;
+	state.s = (tau*ft - f) * R;
+	state.h = (tau*ft + del*fd) *R*t;
+	state.cp = (-tau*tau*ftt + zip*zip/compress) * R;
+	state.cv = -tau*tau*ftt * R;
+	// note that 1E3 added to make the units work
+	state.w = sqrt((compress - zip*zip/(tau*tau*ftt))*R*t*1E3);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief calculates specific enthalpy as a function of density and temperature in IAPWS Region 3
 ///
@@ -264,7 +393,9 @@ double h_dt_3(double d,double t)
 {
 	double del = d / rhostar;
 	double tau = tstar / t;
-	return (tau*phitau(del, tau) + del*phidel(del,tau)) *R*t;
+	Helmholtz f;
+	helmholtz_3(del, tau, f);
+	return (tau*f.phitau + del*f.phidel) *R*t;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -279,8 +410,9 @@ double s_dt_3(double d,double t)
 {
 	double del = d / rhostar;
 	double tau = tstar / t;
-	return (tau*phitau(del, tau) - phi(del,tau)) * R;
-	return 0;
+	Helmholtz f;
+	helmholtz_3(del, tau, f);
+	return (tau*f.phitau - f.phi) * R;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -295,9 +427,11 @@ double cp_dt_3(double d,double t)
 {
 	double del = d / rhostar;
 	double tau = tstar / t;
-	double part = pow(del*phidel(del,tau) - del*tau*phideltau(del,tau),2);
-	part = part / (2*del*phidel(del,tau) + del*del*phideldel(del,tau));
-	return (-tau*tau*phitautau(del,tau) + part) * R;
+	Helmholtz f;
+	helmholtz_3(del, tau, f);
+	double part = pow(del*f.phidel - del*tau*f.phideltau,2);
+	part = part / (2*del*f.phidel + del*del*f.phideldel);
+	return (-tau*tau*f.phitautau + part) * R;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -312,7 +446,9 @@ double cv_dt_3(double d,double t)
 {
 	double del = d / rhostar;
 	double tau = tstar / t;
-	return (-tau*tau*phitautau(del,tau)) * R;
+	Helmholtz f;
+	helmholtz_3(del, tau, f);
+	return (-tau*tau*f.phitautau) * R;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -327,9 +463,11 @@ double w_dt_3(double d,double t)
 {
 	double del = d / rhostar;
 	double tau = tstar / t;
-	double part = pow(del*phidel(del,tau)- del*tau*phideltau(del,tau), 2);
-	part = part / (tau*tau*phitautau(del,tau));
-	part = (2*del*phidel(del,tau) + del*del*phideldel(del,tau) - part)*R*t;
+	Helmholtz f;
+	helmholtz_3(del, tau, f);
+	double part = pow(del*f.phidel- del*tau*f.phideltau, 2);
+	part = part / (tau*tau*f.phitautau);
+	part = (2*del*f.phidel + del*del*f.phideldel - part)*R*t;
 	// note that 1E3 added to make the units work
 	return pow(part*1E3,0.5);
 }
@@ -351,6 +489,133 @@ double p_dt_3(double d, double t)
 	return p;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds the density within a bracket that gives the required pressure at
+///  a given temperature in IAPWS Region 3
+///
+/// By default a safeguarded Newton iteration is used, with the slope dp/drho taken
+/// from the analytic second derivative of the Helmholtz free energy.  Each iterate
+/// narrows the bracket, and a step that would leave the bracket is replaced by a
+/// bisection step.  If the bracket does not contain a sign change, or Newton fails
+/// to converge, Brent's method (zeroin) is used over the same bracket.
+///
+/// When the DENSITY_LEGACY solver is selected Brent's method alone is used, which
+/// reproduces earlier releases bit for bit.
+///
+/// A relative_tolerance setting larger than the Newton tolerance ends the Newton
+/// iteration sooner, and is passed on to Brent's method along with max_iterations.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[in] d_low lower end of the density bracket
+/// \param[in] d_high upper end of the density bracket
+///
+/// \return density
+///////////////////////////////////////////////////////////////////////////////
+static double solve_d_pt_3(double p, double t, double d_low, double d_high)
+{
+	const Settings &settings = active_settings();
+	if (settings.density_solver == DENSITY_LEGACY)
+		return zeroin_active(SOLVER_D_PT_3_BRENT, [t](double d) { return p_dt_3(d, t); }, d_low, d_high, p, tolerance);
+
+	double tau = tstar / t;
+	double rt = R * t / 1000;  // kPa to MPa
+	double f_low = p_dt_3(d_low, t) - p;
+	double f_high = p_dt_3(d_high, t) - p;
+	if (f_low == 0)
+		return d_low;
+	if (f_high == 0)
+		return d_high;
+	if ((f_low > 0) == (f_high > 0)) {
+		RECORD_SOLVE(SOLVER_D_PT_3_NEWTON, 0, 2, d_high - d_low, false);
+		RECORD_BRANCH(BRANCH_D_PT_3_FALLBACK);
+		return zeroin_active(SOLVER_D_PT_3_BRENT, [t](double d) { return p_dt_3(d, t); }, d_low, d_high, p, tolerance);
+	}
+
+	// keep the bracket oriented so that p(below) < p < p(above)
+	double below = (f_low < 0) ? d_low : d_high;
+	double above = (f_low < 0) ? d_high : d_low;
+	// start from the secant through the ends of the bracket
+	double d = d_low - f_low * (d_high - d_low) / (f_high - f_low);
+	double step_tolerance = (settings.relative_tolerance > newton_tolerance) ? settings.relative_tolerance : newton_tolerance;
+	for (int iter=0; iter<NEWTON_MAX_ITER; iter++) {
+		double del = d / rhostar;
+		double fd, fdd;
+		phidel_3(del, tau, fd, fdd);
+		double f = del*del*fd * rhostar * rt - p;
+		if (f == 0) {
+			RECORD_SOLVE(SOLVER_D_PT_3_NEWTON, iter + 1, iter + 3, d_high - d_low, true);
+			return d;
+		}
+		if (f < 0)
+			below = d;
+		else
+			above = d;
+		double slope = (2*del*fd + del*del*fdd) * rt;
+		double d_new = d - f / slope;
+		if (!((d_new - below) * (d_new - above) < 0))
+			d_new = 0.5 * (below + above);  // bisect
+		if (fabs(d_new - d) <= step_tolerance * d) {
+			RECORD_SOLVE(SOLVER_D_PT_3_NEWTON, iter + 1, iter + 3, d_high - d_low, true);
+			return d_new;
+		}
+		d = d_new;
+	}
+	RECORD_SOLVE(SOLVER_D_PT_3_NEWTON, NEWTON_MAX_ITER, NEWTON_MAX_ITER + 2, d_high - d_low, false);
+	RECORD_BRANCH(BRANCH_D_PT_3_FALLBACK);
+	return zeroin_active(SOLVER_D_PT_3_BRENT, [t](double d) { return p_dt_3(d, t); }, d_low, d_high, p, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates pressure and its derivative with respect to density as a function
+///  of temperature and density in IAPWS Region 3
+///
+/// The argument order matches newton2, which holds the first argument fixed.
+///
+/// \param[in] t  temperature
+/// \param[in] d  density
+/// \param[out] p  pressure
+/// \param[out] dpdd  derivative of pressure with respect to density
+///////////////////////////////////////////////////////////////////////////////
+static void p_dpdd_td_3(double t, double d, double &p, double &dpdd)
+{
+	double del = d / rhostar;
+	double tau = tstar / t;
+	double rt = R * t / 1000;  // kPa to MPa
+	double fd, fdd;
+	phidel_3(del, tau, fd, fdd);
+	p = del*del*fd * rhostar * rt;
+	dpdd = (2*del*fd + del*del*fdd) * rt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds the density within a bracket that gives the required pressure at
+///  a given temperature in IAPWS Region 3, honouring the backward_pt setting
+///
+/// BACKWARD_DIRECT returns the backward equation v(p,T) without iteration.
+/// BACKWARD_POLISH uses it as the starting point of a Newton iteration, falling
+/// back to solve_d_pt_3 if the iteration leaves the bracket.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[in] d_low lower end of the density bracket
+/// \param[in] d_high upper end of the density bracket
+///
+/// \return density
+///////////////////////////////////////////////////////////////////////////////
+static double find_d_pt_3(double p, double t, double d_low, double d_high)
+{
+	BackwardMode mode = active_settings().backward_pt;
+	if (mode == BACKWARD_DIRECT)
+		return 1 / backward_v_pt_3(p, t);
+	if (mode == BACKWARD_POLISH) {
+		double d = 1 / backward_v_pt_3(p, t);
+		if (newton_polish(p_dpdd_td_3, t, d_low, d_high, p, d))
+			return d;
+	}
+	return solve_d_pt_3(p, t, d_low, d_high);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief calculates density as a function of pressure and temperature in IAPWS Region 3
 ///
@@ -367,7 +632,8 @@ double d_pt_3(double p,double t)
 	double d_low = 100;  // minimum vapor density on the region 2 boundary
 	if (t > TC) {
 		// easy calculation - no saturation conditions to deal with
-		return zeroin1(p_dt_3, t, d_low, d_high, p, tolerance);
+		RECORD_BRANCH(BRANCH_D_PT_3_SUPERCRITICAL);
+		return find_d_pt_3(p, t, d_low, d_high);
 	}
 	else if ((t==TC)&&(p==PC)) {
 		// we are at the critical point.  return the known value.
@@ -382,13 +648,15 @@ double d_pt_3(double p,double t)
 			// give the tie to "liquid")
 			// get the bounding lower limit for liquid density at this temp
 			d_low = interpolate(sat_temps, liquid_density_lower_limit, SAT_TEMPS_COUNT, t);
-			return zeroin1(p_dt_3, t, d_low, d_high, p, tolerance);
+			RECORD_BRANCH(BRANCH_D_PT_3_LIQUID);
+			return find_d_pt_3(p, t, d_low, d_high);
 		}
 		else {
 			// vapor
 			// get the bounding upper limit for vapor density at this temp
 			d_high = interpolate(sat_temps, vapor_density_upper_limit, SAT_TEMPS_COUNT, t);
-			return zeroin1(p_dt_3, t, d_low, d_high, p, tolerance);
+			RECORD_BRANCH(BRANCH_D_PT_3_VAPOR);
+			return find_d_pt_3(p, t, d_low, d_high);
 		}
 	}
 }
@@ -415,7 +683,7 @@ double df_pt_3(double p, double t)
 		p=PSAT_T(t);
 	double d_high = 765;  // maximum liquid density on region 1 boundary
 	double d_low = interpolate(sat_temps, liquid_density_lower_limit, SAT_TEMPS_COUNT, t);
-	return zeroin1(p_dt_3, t, d_low, d_high, p, tolerance);
+	return solve_d_pt_3(p, t, d_low, d_high);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -441,7 +709,7 @@ double dv_pt_3(double p, double t)
 		p=PSAT_T(t);
 	double d_low = 100;  // minimum vapor density on the region 2 boundary
 	double d_high = interpolate(sat_temps, vapor_density_upper_limit, SAT_TEMPS_COUNT, t);
-	return zeroin1(p_dt_3, t, d_low, d_high, p, tolerance);
+	return solve_d_pt_3(p, t, d_low, d_high);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -460,21 +728,23 @@ double h_pt_3(double p, double t)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates temperature as a function of pressure and specific enthalpy in IAPWS Region 3
+/// \brief finds the temperature as a function of pressure and specific enthalpy in
+///  IAPWS Region 3 by iterating on the forward equation
 ///
 /// \param[in] p  pressure
 /// \param[in] h  specific enthalpy
 ///
 /// \return temperature
 ///////////////////////////////////////////////////////////////////////////////
-double t_ph_3(double p, double h)
+static double solve_t_ph_3(double p, double h)
 {
 	if (p >= 22.064) {
 		// root-find on h_pt_3 to find a value of t that will return h
 		// don't need to worry about the saturation region
 		double t_low = 623.15 - 1;
 		double t_high = b23_t_p(p) + 1;
-		return zeroin2(h_pt_3, p, t_low, t_high, h, tolerance);
+		RECORD_BRANCH(BRANCH_T_PH_3_SUPERCRITICAL);
+		return zeroin_active(SOLVER_T_PH_3, [p](double t) { return h_pt_3(p, t); }, t_low, t_high, h, tolerance);
 	}
 	// we are at a low enough pressure that saturation will occur and hence
 	//     the h_pt_3 function isn't continuous
@@ -483,20 +753,135 @@ double t_ph_3(double p, double h)
 	double h_sat_fluid = h_dt_3(d_sat_fluid, t_sat);
 	double d_sat_vapor = dv_pt_3(p, t_sat);
 	double h_sat_vapor = h_dt_3(d_sat_vapor, t_sat);
-	if ((h >= h_sat_fluid) && (h <= h_sat_vapor))
+	if ((h >= h_sat_fluid) && (h <= h_sat_vapor)) {
+		RECORD_BRANCH(BRANCH_T_PH_3_SATURATED);
 		return t_sat;
+	}
 	if (h < h_sat_fluid) {
 		// liquid
 		double t_low = 623.15 - 1;
 		double t_high = t_sat + 1;
-		return zeroin2(h_pt_3, p, t_low, t_high, h, tolerance);
+		RECORD_BRANCH(BRANCH_T_PH_3_LIQUID);
+		return zeroin_active(SOLVER_T_PH_3, [p](double t) { return h_pt_3(p, t); }, t_low, t_high, h, tolerance);
 	}
 	else {
 		// vapor
 		double t_low = t_sat - 1;
 		double t_high = b23_t_p(p) + 1;
-		return zeroin2(h_pt_3, p, t_low, t_high, h, tolerance);
+		RECORD_BRANCH(BRANCH_T_PH_3_VAPOR);
+		return zeroin_active(SOLVER_T_PH_3, [p](double t) { return h_pt_3(p, t); }, t_low, t_high, h, tolerance);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief refines density and temperature so that the forward equation reproduces a
+///  given pressure and specific enthalpy in IAPWS Region 3
+///
+/// A two-dimensional Newton iteration in (d,t), with the Jacobian taken from the
+/// analytic derivatives of the Helmholtz free energy.  Like newton2, the iteration
+/// gives up rather than bisecting so that the caller can fall back to a bracketing
+/// method.
+///
+/// \param[in] p  pressure
+/// \param[in] h  specific enthalpy
+/// \param[in,out] d  initial estimate of the density on input, refined density on output
+/// \param[in,out] t  initial estimate of the temperature on input, refined temperature on output
+/// \param[out] iterations number of iterations
+///
+/// \return true if the iteration converged within the temperature range of Region 3
+///////////////////////////////////////////////////////////////////////////////
+static bool newton_dt_ph_3(double p, double h, double &d, double &t, int &iterations)
+{
+	double t_low = 623.15 - 1;
+	double t_high = b23_t_p(p) + 1;
+	for (int iter=0; iter<8; iter++) {
+		double del = d / rhostar;
+		double tau = tstar / t;
+		Helmholtz f;
+		helmholtz_3(del, tau, f);
+		iterations = iter + 1;
+		double rt = R * t;
+		// residuals, with pressure converted from kPa to MPa
+		double dp = del*f.phidel * d * rt / 1000 - p;
+		double dh = (tau*f.phitau + del*f.phidel) * rt - h;
+		// Jacobian
+		double p_d = (2*del*f.phidel + del*del*f.phideldel) * rt / 1000;
+		double p_t = del*(f.phidel - tau*f.phideltau) * d * R / 1000;
+		double h_d = (del*f.phidel + del*del*f.phideldel + tau*del*f.phideltau) * rt / d;
+		double h_t = (del*f.phidel - tau*tau*f.phitautau - tau*del*f.phideltau) * R;
+		double det = p_d*h_t - p_t*h_d;
+		if (det == 0)
+			return false;
+		double step_d = (dp*h_t - p_t*dh) / det;
+		double step_t = (p_d*dh - dp*h_d) / det;
+		d -= step_d;
+		t -= step_t;
+		if (!((d > 0) && (t >= t_low) && (t <= t_high)))
+			return false;
+		if ((fabs(step_d) <= 1E-12*d) && (fabs(step_t) <= 1E-12*t))
+			return true;
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates density and temperature as a function of pressure and specific
+///  enthalpy in IAPWS Region 3 with the backward equations, honouring the backward_ph setting
+///
+/// BACKWARD_DIRECT returns the backward equations T(p,h) and v(p,h) without iteration.
+/// BACKWARD_POLISH uses them as the starting point of newton_dt_ph_3.  Within the
+/// two-phase region the saturation temperature and the saturated liquid density are
+/// returned, as when iterating on the forward equation.
+///
+/// \param[in] p  pressure
+/// \param[in] h  specific enthalpy
+/// \param[out] d  density
+/// \param[out] t  temperature
+///
+/// \return false if BACKWARD_OFF is selected or the Newton iteration fails, in which
+///  case the caller iterates on the forward equation instead
+///////////////////////////////////////////////////////////////////////////////
+static bool backward_dt_ph_3(double p, double h, double &d, double &t)
+{
+	BackwardMode mode = active_settings().backward_ph;
+	if (mode == BACKWARD_OFF)
+		return false;
+	if (p < PC) {
+		double t_sat = TSAT_P(p);
+		double h_sat_fluid = h_dt_3(df_pt_3(p, t_sat), t_sat);
+		double h_sat_vapor = h_dt_3(dv_pt_3(p, t_sat), t_sat);
+		if ((h >= h_sat_fluid) && (h <= h_sat_vapor)) {
+			t = t_sat;
+			d = d_pt_3(p, t);
+			return true;
+		}
 	}
+	t = backward_t_ph_3(p, h);
+	d = 1 / backward_v_ph_3(p, h);
+	if (mode == BACKWARD_DIRECT)
+		return true;
+	int iterations = 0;
+	bool converged = newton_dt_ph_3(p, h, d, t, iterations);
+	RECORD_SOLVE(SOLVER_POLISH, iterations, iterations, b23_t_p(p) + 1 - (623.15 - 1), converged);
+	if (!converged)
+		RECORD_BRANCH(BRANCH_POLISH_FALLBACK);
+	return converged;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific enthalpy in IAPWS Region 3
+///
+/// \param[in] p  pressure
+/// \param[in] h  specific enthalpy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double t_ph_3(double p, double h)
+{
+	double d, t;
+	if (backward_dt_ph_3(p, h, d, t))
+		return t;
+	return solve_t_ph_3(p, h);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -509,8 +894,11 @@ double t_ph_3(double p, double h)
 ///////////////////////////////////////////////////////////////////////////////
 double d_ph_3(double p, double h)
 {
-	// call t_ph_3
-	double t = t_ph_3(p, h);
+	double d, t;
+	if (backward_dt_ph_3(p, h, d, t))
+		return d;
+	// call solve_t_ph_3
+	t = solve_t_ph_3(p, h);
 	// call d_pt_3
 	return d_pt_3(p, t);
 }
@@ -525,12 +913,259 @@ double d_ph_3(double p, double h)
 ///////////////////////////////////////////////////////////////////////////////
 double s_ph_3(double p, double h)
 {
-	// call t_ph_3
-	double t = t_ph_3(p, h);
-	// call d_pt_3
-	double d = d_pt_3(p, t);
+	double d, t;
+	if (!backward_dt_ph_3(p, h, d, t)) {
+		// call solve_t_ph_3
+		t = solve_t_ph_3(p, h);
+		// call d_pt_3
+		d = d_pt_3(p, t);
+	}
 	// call s_dt_3
 	return s_dt_3(d, t);
 }
 
 
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds the temperature as a function of pressure and specific entropy in
+///  IAPWS Region 3 by iterating on the forward equation
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy, outside the two-phase region
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+static double solve_t_ps_3(double p, double s)
+{
+	auto s_pt_3 = [p](double t) { return s_dt_3(d_pt_3(p, t), t); };
+	if (p >= 22.064) {
+		double t_low = 623.15 - 1;
+		double t_high = b23_t_p(p) + 1;
+		return zeroin_active(SOLVER_T_PS_3, s_pt_3, t_low, t_high, s, tolerance);
+	}
+	double t_sat = TSAT_P(p);
+	if (s < s_dt_3(df_pt_3(p, t_sat), t_sat)) {
+		// liquid
+		double t_low = 623.15 - 1;
+		double t_high = t_sat + 1;
+		return zeroin_active(SOLVER_T_PS_3, s_pt_3, t_low, t_high, s, tolerance);
+	}
+	// vapor
+	double t_low = t_sat - 1;
+	double t_high = b23_t_p(p) + 1;
+	return zeroin_active(SOLVER_T_PS_3, s_pt_3, t_low, t_high, s, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief refines density and temperature so that the forward equation reproduces a
+///  given pressure and specific entropy in IAPWS Region 3
+///
+/// The counterpart of newton_dt_ph_3 for specific entropy.
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy
+/// \param[in,out] d  initial estimate of the density on input, refined density on output
+/// \param[in,out] t  initial estimate of the temperature on input, refined temperature on output
+/// \param[out] iterations number of iterations
+///
+/// \return true if the iteration converged within the temperature range of Region 3
+///////////////////////////////////////////////////////////////////////////////
+static bool newton_dt_ps_3(double p, double s, double &d, double &t, int &iterations)
+{
+	double t_low = 623.15 - 1;
+	double t_high = b23_t_p(p) + 1;
+	for (int iter=0; iter<8; iter++) {
+		double del = d / rhostar;
+		double tau = tstar / t;
+		Helmholtz f;
+		helmholtz_3(del, tau, f);
+		iterations = iter + 1;
+		double rt = R * t;
+		// residuals, with pressure converted from kPa to MPa
+		double dp = del*f.phidel * d * rt / 1000 - p;
+		double ds = (tau*f.phitau - f.phi) * R - s;
+		// Jacobian
+		double p_d = (2*del*f.phidel + del*del*f.phideldel) * rt / 1000;
+		double p_t = del*(f.phidel - tau*f.phideltau) * d * R / 1000;
+		double s_d = del*(tau*f.phideltau - f.phidel) * R / d;
+		double s_t = -tau*tau*f.phitautau * R / t;
+		double det = p_d*s_t - p_t*s_d;
+		if (det == 0)
+			return false;
+		double step_d = (dp*s_t - p_t*ds) / det;
+		double step_t = (p_d*ds - dp*s_d) / det;
+		d -= step_d;
+		t -= step_t;
+		if (!((d > 0) && (t >= t_low) && (t <= t_high)))
+			return false;
+		if ((fabs(step_d) <= 1E-12*d) && (fabs(step_t) <= 1E-12*t))
+			return true;
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature, specific enthalpy, and specific volume as a function
+///  of pressure and specific entropy in IAPWS Region 3
+///
+/// The backward equations T(p,s) and v(p,T) are the starting point of a Newton iteration
+/// in density and temperature together, which gives way to Brent's method on temperature
+/// if it fails or lands on the wrong side of the saturation line.  Below the critical
+/// pressure, a specific entropy between those of the saturated liquid and vapor gives a
+/// two-phase mixture at the saturation temperature.
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy
+/// \param[out] t  temperature
+/// \param[out] h  specific enthalpy
+/// \param[out] v  specific volume
+///////////////////////////////////////////////////////////////////////////////
+void state_ps_3(double p, double s, double &t, double &h, double &v)
+{
+	double t_sat = 0, d_sat_fluid = 0, d_sat_vapor = 0;
+	double s_sat_fluid = 0, s_sat_vapor = 0;
+	if (p < PC) {
+		t_sat = TSAT_P(p);
+		d_sat_fluid = df_pt_3(p, t_sat);
+		d_sat_vapor = dv_pt_3(p, t_sat);
+		s_sat_fluid = s_dt_3(d_sat_fluid, t_sat);
+		s_sat_vapor = s_dt_3(d_sat_vapor, t_sat);
+		if ((s >= s_sat_fluid) && (s <= s_sat_vapor)) {
+			double x = (s - s_sat_fluid) / (s_sat_vapor - s_sat_fluid);
+			double h_sat_fluid = h_dt_3(d_sat_fluid, t_sat);
+			t = t_sat;
+			h = h_sat_fluid + x*(h_dt_3(d_sat_vapor, t_sat) - h_sat_fluid);
+			v = 1/d_sat_fluid + x*(1/d_sat_vapor - 1/d_sat_fluid);
+			return;
+		}
+	}
+	t = backward_t_ps_3(p, s);
+	double d = 1 / backward_v_pt_3(p, t);
+	int iterations = 0;
+	bool converged = newton_dt_ps_3(p, s, d, t, iterations);
+	// a liquid must end up denser, and a vapor less dense, than at saturation
+	if (converged && (p < PC))
+		converged = (s < s_sat_fluid) ? (d >= d_sat_fluid) : (d <= d_sat_vapor);
+	RECORD_SOLVE(SOLVER_POLISH, iterations, iterations, b23_t_p(p) + 1 - (623.15 - 1), converged);
+	if (!converged) {
+		RECORD_BRANCH(BRANCH_POLISH_FALLBACK);
+		t = solve_t_ps_3(p, s);
+		d = d_pt_3(p, t);
+	}
+	h = h_dt_3(d, t);
+	v = 1 / d;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy in IAPWS Region 3
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double t_ps_3(double p, double s)
+{
+	double t, h, v;
+	state_ps_3(p, s, t, h, v);
+	return t;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief refines density and temperature so that the forward equation reproduces a
+///  given specific enthalpy and specific entropy in IAPWS Region 3
+///
+/// The counterpart of newton_dt_ph_3 and newton_dt_ps_3 for specific enthalpy and
+/// specific entropy.
+///
+/// \param[in] h  specific enthalpy
+/// \param[in] s  specific entropy
+/// \param[in,out] d  initial estimate of the density on input, refined density on output
+/// \param[in,out] t  initial estimate of the temperature on input, refined temperature on output
+/// \param[out] iterations number of iterations
+///
+/// \return true if the iteration converged within the temperature range of Region 3
+///////////////////////////////////////////////////////////////////////////////
+static bool newton_dt_hs_3(double h, double s, double &d, double &t, int &iterations)
+{
+	double t_low = 623.15 - 1;
+	double t_high = b23_t_p(100) + 1;
+	for (int iter=0; iter<8; iter++) {
+		double del = d / rhostar;
+		double tau = tstar / t;
+		Helmholtz f;
+		helmholtz_3(del, tau, f);
+		iterations = iter + 1;
+		double rt = R * t;
+		// residuals
+		double dh = (tau*f.phitau + del*f.phidel) * rt - h;
+		double ds = (tau*f.phitau - f.phi) * R - s;
+		// Jacobian
+		double h_d = (del*f.phidel + del*del*f.phideldel + tau*del*f.phideltau) * rt / d;
+		double h_t = (del*f.phidel - tau*tau*f.phitautau - tau*del*f.phideltau) * R;
+		double s_d = del*(tau*f.phideltau - f.phidel) * R / d;
+		double s_t = -tau*tau*f.phitautau * R / t;
+		double det = h_d*s_t - h_t*s_d;
+		if (det == 0)
+			return false;
+		double step_d = (dh*s_t - h_t*ds) / det;
+		double step_t = (h_d*ds - dh*s_d) / det;
+		d -= step_d;
+		t -= step_t;
+		if (!((d > 0) && (t >= t_low) && (t <= t_high)))
+			return false;
+		if ((fabs(step_d) <= 1E-12*d) && (fabs(step_t) <= 1E-12*t))
+			return true;
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates pressure and temperature as a function of specific enthalpy and
+///  specific entropy in IAPWS Region 3
+///
+/// The backward equations p(h,s), T(p,s), and v(p,T) are the starting point of a Newton
+/// iteration in density and temperature together.  The two-phase states below the
+/// critical pressure are not in Region 3 here; nor are the metastable and unstable
+/// states that the Helmholtz equation also describes there.
+///
+/// \param[in] h  specific enthalpy
+/// \param[in] s  specific entropy
+/// \param[out] p  pressure
+/// \param[out] t  temperature
+///
+/// \return false if the iteration fails or the statepoint is not in Region 3, in which
+///  case the caller tries the other regions
+///////////////////////////////////////////////////////////////////////////////
+bool state_hs_3(double h, double s, double &p, double &t)
+{
+	// Region 3 lies between the entropy at 100 MPa and 623.15 K, and the largest
+	// entropy on the B23 line, near 19.09 MPa
+	if ((s < 3.397782955) || (s > 5.260578707))
+		return false;
+	p = backward_p_hs_3(h, s);
+	if (!((p > 16.5292 - 1) && (p <= 100 + 1)))
+		return false;
+	t = backward_t_ps_3(p, s);
+	double d = 1 / backward_v_pt_3(p, t);
+	int iterations = 0;
+	bool converged = newton_dt_hs_3(h, s, d, t, iterations);
+	RECORD_SOLVE(SOLVER_POLISH, iterations, iterations, b23_t_p(100) + 1 - (623.15 - 1), converged);
+	if (!converged)
+		return false;
+	double del = d / rhostar;
+	double tau = tstar / t;
+	double phidel, phideldel;
+	phidel_3(del, tau, phidel, phideldel);
+	double rt = R * t;
+	p = del*phidel * d * rt / 1000;
+	if (!((p <= 100) && (t >= 623.15) && (t <= b23_t_p(p))))
+		return false;
+	// the state must be mechanically stable and, below the critical pressure, a liquid
+	// at or below the saturation temperature or a vapor at or above it
+	if ((2*del*phidel + del*del*phideldel) <= 0)
+		return false;
+	if (p < PC)
+		return (d > DC) ? (t <= TSAT_P(p)) : (t >= TSAT_P(p));
+	return true;
+}
@@ -31,6 +31,12 @@
 #include<math.h>
 #pragma warning (disable : 4996)
 
+////////////////////////////////////////////////////////
+///	\brief Maximum number of iterations of the saturation temperature as a function
+///  of specific enthalpy and specific entropy.
+////////////////////////////////////////////////////////
+#define NEWTON_MAX_ITER 50
+
 ////////////////////////////////////////////////////////
 ///	\brief Numerical values of the coefficents of the dimensionless saturation equations.
 ////////////////////////////////////////////////////////
@@ -126,3 +132,146 @@ double s_ph_4(double p, double h)
 	double s = (h - region1_h)/(region2_h - region1_h)*(region2_s - region1_s) + region1_s;
 	return s;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturation temperature, specific enthalpy, and specific volume
+///  as a function of pressure and specific entropy
+///
+/// \param[in] p pressure in MPa
+/// \param[in] s specific entropy in kJ/kg/K
+/// \param[out] t temperature in K
+/// \param[out] h specific enthalpy in kJ/kg
+/// \param[out] v specific volume in m3/kg
+///////////////////////////////////////////////////////////////////////////////
+void state_ps_4(double p, double s, double &t, double &h, double &v)
+{
+	if (p > 16.5292)
+		throw "pressure out of bounds for function state_ps_4";
+	t = TSAT_P(p);
+	StatePT liquid, vapor;
+	state_pt_1(p, t, liquid);
+	state_pt_2(p, t, vapor);
+	double x = (s - liquid.s)/(vapor.s - liquid.s);
+	h = liquid.h + x*(vapor.h - liquid.h);
+	v = liquid.v + x*(vapor.v - liquid.v);
+}
+
+////////////////////////////////////////////////////////
+///	\brief Length of exponent and coefficient arrays for the backward equation
+///  T_sat(h,s) in IAPWS Region 4.
+////////////////////////////////////////////////////////
+#define REG4_THS_COUNT 36
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced enthalpy exponents of the backward
+///  equation T_sat(h,s) in IAPWS Region 4 (IAPWS SR4-04).
+////////////////////////////////////////////////////////
+const int I_ths[REG4_THS_COUNT] = {
+                                      0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 5, 5, 5, 5,
+                                      6, 6, 6, 8, 10, 10, 12, 14, 14, 16, 16, 18, 18, 18, 20, 28
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the reduced entropy exponents of the backward
+///  equation T_sat(h,s) in IAPWS Region 4.
+////////////////////////////////////////////////////////
+const int J_ths[REG4_THS_COUNT] = {
+                                      0, 3, 12, 0, 1, 2, 5, 0, 5, 8, 0, 2, 3, 4, 0, 1, 1, 2, 4, 16,
+                                      6, 8, 22, 1, 20, 36, 24, 1, 28, 12, 32, 14, 22, 36, 24, 36
+                                  };
+
+////////////////////////////////////////////////////////
+///	\brief Numerical values of the coefficients of the backward equation T_sat(h,s)
+///  in IAPWS Region 4.
+////////////////////////////////////////////////////////
+const double n_ths[REG4_THS_COUNT] = {
+            0.179882673606601E+00, -0.267507455199603E+00, 0.116276722612600E+01, 0.147545428713616E+00,
+            -0.512871635973248E+00, 0.421333567697984E+00, 0.563749522189870E+00, 0.429274443819153E+00,
+            -0.335704552142140E+01, 0.108890916499278E+02, -0.248483390456012E+00, 0.304153221906390E+00,
+            -0.494819763939905E+00, 0.107551674933261E+01, 0.733888415457688E-01, 0.140170545411085E-01,
+            -0.106110975998808E+00, 0.168324361811875E-01, 0.125028363714877E+01, 0.101316840309509E+04,
+            -0.151791558000712E+01, 0.524277865990866E+02, 0.230495545563912E+05, 0.249459806365456E-01,
+            0.210796467412137E+07, 0.366836848613065E+09, -0.144814105365163E+09, -0.179276373003590E-02,
+            0.489955602100459E+10, 0.471262212070518E+03, -0.829294390198652E+11, -0.171545662263191E+04,
+            0.355777682973575E+07, 0.586062760258436E+12, -0.129887635078195E+08, 0.317247449371057E+11
+        };
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturation temperature as a function of specific enthalpy and
+///  specific entropy using the IAPWS-IF97 supplementary backward equation
+///
+/// The backward equation is valid in the two-phase region at or above the entropy of
+/// the saturated vapor at 623.15 K.
+///
+/// \param[in] h enthalpy in kJ/kg
+/// \param[in] s specific entropy in kJ/kg/K
+///
+/// \return temperature in Kelvin
+///////////////////////////////////////////////////////////////////////////////
+double backward_t_hs_4(double h, double s)
+{
+	// reference quantities are T* = 550 K, h* = 2800 kJ/kg, and s* = 9.2 kJ/kg/K
+	return 550 * power_series(I_ths, J_ths, n_ths, REG4_THS_COUNT, h/2800 - 0.119, s/9.2 - 1.07);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturation pressure and temperature as a function of specific
+///  enthalpy and specific entropy
+///
+/// The temperature is the one at which specific enthalpy and specific entropy give the
+/// same quality, the root of h - h'(T) - (s - s'(T)) (h''(T) - h'(T)) / (s''(T) - s'(T)).
+/// The last factor is close to T, so the root falls with temperature wherever s > s'(T).
+/// Newton's method on it starts from the backward equation T_sat(h,s) where that is
+/// valid, and is safeguarded by bisection between 273.15 K and 623.15 K.  The two-phase
+/// states above 623.15 K belong to Region 3.
+///
+/// \param[in] h enthalpy in kJ/kg
+/// \param[in] s specific entropy in kJ/kg/K
+/// \param[out] p pressure in MPa
+/// \param[out] t temperature in K
+///
+/// \return false if the iteration fails or the statepoint is not a two-phase mixture
+///  at or below 623.15 K, in which case the caller tries the other regions
+///////////////////////////////////////////////////////////////////////////////
+bool state_hs_4(double h, double s, double &p, double &t)
+{
+	// the saturated liquid and vapor at 273.15 K bound the entropy of a mixture
+	if ((s < -0.000154550) || (s > 9.155759395))
+		return false;
+	double t_low = 273.15;
+	double t_high = 623.15;
+	t = (s >= 5.210887825) ? backward_t_hs_4(h, s) : (t_low + t_high)/2;
+	for (int iter=0; iter<NEWTON_MAX_ITER; iter++) {
+		if (!((t >= t_low) && (t <= t_high)))
+			t = (t_low + t_high)/2;
+		p = PSAT_T(t);
+		StatePT liquid, vapor;
+		state_pt_1(p, t, liquid);
+		state_pt_2(p, t, vapor);
+		double next;
+		if (s < liquid.s) {
+			// hotter than the saturated liquid with this entropy
+			t_high = t;
+			next = (t_low + t_high)/2;
+		}
+		else {
+			double f = h - liquid.h - (s - liquid.s)*(vapor.h - liquid.h)/(vapor.s - liquid.s);
+			if (f > 0)
+				t_low = t;
+			else
+				t_high = t;
+			// the slope, taking the factor as T, with that of the saturation pressure from
+			// the Clausius-Clapeyron equation
+			double slope = -(s - liquid.s) - liquid.v*(vapor.h - liquid.h)/(t*(vapor.v - liquid.v));
+			next = t - f/slope;
+			if (fabs(next - t) <= 1E-12*t) {
+				double x = (s - liquid.s)/(vapor.s - liquid.s);
+				return (x >= 0) && (x <= 1);
+			}
+		}
+		if (t_high - t_low <= 1E-12*t_high)
+			return false;
+		t = next;
+	}
+	return false;
+}
@@ -316,6 +316,40 @@ double r5gammapitaur(double pi, double tau)
 	return sum;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all thermodynamic properties as a function of pressure and temperature
+///  in IAPWS Region 5
+///
+/// Each derivative of the Gibbs free energy is evaluated once and shared by all
+/// of the properties.  Transport properties are not calculated.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] state thermodynamic properties
+///////////////////////////////////////////////////////////////////////////////
+void state_pt_5(double p, double t, StatePT &state)
+{
+	double pi = p/pstar;
+	double tau = tstar/t;
+	double g = r5gamma0(pi,tau) + r5gammar(pi,tau);
+	double gt = r5gammatau0(pi,tau) + r5gammataur(pi,tau);
+	double gtt = r5gammatautau0(pi,tau) + r5gammatautaur(pi,tau);
+	double gpr = r5gammapir(pi,tau);
+	double gppr = r5gammapipir(pi,tau);
+	double gptr = r5gammapitaur(pi,tau);
+	double zip = 1 + pi*gpr - tau*pi*gptr;
+	// note that p has units of MPa, so multiply by 1E3 to get the proper units
+	state.v = (r5gammapi0(pi,tau) + gpr)*pi*R*t/(p*1E3);
+	state.s = R*(tau*gt - g);
+	state.h = tau*gt*R*t;
+	state.cp = -tau*tau*gtt*R;
+	state.cv = (-tau*tau*gtt - zip*zip/(1 - pi*pi*gppr)) * R;
+	double top = 1 + 2*pi*gpr + pi*gpr*pi*gpr;
+	double bottom = (1 - pi*pi*gppr) + zip*zip/(tau*tau*gtt);
+	// note that 1E3 added to make the units work
+	state.w = sqrt(top/bottom *R*t*1E3);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief calculates specific volume as a function of pressure and temperature in IAPWS Region 5
 ///
@@ -409,7 +443,7 @@ double t_ph_5(double p, double h)
 {
 	double t_low = 1073.15 - 1;
 	double t_high = 2273.15 + 1;
-	return zeroin2(h_pt_5, p, t_low, t_high, h, tolerance);
+	return zeroin_active(SOLVER_T_PH_5, [p](double t) { return h_pt_5(p, t); }, t_low, t_high, h, tolerance);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -439,3 +473,18 @@ double s_ph_5(double p, double h)
 	double t = t_ph_5(p, h);
 	return s_pt_5(p, t);
 }
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy in IAPWS Region 5
+///
+/// \param[in] p  pressure
+/// \param[in] s  specific entropy
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+double t_ps_5(double p, double s)
+{
+	double t_low = 1073.15 - 1;
+	double t_high = 2273.15 + 1;
+	return zeroin_active(SOLVER_T_PS_5, [p](double t) { return s_pt_5(p, t); }, t_low, t_high, s, tolerance);
+}
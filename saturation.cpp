@@ -0,0 +1,343 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file saturation.cpp
+///	\brief Properties of water and steam along the saturation line.
+///
+/// The saturated properties are normally calculated from the region 1 and 2
+/// equations (below 623.15 K) or the region 3 equation (above 623.15 K) at the
+/// saturation pressure.  When the SATURATION_TABLE method is selected they are
+/// instead interpolated from a table of cubic Hermite splines that is built the
+/// first time it is needed.
+///
+/// The splines use the variable u = sqrt(TC - t), in which the saturated
+/// properties remain smooth up to the critical point, and the specific volumes
+/// are interpolated as logarithms.  The table is split at 623.15 K so that no
+/// spline crosses the boundary between the region 1/2 and region 3 equations,
+/// and it stops short of the critical point, where the region 3 density solution
+/// itself becomes unreliable; above that the exact calculation is used.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+ 
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+ 
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "iapws.h"
+#include <math.h>
+
+////////////////////////////////////////////////////////
+///	\brief Temperature at which the saturation table switches from the region 1 and 2
+///  equations to the region 3 equation.
+////////////////////////////////////////////////////////
+const double t_boundary = 623.15;     // K
+////////////////////////////////////////////////////////
+///	\brief Highest temperature covered by the saturation table.
+////////////////////////////////////////////////////////
+const double t_table_max = TC - 0.5;  // K
+////////////////////////////////////////////////////////
+///	\brief Number of spline intervals between 273.15 K and 623.15 K.
+////////////////////////////////////////////////////////
+#define SAT_INTERVALS_LOW 256
+////////////////////////////////////////////////////////
+///	\brief Number of spline intervals between 623.15 K and t_table_max.
+////////////////////////////////////////////////////////
+#define SAT_INTERVALS_HIGH 128
+////////////////////////////////////////////////////////
+///	\brief Number of saturated properties held in the table.
+////////////////////////////////////////////////////////
+#define SAT_PROPERTY_COUNT 6
+////////////////////////////////////////////////////////
+///	\brief Factor applied to the largest error found at the check points to give the
+///  reported error bound, allowing for larger errors between the check points.
+////////////////////////////////////////////////////////
+const double error_margin = 2;
+
+////////////////////////////////////////////////////////
+///	\brief Values and derivatives with respect to u of the tabulated properties at a knot.
+////////////////////////////////////////////////////////
+struct SatKnot {
+	double y[SAT_PROPERTY_COUNT];   ///< hf, hg, sf, sg, ln(vf), ln(vg)
+	double dy[SAT_PROPERTY_COUNT];  ///< derivatives of y with respect to u
+};
+
+////////////////////////////////////////////////////////
+///	\brief Knots equally spaced in u over one temperature range of the table.
+////////////////////////////////////////////////////////
+struct SatSegment {
+	double u_low;       ///< u at the first knot (the high temperature end)
+	double du;          ///< spacing of the knots in u
+	int intervals;      ///< number of intervals
+	SatKnot *knots;     ///< knots, intervals+1 of them
+};
+
+////////////////////////////////////////////////////////
+///	\brief The saturation table and the largest errors found when it was built.
+////////////////////////////////////////////////////////
+struct SatTable {
+	SatKnot low_knots[SAT_INTERVALS_LOW + 1];
+	SatKnot high_knots[SAT_INTERVALS_HIGH + 1];
+	SatSegment low;
+	SatSegment high;
+	double error[SAT_PROPERTY_COUNT];  ///< absolute for h and s, relative for v
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates a saturated property exactly from the equations for a region
+///
+/// \param[in] property saturated property
+/// \param[in] region 1 for the region 1 and 2 equations, 3 for the region 3 equation
+/// \param[in] p  saturation pressure
+/// \param[in] t  saturation temperature
+///
+/// \return saturated property
+///////////////////////////////////////////////////////////////////////////////
+static double saturated_exact(SaturatedProperty property, int region, double p, double t)
+{
+	if (region == 1) {
+		switch (property) {
+			case SAT_HF:
+				return h_pt_1(p, t);
+			case SAT_HG:
+				return h_pt_2(p, t);
+			case SAT_SF:
+				return s_pt_1(p, t);
+			case SAT_SG:
+				return s_pt_2(p, t);
+			case SAT_VF:
+				return v_pt_1(p, t);
+			case SAT_VG:
+				return v_pt_2(p, t);
+		}
+	}
+	else {
+		switch (property) {
+			case SAT_HF:
+				return h_dt_3(df_pt_3(p, t), t);
+			case SAT_HG:
+				return h_dt_3(dv_pt_3(p, t), t);
+			case SAT_SF:
+				return s_dt_3(df_pt_3(p, t), t);
+			case SAT_SG:
+				return s_dt_3(dv_pt_3(p, t), t);
+			case SAT_VF:
+				return 1 / df_pt_3(p, t);
+			case SAT_VG:
+				return 1 / dv_pt_3(p, t);
+		}
+	}
+	throw "invalid saturated property";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all of the tabulated quantities at a value of u
+///
+/// \param[in] region 1 for the region 1 and 2 equations, 3 for the region 3 equation
+/// \param[in] u  sqrt(TC - t)
+/// \param[out] y hf, hg, sf, sg, ln(vf), ln(vg)
+///////////////////////////////////////////////////////////////////////////////
+static void tabulated_exact(int region, double u, double y[SAT_PROPERTY_COUNT])
+{
+	double t = TC - u*u;
+	double p = PSAT_T(t);
+	for (int k=0; k<SAT_PROPERTY_COUNT; k++)
+		y[k] = saturated_exact((SaturatedProperty) k, region, p, t);
+	y[SAT_VF] = log(y[SAT_VF]);
+	y[SAT_VG] = log(y[SAT_VG]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief interpolates a tabulated quantity with a cubic Hermite spline
+///
+/// \param[in] seg table segment
+/// \param[in] u  sqrt(TC - t), within the segment
+/// \param[in] k  index of the tabulated quantity
+///
+/// \return interpolated value of hf, hg, sf, sg, ln(vf) or ln(vg)
+///////////////////////////////////////////////////////////////////////////////
+static double hermite(const SatSegment &seg, double u, int k)
+{
+	double x = (u - seg.u_low) / seg.du;
+	int i = (int) x;
+	if (i < 0)
+		i = 0;
+	if (i > seg.intervals - 1)
+		i = seg.intervals - 1;
+	double f = x - i;
+	const SatKnot &a = seg.knots[i];
+	const SatKnot &b = seg.knots[i+1];
+	double g = 1 - f;
+	// Hermite basis functions
+	double h00 = g*g*(1 + 2*f);
+	double h01 = f*f*(3 - 2*f);
+	double h10 = f*g*g;
+	double h11 = -f*f*g;
+	return h00*a.y[k] + h01*b.y[k] + seg.du*(h10*a.dy[k] + h11*b.dy[k]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief tabulates the saturated properties over a temperature range and records
+///  the largest interpolation errors
+///
+/// The derivatives at the knots are central differences (one-sided at the ends of
+/// the range, so that the equations are not evaluated outside it).  The errors are
+/// found by comparing the splines with the exact values at the quarter points of
+/// every interval, and are multiplied by error_margin to give the reported bound.
+///
+/// \param[out] seg table segment
+/// \param[in] knots storage for intervals+1 knots
+/// \param[in] intervals number of intervals
+/// \param[in] region 1 for the region 1 and 2 equations, 3 for the region 3 equation
+/// \param[in] t_low lowest temperature of the range
+/// \param[in] t_high highest temperature of the range
+/// \param[in,out] error largest errors found so far
+///////////////////////////////////////////////////////////////////////////////
+static void build_segment(SatSegment &seg, SatKnot knots[], int intervals, int region, double t_low, double t_high, double error[SAT_PROPERTY_COUNT])
+{
+	seg.u_low = sqrt(TC - t_high);
+	seg.du = (sqrt(TC - t_low) - seg.u_low) / intervals;
+	seg.intervals = intervals;
+	seg.knots = knots;
+	double step = 1E-3 * seg.du;
+	for (int i=0; i<=intervals; i++) {
+		double u = seg.u_low + i*seg.du;
+		double y1[SAT_PROPERTY_COUNT], y2[SAT_PROPERTY_COUNT];
+		tabulated_exact(region, u, knots[i].y);
+		if (i == 0) {
+			tabulated_exact(region, u + step, y1);
+			tabulated_exact(region, u + 2*step, y2);
+			for (int k=0; k<SAT_PROPERTY_COUNT; k++)
+				knots[i].dy[k] = (-3*knots[i].y[k] + 4*y1[k] - y2[k]) / (2*step);
+		}
+		else if (i == intervals) {
+			tabulated_exact(region, u - step, y1);
+			tabulated_exact(region, u - 2*step, y2);
+			for (int k=0; k<SAT_PROPERTY_COUNT; k++)
+				knots[i].dy[k] = (3*knots[i].y[k] - 4*y1[k] + y2[k]) / (2*step);
+		}
+		else {
+			tabulated_exact(region, u - step, y1);
+			tabulated_exact(region, u + step, y2);
+			for (int k=0; k<SAT_PROPERTY_COUNT; k++)
+				knots[i].dy[k] = (y2[k] - y1[k]) / (2*step);
+		}
+	}
+	for (int i=0; i<intervals; i++) {
+		for (int j=1; j<=3; j++) {
+			double u = seg.u_low + (i + 0.25*j)*seg.du;
+			double y[SAT_PROPERTY_COUNT];
+			tabulated_exact(region, u, y);
+			for (int k=0; k<SAT_PROPERTY_COUNT; k++) {
+				double e = hermite(seg, u, k) - y[k];
+				if ((k == SAT_VF) || (k == SAT_VG))
+					e = expm1(e);  // relative error in v
+				if (error_margin*fabs(e) > error[k])
+					error[k] = error_margin*fabs(e);
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief builds the saturation table
+///
+/// The table is built with the default solver options whatever the options of
+/// the calling thread, so that it does not depend on the thread that happens to
+/// use it first.
+///
+/// \return the new table
+///////////////////////////////////////////////////////////////////////////////
+static SatTable *build_saturation_table(void)
+{
+	Settings previous = GET_SETTINGS();
+	SET_SETTINGS(default_settings);
+	SatTable *table = new SatTable;
+	try {
+		for (int k=0; k<SAT_PROPERTY_COUNT; k++)
+			table->error[k] = 0;
+		build_segment(table->low, table->low_knots, SAT_INTERVALS_LOW, 1, 273.15, t_boundary, table->error);
+		build_segment(table->high, table->high_knots, SAT_INTERVALS_HIGH, 3, t_boundary, t_table_max, table->error);
+	}
+	catch(...) {
+		SET_SETTINGS(previous);
+		delete table;
+		throw;
+	}
+	SET_SETTINGS(previous);
+	return table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the saturation table, building it on first use
+///
+/// The table is built once per process; initialization of the function-local
+/// static is thread safe.
+///
+/// \return saturation table
+///////////////////////////////////////////////////////////////////////////////
+static const SatTable &saturation_table(void)
+{
+	static const SatTable *table = build_saturation_table();
+	return *table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates a property of saturated water or steam
+///
+/// The property is interpolated from the saturation table when the SATURATION_TABLE
+/// method is selected and the temperature is within the table; otherwise it is
+/// calculated from the region 1 and 2 equations (at or below 623.15 K) or the
+/// region 3 equation.
+///
+/// \param[in] property saturated property
+/// \param[in] p  saturation pressure
+/// \param[in] t  saturation temperature
+///
+/// \return saturated property
+///////////////////////////////////////////////////////////////////////////////
+double saturated_property(SaturatedProperty property, double p, double t)
+{
+	if ((active_settings().saturation == SATURATION_TABLE) && (t <= t_table_max)) {
+		const SatTable &table = saturation_table();
+		const SatSegment &seg = (t <= t_boundary) ? table.low : table.high;
+		double y = hermite(seg, sqrt(TC - t), property);
+		if ((property == SAT_VF) || (property == SAT_VG))
+			return exp(y);
+		return y;
+	}
+	return saturated_exact(property, (t <= t_boundary) ? 1 : 3, p, t);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the largest interpolation error of a property in the saturation table,
+///  building the table if necessary
+///
+/// The bound is error_margin times the largest difference between the table and the
+/// exact calculation found at the quarter points of every interval: in kJ/kg for the
+/// enthalpies, kJ/kg/K for the entropies, and relative for the specific volumes.
+///
+/// \param[in] property saturated property
+///
+/// \return largest interpolation error
+///////////////////////////////////////////////////////////////////////////////
+double SATURATION_TABLE_ERROR(SaturatedProperty property)
+{
+	return saturation_table().error[property];
+}
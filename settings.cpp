@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file settings.cpp
+///	\brief Solver options that select between alternative numerical methods.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+ 
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+ 
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "iapws.h"
+
+////////////////////////////////////////////////////////
+///	\brief Default solver options.
+////////////////////////////////////////////////////////
+const Settings default_settings = {
+	DENSITY_NEWTON,
+	BACKWARD_OFF,
+	BACKWARD_OFF,
+	SATURATION_EXACT,
+	PH_EXACT,
+	0,
+	0
+};
+
+////////////////////////////////////////////////////////
+///	\brief Solver options of the current thread.
+////////////////////////////////////////////////////////
+static thread_local Settings current_settings = default_settings;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the solver options in effect for the calling thread
+///
+/// \return solver options
+///////////////////////////////////////////////////////////////////////////////
+const Settings &active_settings(void)
+{
+	return current_settings;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns a copy of the solver options of the calling thread
+///
+/// \return solver options
+///////////////////////////////////////////////////////////////////////////////
+Settings GET_SETTINGS(void)
+{
+	return current_settings;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief changes the solver options of the calling thread
+///
+/// Other threads are not affected; each starts out with the default options.
+///
+/// \param[in] settings new solver options
+///////////////////////////////////////////////////////////////////////////////
+void SET_SETTINGS(Settings settings)
+{
+	current_settings = settings;
+}
@@ -1,20 +1,29 @@
+import os
+import sys
 from setuptools import setup, Extension
 from Cython.Build import cythonize
 
-MIN_PY = "0x030A0000"  # Python 3.10 baseline
+MIN_PY = "0x030B0000"  # Python 3.11 baseline (buffer protocol in the limited API)
+
+# WATPROP_INSTRUMENT=1 in the environment compiles in the solver instrumentation
+instrument = [("WATPROP_INSTRUMENT", None)] if os.environ.get("WATPROP_INSTRUMENT") else []
 
 ext = Extension("WatpropPy",
                 language='c++',
-                sources=["watprop.pyx", "wat.cpp", "mymath.cpp", "region.cpp", "region1.cpp", "region2.cpp", "region3.cpp", "region4.cpp", "region5.cpp", "region23.cpp", "utilities.cpp"],
+                sources=["watprop.pyx", "wat.cpp", "mymath.cpp", "region.cpp", "region1.cpp", "region2.cpp", "region3.cpp", "region4.cpp", "region5.cpp", "region23.cpp", "utilities.cpp", "batch.cpp", "settings.cpp", "backward3.cpp", "saturation.cpp", "table_pt.cpp", "table_ph.cpp", "instrument.cpp", "metrics.cpp"],
                 define_macros=[
                     ("Py_LIMITED_API", MIN_PY),
                     ("PY_SSIZE_T_CLEAN", None),
-                ],
+                ] + instrument,
+                # batch.cpp runs worker threads
+                extra_compile_args=[] if sys.platform == 'win32' else ['-pthread'],
+                extra_link_args=[] if sys.platform == 'win32' else ['-pthread'],
                 py_limited_api=True)
 
 setup(name='WatpropPy',
     version='0.0.1',
     author= 'Alan Ford',
     ext_modules=(cythonize([ext],language_level = "3")),
+    install_requires=['numpy'],
     zip_safe=False,
 )
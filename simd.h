@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file simd.h
+///	\brief Vector types and run-time instruction set selection for the kernels that
+///  evaluate the region equations at several statepoints at once.
+///
+/// The kernels are written once as templates over the type of a value, which is
+/// either double or a vector of doubles holding one statepoint per lane, so that the
+/// scalar and vector evaluations perform the same operations in the same order.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+ 
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+ 
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include<math.h>
+
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/////////////////////////////////////////////////////////////////////////
+/// defined when the kernels can be compiled for AVX2 and AVX-512
+/////////////////////////////////////////////////////////////////////////
+#define WATPROP_SIMD
+
+/////////////////////////////////////////////////////////////////////////
+/// four doubles, the width of an AVX2 register
+/////////////////////////////////////////////////////////////////////////
+typedef double double4 __attribute__((vector_size(32)));
+/////////////////////////////////////////////////////////////////////////
+/// eight doubles, the width of an AVX-512 register
+/////////////////////////////////////////////////////////////////////////
+typedef double double8 __attribute__((vector_size(64)));
+
+/////////////////////////////////////////////////////////////////////////
+/// natural logarithm of each lane of a vector
+/////////////////////////////////////////////////////////////////////////
+template <class V>
+static ALWAYS_INLINE void lane_log(const V &x, V &result)
+{
+	for (int lane=0; lane<(int) (sizeof(V)/sizeof(double)); lane++)
+		result[lane] = log(x[lane]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief selects the widest kernel that the processor supports
+///
+/// \param[in] scalar kernel that evaluates one statepoint at a time
+/// \param[in] avx2 kernel that uses AVX2
+/// \param[in] avx512 kernel that uses AVX-512
+///
+/// \return kernel function
+///////////////////////////////////////////////////////////////////////////////
+template <class Kernel>
+static Kernel select_kernel(Kernel scalar, Kernel avx2, Kernel avx512)
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f"))
+		return avx512;
+	if (__builtin_cpu_supports("avx2"))
+		return avx2;
+	return scalar;
+}
+#endif
+
+/////////////////////////////////////////////////////////////////////////
+/// natural logarithm of a value
+/////////////////////////////////////////////////////////////////////////
+static ALWAYS_INLINE void lane_log(double x, double &result)
+{
+	result = log(x);
+}
+
+#endif // SIMD_H
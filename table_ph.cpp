@@ -0,0 +1,732 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file table_ph.cpp
+///	\brief Table of temperature, specific volume, and specific entropy as functions
+///  of pressure and specific enthalpy.
+///
+/// When the PH_TABLE method is selected, T_PH, V_PH, and S_PH interpolate in a table
+/// that is built the first time it is needed.  The (p,h) plane is divided into
+/// pieces, each bounded in enthalpy by two curves h(p) that follow the saturation
+/// dome and the region boundaries, so that a single region equation applies within
+/// every piece.  Within a piece the coordinates are x = ln(p) and the fraction y of
+/// the way from the lower to the upper boundary enthalpy, and the properties are
+/// bicubic Hermite patches on a regular grid in (x,y).  Two-phase states below
+/// 16.5292 MPa are interpolated between the saturated liquid and vapor edges of the
+/// neighbouring pieces, in the same way as v_ph_4 and s_ph_4.
+///
+/// Statepoints outside the table (below 1 kPa, in region 5, or near the critical
+/// point) and in cells that do not meet cell_tolerance use the equations.
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+ 
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+ 
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "iapws.h"
+#include <math.h>
+#include <stdexcept>      // std::invalid_argument
+
+////////////////////////////////////////////////////////
+///	\brief Lowest pressure covered by the table, MPa.
+////////////////////////////////////////////////////////
+const double p_table_min = 0.001;
+////////////////////////////////////////////////////////
+///	\brief Pressure at which region_ph switches from region 4 to region 3, MPa.
+////////////////////////////////////////////////////////
+const double p_boundary = 16.5292;
+////////////////////////////////////////////////////////
+///	\brief Highest pressure covered by the table, MPa.
+////////////////////////////////////////////////////////
+const double p_table_max = 100;
+////////////////////////////////////////////////////////
+///	\brief Highest temperature of the table on the saturation line (the pieces
+///  next to the saturation dome in region 3 stop at its saturation pressure), K.
+////////////////////////////////////////////////////////
+const double t_table_saturation_max = TC - 0.5;
+////////////////////////////////////////////////////////
+///	\brief Number of tabulated properties.
+////////////////////////////////////////////////////////
+#define PH_PROPERTY_COUNT 3
+////////////////////////////////////////////////////////
+///	\brief Number of pieces of the table.
+////////////////////////////////////////////////////////
+#define PH_PIECE_COUNT 7
+////////////////////////////////////////////////////////
+///	\brief Largest error at the centre of a cell for which the cell is interpolated:
+///  in K for temperature, relative for specific volume, and kJ/kg/K for entropy.
+///  Cells with larger errors (near the critical point) use the equations.
+////////////////////////////////////////////////////////
+const double cell_tolerance[PH_PROPERTY_COUNT] = {1E-3, 1E-5, 1E-5};
+////////////////////////////////////////////////////////
+///	\brief Factor applied to the largest error found at the cell centres to give the
+///  reported error bound, allowing for larger errors elsewhere in the cells.
+////////////////////////////////////////////////////////
+const double error_margin = 2;
+////////////////////////////////////////////////////////
+///	\brief Finite difference step as a fraction of the cell size.
+////////////////////////////////////////////////////////
+const double difference_step = 1E-3;
+
+////////////////////////////////////////////////////////
+///	\brief Curves h(p) bounding the pieces of the table.
+////////////////////////////////////////////////////////
+enum PHBoundary {
+	BOUND_T_MIN,      ///< region 1 at 273.15 K
+	BOUND_LIQUID,     ///< saturated liquid (region 1 up to p_boundary, region 3 above)
+	BOUND_VAPOR,      ///< saturated vapor (region 2 up to p_boundary, region 3 above)
+	BOUND_13,         ///< region 1 at 623.15 K
+	BOUND_23,         ///< region 2 on the region 2 and 3 boundary
+	BOUND_T_MAX       ///< region 2 at 1073.15 K
+};
+
+////////////////////////////////////////////////////////
+///	\brief Values and scaled derivatives of the tabulated properties at a grid point.
+////////////////////////////////////////////////////////
+struct PHNode {
+	double f[PH_PROPERTY_COUNT];    ///< t, ln(v), s
+	double fx[PH_PROPERTY_COUNT];   ///< derivatives with respect to x, per cell
+	double fy[PH_PROPERTY_COUNT];   ///< derivatives with respect to y, per cell
+	double fxy[PH_PROPERTY_COUNT];  ///< cross derivatives, per cell
+};
+
+////////////////////////////////////////////////////////
+///	\brief One piece of the table: a grid in (ln(p), y) between two boundary curves.
+////////////////////////////////////////////////////////
+struct PHPiece {
+	int phase;              ///< 1 or 2 for those regions; 3 and 4 for the liquid (and supercritical) and vapor sides of region 3
+	PHBoundary lower;       ///< lower enthalpy boundary
+	PHBoundary upper;       ///< upper enthalpy boundary
+	double x_low;           ///< ln(p) of the first row of grid points
+	double dx;              ///< spacing of the rows
+	int p_intervals;        ///< number of cells in pressure
+	int h_intervals;        ///< number of cells in enthalpy
+	double *bound;          ///< lower and upper boundary enthalpies and their derivatives per row, 4 per row
+	PHNode *nodes;          ///< grid points, ordered by pressure then enthalpy
+	bool *valid;            ///< false for cells interpolated less accurately than cell_tolerance
+};
+
+////////////////////////////////////////////////////////
+///	\brief The (p,h) table and the largest errors found when it was built.
+////////////////////////////////////////////////////////
+struct PHTable {
+	PHPiece pieces[PH_PIECE_COUNT];
+	double p_saturation_max;                  ///< highest pressure of the pieces next to the dome in region 3
+	double error[PH_PROPERTY_COUNT];          ///< absolute for t and s, relative for v
+};
+
+////////////////////////////////////////////////////////
+///	\brief Indices of the pieces in PHTable.
+////////////////////////////////////////////////////////
+enum PHPieceIndex {
+	PIECE_LIQUID_LOW,   ///< region 1 below p_boundary
+	PIECE_VAPOR_LOW,    ///< region 2 below p_boundary
+	PIECE_LIQUID_HIGH,  ///< region 1 above p_boundary
+	PIECE_LIQUID_3,     ///< liquid side of region 3, below the critical pressure
+	PIECE_VAPOR_3,      ///< vapor side of region 3, below the critical pressure
+	PIECE_SUPER_3,      ///< region 3 above the critical pressure
+	PIECE_VAPOR_HIGH    ///< region 2 above p_boundary
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the temperature on a boundary curve
+///
+/// \param[in] boundary boundary curve
+/// \param[in] p  pressure
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+static double boundary_t(PHBoundary boundary, double p)
+{
+	switch (boundary) {
+		case BOUND_T_MIN:
+			return 273.15;
+		case BOUND_LIQUID:
+		case BOUND_VAPOR:
+			return TSAT_P(p);
+		case BOUND_13:
+			return 623.15;
+		case BOUND_23:
+			return b23_t_p(p);
+		case BOUND_T_MAX:
+			return 1073.15;
+	}
+	throw "invalid boundary in table_ph";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the specific enthalpy on a boundary curve, with the same
+///  equations as region_ph
+///
+/// The saturation curves are taken from the equation of the piece rather than
+/// by comparing the pressure with p_boundary, so that a row of grid points at
+/// p_boundary does not switch equations through rounding in exp(ln(p)).
+///
+/// \param[in] boundary boundary curve
+/// \param[in] phase see PHPiece
+/// \param[in] p  pressure
+///
+/// \return specific enthalpy
+///////////////////////////////////////////////////////////////////////////////
+static double boundary_h(PHBoundary boundary, int phase, double p)
+{
+	double t = boundary_t(boundary, p);
+	switch (boundary) {
+		case BOUND_T_MIN:
+		case BOUND_13:
+			return h_pt_1(p, t);
+		case BOUND_LIQUID:
+			if (phase == 1)
+				return h_pt_1(p, t);
+			return h_dt_3(df_pt_3(p, t), t);
+		case BOUND_VAPOR:
+			if (phase == 2)
+				return h_pt_2(p, t);
+			return h_dt_3(dv_pt_3(p, t), t);
+		case BOUND_23:
+		case BOUND_T_MAX:
+			return h_pt_2(p, t);
+	}
+	throw "invalid boundary in table_ph";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the properties at a pressure and temperature with the equation
+///  of a phase
+///
+/// \param[in] phase see PHPiece
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] state properties
+///////////////////////////////////////////////////////////////////////////////
+static void state_phase(int phase, double p, double t, StatePT &state)
+{
+	switch (phase) {
+		case 1:
+			state_pt_1(p, t, state);
+			break;
+		case 2:
+			state_pt_2(p, t, state);
+			break;
+		case 3:
+			// d_pt_3 finds the liquid away from the saturation line, where the
+			// saturated density functions do not bracket the solution
+			if ((p < PC) && (t >= TSAT_P(p)))
+				state_dt_3(df_pt_3(p, t), t, state);
+			else
+				state_dt_3(d_pt_3(p, t), t, state);
+			break;
+		default:
+			if (t <= TSAT_P(p))
+				state_dt_3(dv_pt_3(p, t), t, state);
+			else
+				state_dt_3(d_pt_3(p, t), t, state);
+			break;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the tabulated properties at a pressure and specific enthalpy
+///  with the equation of a piece
+///
+/// A Newton iteration in temperature, dh/dt being cp, starting from a nearby
+/// solution or else the IAPWS-IF97 backward equation, and kept within the
+/// temperature range of the piece.
+///
+/// \param[in] piece table piece
+/// \param[in] p  pressure
+/// \param[in] h  specific enthalpy
+/// \param[in] t_start initial estimate of the temperature, or 0 to use the backward equation
+/// \param[out] f t, ln(v), s
+///////////////////////////////////////////////////////////////////////////////
+static void properties_ph(const PHPiece &piece, double p, double h, double t_start, double f[PH_PROPERTY_COUNT])
+{
+	// the equations of region 3 are only followed up to the saturation line
+	double t_low = boundary_t(piece.lower, p);
+	if (piece.lower != BOUND_VAPOR)
+		t_low -= 1;
+	double t_high = boundary_t(piece.upper, p);
+	if (piece.upper != BOUND_LIQUID)
+		t_high += 1;
+	double t = t_start;
+	if (t <= 0) {
+		if (piece.phase == 1)
+			t = backward_t_ph_1(p, h);
+		else if (piece.phase == 2)
+			t = backward_t_ph_2(p, h);
+		else
+			t = backward_t_ph_3(p, h);
+	}
+	StatePT state;
+	for (int i=0; i<50; i++) {
+		if (t < t_low)
+			t = t_low;
+		if (t > t_high)
+			t = t_high;
+		state_phase(piece.phase, p, t, state);
+		double dt = (state.h - h) / state.cp;
+		t -= dt;
+		if (fabs(dt) < 1E-12 * t)
+			break;
+	}
+	state_phase(piece.phase, p, t, state);
+	f[PH_T] = t;
+	f[PH_V] = log(state.v);
+	f[PH_S] = state.s;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a bicubic Hermite patch from the grid points at its corners
+///
+/// \param[in] n00 corner at the lower pressure and enthalpy
+/// \param[in] n10 corner at the higher pressure and lower enthalpy
+/// \param[in] n01 corner at the lower pressure and higher enthalpy
+/// \param[in] n11 corner at the higher pressure and enthalpy
+/// \param[in] k  index of the tabulated property
+/// \param[in] x  scaled position in pressure within the cell
+/// \param[in] y  scaled position in enthalpy within the cell
+///
+/// \return interpolated value
+///////////////////////////////////////////////////////////////////////////////
+static double hermite2(const PHNode &n00, const PHNode &n10, const PHNode &n01, const PHNode &n11, int k, double x, double y)
+{
+	double gx = 1 - x;
+	double gy = 1 - y;
+	// Hermite basis functions
+	double ax = gx*gx*(1 + 2*x);
+	double bx = x*x*(3 - 2*x);
+	double cx = x*gx*gx;
+	double dx = -x*x*gx;
+	double ay = gy*gy*(1 + 2*y);
+	double by = y*y*(3 - 2*y);
+	double cy = y*gy*gy;
+	double dy = -y*y*gy;
+	return ay*(ax*n00.f[k] + bx*n10.f[k] + cx*n00.fx[k] + dx*n10.fx[k])
+		+ by*(ax*n01.f[k] + bx*n11.f[k] + cx*n01.fx[k] + dx*n11.fx[k])
+		+ cy*(ax*n00.fy[k] + bx*n10.fy[k] + cx*n00.fxy[k] + dx*n10.fxy[k])
+		+ dy*(ax*n01.fy[k] + bx*n11.fy[k] + cx*n01.fxy[k] + dx*n11.fxy[k]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief interpolates a boundary enthalpy of a piece with a cubic Hermite spline
+///
+/// \param[in] piece table piece
+/// \param[in] i  row of grid points below the pressure
+/// \param[in] x  scaled position in pressure within the row of cells
+/// \param[in] upper false for the lower boundary, true for the upper
+///
+/// \return boundary enthalpy
+///////////////////////////////////////////////////////////////////////////////
+static double boundary_spline(const PHPiece &piece, int i, double x, bool upper)
+{
+	const double *a = piece.bound + 4*i + (upper ? 2 : 0);
+	const double *b = a + 4;
+	double g = 1 - x;
+	return g*g*(1 + 2*x)*a[0] + x*x*(3 - 2*x)*b[0] + (x*g*g*a[1] - x*x*g*b[1]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds the row of cells containing a pressure and the boundary enthalpies
+///  of a piece at that pressure
+///
+/// \param[in] piece table piece
+/// \param[in] x_p  ln(p), within the piece
+/// \param[out] i  row of cells
+/// \param[out] x  scaled position in pressure within the row
+/// \param[out] h_low lower boundary enthalpy
+/// \param[out] h_high upper boundary enthalpy
+///////////////////////////////////////////////////////////////////////////////
+static void piece_row(const PHPiece &piece, double x_p, int &i, double &x, double &h_low, double &h_high)
+{
+	x = (x_p - piece.x_low) / piece.dx;
+	i = (int) x;
+	if (i < 0)
+		i = 0;
+	if (i > piece.p_intervals - 1)
+		i = piece.p_intervals - 1;
+	x -= i;
+	h_low = boundary_spline(piece, i, x, false);
+	h_high = boundary_spline(piece, i, x, true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief interpolates a property within a piece
+///
+/// \param[in] piece table piece
+/// \param[in] i  row of cells
+/// \param[in] x  scaled position in pressure within the row
+/// \param[in] y_h  fraction of the way from the lower to the upper boundary enthalpy
+/// \param[in] k  index of the tabulated property
+/// \param[out] value interpolated value of t, ln(v) or s
+///
+/// \return false if the cell is not interpolated
+///////////////////////////////////////////////////////////////////////////////
+static bool piece_value(const PHPiece &piece, int i, double x, double y_h, int k, double &value)
+{
+	double y = y_h * piece.h_intervals;
+	int j = (int) y;
+	if (j < 0)
+		j = 0;
+	if (j > piece.h_intervals - 1)
+		j = piece.h_intervals - 1;
+	if (!piece.valid[(long) i*piece.h_intervals + j])
+		return false;
+	int columns = piece.h_intervals + 1;
+	const PHNode *row0 = piece.nodes + (long) i*columns;
+	const PHNode *row1 = row0 + columns;
+	value = hermite2(row0[j], row1[j], row0[j+1], row1[j+1], k, x, y - j);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates a derivative from three equally spaced values
+///
+/// \param[in] f0 value one step before the point (or at it, for a one-sided difference)
+/// \param[in] f1 value at the point (or one step after it)
+/// \param[in] f2 value one step after the point (or two steps after it)
+/// \param[in] one_sided true for a forward difference
+///
+/// \return derivative per step
+///////////////////////////////////////////////////////////////////////////////
+static double difference(double f0, double f1, double f2, bool one_sided)
+{
+	if (one_sided)
+		return (-3*f0 + 4*f1 - f2) / 2;
+	return (f2 - f0) / 2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the values and scaled derivatives of the tabulated properties
+///  at a grid point
+///
+/// The derivatives are differences over a 3 by 3 stencil of small steps, one-sided
+/// at the edges of the piece so that the equations are not evaluated outside it.
+/// Where the equations cannot be solved (at the critical point) the values are NaN,
+/// and so are the cells that use them.
+///
+/// \param[in] piece table piece
+/// \param[in] i  row of the grid point
+/// \param[in] j  column of the grid point
+/// \param[in] p  pressures of the stencil
+/// \param[in] h_low lower boundary enthalpies at those pressures
+/// \param[in] h_high upper boundary enthalpies at those pressures
+/// \param[out] node values and derivatives
+///////////////////////////////////////////////////////////////////////////////
+static void build_node(const PHPiece &piece, int i, int j, const double p[3], const double h_low[3], const double h_high[3], PHNode &node)
+{
+	bool one_sided_x = (i == 0) || (i == piece.p_intervals);
+	bool one_sided_y = (j == 0) || (j == piece.h_intervals);
+	int sx = (i == piece.p_intervals) ? -1 : 1;
+	int sy = (j == piece.h_intervals) ? -1 : 1;
+	// position of the grid point in the stencil
+	int cx = one_sided_x ? 0 : 1;
+	int cy = one_sided_y ? 0 : 1;
+	double f[3][3][PH_PROPERTY_COUNT];
+	try {
+		// the grid point itself, which starts the iterations for the rest of the stencil
+		double y = (double) j / piece.h_intervals;
+		properties_ph(piece, p[cx], h_low[cx] + y*(h_high[cx] - h_low[cx]), 0, f[cx][cy]);
+		for (int a=0; a<3; a++) {
+			for (int b=0; b<3; b++) {
+				if ((a == cx) && (b == cy))
+					continue;
+				y = (j + sy*(b - cy)*difference_step) / piece.h_intervals;
+				properties_ph(piece, p[a], h_low[a] + y*(h_high[a] - h_low[a]), f[cx][cy][PH_T], f[a][b]);
+			}
+		}
+	}
+	catch(char const*) {
+		for (int k=0; k<PH_PROPERTY_COUNT; k++)
+			node.f[k] = node.fx[k] = node.fy[k] = node.fxy[k] = NAN;
+		return;
+	}
+	for (int k=0; k<PH_PROPERTY_COUNT; k++) {
+		double fy[3];
+		for (int a=0; a<3; a++)
+			fy[a] = sy * difference(f[a][0][k], f[a][1][k], f[a][2][k], one_sided_y) / difference_step;
+		node.f[k] = f[cx][cy][k];
+		node.fx[k] = sx * difference(f[0][cy][k], f[1][cy][k], f[2][cy][k], one_sided_x) / difference_step;
+		node.fy[k] = fy[cx];
+		node.fxy[k] = sx * difference(fy[0], fy[1], fy[2], one_sided_x) / difference_step;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief tabulates a piece and records the largest interpolation errors
+///
+/// Each cell is compared with the equations at its centre, and is only interpolated
+/// if the errors are within cell_tolerance.
+///
+/// \param[out] piece table piece
+/// \param[in] phase see PHPiece
+/// \param[in] lower lower enthalpy boundary
+/// \param[in] upper upper enthalpy boundary
+/// \param[in] p_low lowest pressure
+/// \param[in] p_high highest pressure
+/// \param[in] p_intervals number of cells in pressure
+/// \param[in] h_intervals number of cells in enthalpy
+/// \param[in,out] error largest errors found so far
+///////////////////////////////////////////////////////////////////////////////
+static void build_piece(PHPiece &piece, int phase, PHBoundary lower, PHBoundary upper, double p_low, double p_high, int p_intervals, int h_intervals, double error[PH_PROPERTY_COUNT])
+{
+	piece.phase = phase;
+	piece.lower = lower;
+	piece.upper = upper;
+	piece.x_low = log(p_low);
+	piece.dx = (log(p_high) - piece.x_low) / p_intervals;
+	piece.p_intervals = p_intervals;
+	piece.h_intervals = h_intervals;
+	int rows = p_intervals + 1;
+	int columns = h_intervals + 1;
+	piece.bound = new double[4*rows];
+	piece.nodes = new PHNode[(long) rows*columns];
+	piece.valid = new bool[(long) p_intervals*h_intervals];
+	for (int i=0; i<rows; i++) {
+		// pressures of the stencils of the row (see build_node) and the boundary
+		// enthalpies there, which also give the derivatives of the boundaries
+		bool one_sided = (i == 0) || (i == p_intervals);
+		int sx = (i == p_intervals) ? -1 : 1;
+		int cx = one_sided ? 0 : 1;
+		double p[3], h_low[3], h_high[3];
+		for (int a=0; a<3; a++) {
+			p[a] = exp(piece.x_low + (i + sx*(a - cx)*difference_step)*piece.dx);
+			h_low[a] = boundary_h(lower, phase, p[a]);
+			h_high[a] = boundary_h(upper, phase, p[a]);
+		}
+		double *b = piece.bound + 4*i;
+		b[0] = h_low[cx];
+		b[1] = sx * difference(h_low[0], h_low[1], h_low[2], one_sided) / difference_step;
+		b[2] = h_high[cx];
+		b[3] = sx * difference(h_high[0], h_high[1], h_high[2], one_sided) / difference_step;
+		for (int j=0; j<columns; j++)
+			build_node(piece, i, j, p, h_low, h_high, piece.nodes[(long) i*columns + j]);
+	}
+	// compare the cells with the equations at their centres
+	for (int i=0; i<p_intervals; i++) {
+		double x, h_low, h_high;
+		int row;
+		piece_row(piece, piece.x_low + (i + 0.5)*piece.dx, row, x, h_low, h_high);
+		double p = exp(piece.x_low + (i + 0.5)*piece.dx);
+		for (int j=0; j<h_intervals; j++) {
+			double y = (j + 0.5) / h_intervals;
+			double f[PH_PROPERTY_COUNT];
+			bool &valid = piece.valid[(long) i*h_intervals + j];
+			try {
+				properties_ph(piece, p, h_low + y*(h_high - h_low), 0, f);
+			}
+			catch(char const*) {
+				valid = false;
+				continue;
+			}
+			valid = true;
+			double e[PH_PROPERTY_COUNT];
+			for (int k=0; k<PH_PROPERTY_COUNT; k++) {
+				double value = 0;
+				piece_value(piece, i, x, y, k, value);
+				e[k] = (k == PH_V) ? fabs(expm1(value - f[k])) : fabs(value - f[k]);
+				if (!(e[k] <= cell_tolerance[k]))
+					valid = false;
+			}
+			if (valid) {
+				for (int k=0; k<PH_PROPERTY_COUNT; k++) {
+					if (error_margin*e[k] > error[k])
+						error[k] = error_margin*e[k];
+				}
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief builds the (p,h) table
+///
+/// The table is built with the default solver options, and the Region 3 density
+/// found by the polished backward equations, whatever the options of the calling
+/// thread, so that it does not depend on the thread that happens to use it first.
+///
+/// \return the new table
+///////////////////////////////////////////////////////////////////////////////
+static PHTable *build_ph_table(void)
+{
+	Settings previous = GET_SETTINGS();
+	Settings settings = default_settings;
+	settings.backward_pt = BACKWARD_POLISH;
+	SET_SETTINGS(settings);
+	PHTable *table = new PHTable;
+	try {
+		for (int k=0; k<PH_PROPERTY_COUNT; k++)
+			table->error[k] = 0;
+		table->p_saturation_max = PSAT_T(t_table_saturation_max);
+		PHPiece *pieces = table->pieces;
+		build_piece(pieces[PIECE_LIQUID_LOW], 1, BOUND_T_MIN, BOUND_LIQUID, p_table_min, p_boundary, 128, 32, table->error);
+		build_piece(pieces[PIECE_VAPOR_LOW], 2, BOUND_VAPOR, BOUND_T_MAX, p_table_min, p_boundary, 128, 64, table->error);
+		build_piece(pieces[PIECE_LIQUID_HIGH], 1, BOUND_T_MIN, BOUND_13, p_boundary, p_table_max, 32, 32, table->error);
+		build_piece(pieces[PIECE_LIQUID_3], 3, BOUND_13, BOUND_LIQUID, p_boundary, table->p_saturation_max, 16, 32, table->error);
+		build_piece(pieces[PIECE_VAPOR_3], 4, BOUND_VAPOR, BOUND_23, p_boundary, table->p_saturation_max, 16, 32, table->error);
+		build_piece(pieces[PIECE_SUPER_3], 3, BOUND_13, BOUND_23, PC, p_table_max, 64, 64, table->error);
+		build_piece(pieces[PIECE_VAPOR_HIGH], 2, BOUND_23, BOUND_T_MAX, p_boundary, p_table_max, 32, 64, table->error);
+	}
+	catch(...) {
+		SET_SETTINGS(previous);
+		delete table;
+		throw;
+	}
+	SET_SETTINGS(previous);
+	return table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the (p,h) table, building it on first use
+///
+/// The table is built once per process; initialization of the function-local
+/// static is thread safe.
+///
+/// \return (p,h) table
+///////////////////////////////////////////////////////////////////////////////
+static const PHTable &ph_table(void)
+{
+	static const PHTable *table = build_ph_table();
+	return *table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief interpolates a property of a two-phase mixture between the saturated
+///  liquid and vapor edges of the pieces on either side of the dome
+///
+/// \param[in] liquid piece below the dome
+/// \param[in] vapor piece above the dome
+/// \param[in] x_p  ln(p)
+/// \param[in] h  specific enthalpy
+/// \param[in] property interpolated property
+/// \param[out] value interpolated value
+///
+/// \return false if either edge cell is not interpolated
+///////////////////////////////////////////////////////////////////////////////
+static bool two_phase_value(const PHPiece &liquid, const PHPiece &vapor, double x_p, double h, PHProperty property, double &value)
+{
+	int i_f, i_g;
+	double x_f, x_g, h_low, h_f, h_g, h_high;
+	piece_row(liquid, x_p, i_f, x_f, h_low, h_f);
+	piece_row(vapor, x_p, i_g, x_g, h_g, h_high);
+	double f_f, f_g;
+	if (!piece_value(liquid, i_f, x_f, 1, property, f_f))
+		return false;
+	if (property == PH_T) {
+		value = f_f;
+		return true;
+	}
+	if (!piece_value(vapor, i_g, x_g, 0, property, f_g))
+		return false;
+	if (property == PH_V) {
+		f_f = exp(f_f);
+		f_g = exp(f_g);
+	}
+	value = (h - h_f)/(h_g - h_f)*(f_g - f_f) + f_f;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief interpolates temperature, specific volume, or specific entropy as a
+///  function of pressure and specific enthalpy when the PH_TABLE method is selected
+///
+/// \param[in] property interpolated property
+/// \param[in] p  pressure
+/// \param[in] h  specific enthalpy
+/// \param[out] value interpolated value
+///
+/// \return false if the PH_EXACT method is selected or the statepoint is not covered
+///  by the table, in which case the caller uses the region equations
+///////////////////////////////////////////////////////////////////////////////
+bool table_ph_value(PHProperty property, double p, double h, double &value)
+{
+	if (active_settings().ph != PH_TABLE)
+		return false;
+	if (!((p >= p_table_min) && (p <= p_table_max)))
+		return false;
+	const PHTable &table = ph_table();
+	// pieces in order of increasing enthalpy at this pressure
+	int order[4];
+	int count;
+	if (p <= p_boundary) {
+		order[0] = PIECE_LIQUID_LOW;
+		order[1] = PIECE_VAPOR_LOW;
+		count = 2;
+	}
+	else if (p < PC) {
+		if (p > table.p_saturation_max)
+			return false;
+		order[0] = PIECE_LIQUID_HIGH;
+		order[1] = PIECE_LIQUID_3;
+		order[2] = PIECE_VAPOR_3;
+		order[3] = PIECE_VAPOR_HIGH;
+		count = 4;
+	}
+	else {
+		order[0] = PIECE_LIQUID_HIGH;
+		order[1] = PIECE_SUPER_3;
+		order[2] = PIECE_VAPOR_HIGH;
+		count = 3;
+	}
+	double x_p = log(p);
+	for (int n=0; n<count; n++) {
+		const PHPiece &piece = table.pieces[order[n]];
+		int i;
+		double x, h_low, h_high;
+		piece_row(piece, x_p, i, x, h_low, h_high);
+		if (h < h_low) {
+			// the two-phase region below p_boundary; otherwise below the table or in
+			// the part of the dome handled by the region 3 functions
+			if ((n == 1) && (p <= p_boundary))
+				return two_phase_value(table.pieces[PIECE_LIQUID_LOW], piece, x_p, h, property, value);
+			return false;
+		}
+		if (h <= h_high) {
+			if (!piece_value(piece, i, x, (h - h_low)/(h_high - h_low), property, value))
+				return false;
+			if (property == PH_V)
+				value = exp(value);
+			return true;
+		}
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the largest interpolation error of a property in the (p,h) table,
+///  building the table if necessary
+///
+/// The bound is error_margin times the largest difference between the table and the
+/// equations found at the centres of the interpolated cells: in K for temperature,
+/// kJ/kg/K for specific entropy, and relative for specific volume.
+///
+/// \param[in] property tabulated property
+///
+/// \return largest interpolation error
+///////////////////////////////////////////////////////////////////////////////
+double PH_TABLE_ERROR(PHProperty property)
+{
+	try {
+		return ph_table().error[property];
+	}
+	catch(char const* chowder) {
+		// rethrow the original error message as std::invalid_argument
+		throw std::invalid_argument(chowder);
+	}
+}
@@ -0,0 +1,760 @@
+/////////////////////////////////////////////////////////////////////////
+///	\file table_pt.cpp
+///	\brief Bicubic interpolation tables of properties as functions of pressure and temperature.
+///
+/// A table covers a rectangle of pressure and temperature divided into equal cells.
+/// Each cell holds a bicubic patch for specific enthalpy, specific volume, and
+/// isobaric heat capacity, built from the values and finite difference derivatives
+/// of the region equations at its corners.  A cell whose corners are not all in the
+/// same region, or on the same side of the saturation line, is left without a patch
+/// so that no patch straddles a discontinuity; statepoints in such a cell are
+/// calculated from the region equations.
+///
+/// While a table is active for a thread (see USE_TABLE_PT), H_PT, V_PT, and CP_PT
+/// interpolate in it for statepoints that it covers.
+///
+/// A table can be saved to a binary file (see TABLE_PT_SAVE) and mapped read-only by
+/// later processes (see TABLE_PT_LOAD), which then share its cells through the page
+/// cache instead of each building its own copy.
+///
+/////////////////////////////////////////////////////////////////////////
+
+/*
+ Copyright (c) 2022 Charles Alan Ford
+ 
+ Permission is hereby granted, free of charge, to any person obtaining
+ a copy of this software and associated documentation files (the
+ "Software"), to deal in the Software without restriction, including
+ without limitation the rights to use, copy, modify, merge, publish,
+ distribute, sublicense, and/or sell copies of the Software, and to
+ permit persons to whom the Software is furnished to do so, subject to
+ the following conditions:
+ 
+ The above copyright notice and this permission notice shall be
+ included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "iapws.h"
+#include "utilities.h"
+#include <math.h>
+#include <stdexcept>      // std::invalid_argument
+#include <ios>            // std::ios_base::failure
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <algorithm>      // std::min
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////
+///	\brief Number of tabulated properties.
+////////////////////////////////////////////////////////
+#define TABLE_PROPERTY_COUNT 3
+////////////////////////////////////////////////////////
+///	\brief Finite difference step as a fraction of the cell size.
+////////////////////////////////////////////////////////
+const double difference_step = 1E-3;
+
+////////////////////////////////////////////////////////
+///	\brief Bicubic patch of one cell: f(x,y) = sum(a[i][4*i+j] * x^i * y^j), with x and
+///  y the position within the cell scaled to [0,1].
+////////////////////////////////////////////////////////
+struct TableCell {
+	bool valid;                             ///< false if the cell straddles a boundary
+	double a[TABLE_PROPERTY_COUNT][16];     ///< coefficients for h, v, and cp
+};
+
+////////////////////////////////////////////////////////
+///	\brief Bicubic property table over a rectangle of pressure and temperature.
+////////////////////////////////////////////////////////
+struct TablePT {
+	double p_min;        ///< lowest pressure, MPa
+	double t_min;        ///< lowest temperature, K
+	double dp;           ///< cell size in pressure
+	double dt;           ///< cell size in temperature
+	int p_intervals;     ///< number of cells in pressure
+	int t_intervals;     ///< number of cells in temperature
+	TableCell *cells;    ///< cells, ordered by pressure then temperature
+	long exact_cells;    ///< number of cells without a patch
+	double error[TABLE_PROPERTY_COUNT];  ///< largest relative error found at the cell centres
+	double bounds[4];    ///< p_min, p_max, t_min, and t_max as requested, in the input units
+	Units units;         ///< input units of measure
+	void *mapping;       ///< start of the mapped file holding the cells, or 0 if they are allocated
+	size_t mapping_size; ///< length of the mapped file
+};
+
+////////////////////////////////////////////////////////
+///	\brief Identifies a table file.
+////////////////////////////////////////////////////////
+const char table_file_magic[8] = "WATPTBL";
+////////////////////////////////////////////////////////
+///	\brief Version of the table file layout, incremented whenever it changes.
+////////////////////////////////////////////////////////
+const uint32_t table_file_format = 1;
+////////////////////////////////////////////////////////
+///	\brief Written as a number so that a file from a machine of the other byte order is refused.
+////////////////////////////////////////////////////////
+const uint32_t table_file_byte_order = 0x01020304;
+////////////////////////////////////////////////////////
+///	\brief Alignment of the cells within a table file, a multiple of the page size of
+///  the supported platforms.
+////////////////////////////////////////////////////////
+const uint64_t table_file_alignment = 65536;
+
+////////////////////////////////////////////////////////
+///	\brief Header at the start of a table file, followed by zeros up to the cells.
+////////////////////////////////////////////////////////
+struct TableFileHeader {
+	char magic[8];               ///< table_file_magic
+	uint32_t format;             ///< table_file_format
+	uint32_t byte_order;         ///< table_file_byte_order
+	char version[32];            ///< library version, see _WatpropPyVersion
+	uint32_t cell_size;          ///< sizeof(TableCell)
+	int32_t units;               ///< input units of measure of the bounds
+	double bounds[4];            ///< p_min, p_max, t_min, and t_max as requested
+	int32_t p_intervals;         ///< number of cells in pressure
+	int32_t t_intervals;         ///< number of cells in temperature
+	double p_min;                ///< lowest pressure, MPa
+	double t_min;                ///< lowest temperature, K
+	double dp;                   ///< cell size in pressure
+	double dt;                   ///< cell size in temperature
+	int64_t exact_cells;         ///< number of cells without a patch
+	double error[TABLE_PROPERTY_COUNT];  ///< largest relative error found at the cell centres
+	uint64_t cells_offset;       ///< position of the cells in the file
+	uint64_t cells_size;         ///< length of the cells in bytes
+	uint64_t checksum;           ///< see table_checksum
+};
+
+////////////////////////////////////////////////////////
+///	\brief Values and derivatives of the tabulated properties at a grid point, with the
+///  derivatives scaled to the cell size.
+////////////////////////////////////////////////////////
+struct TableNode {
+	int phase;                          ///< see phase_pt
+	double f[TABLE_PROPERTY_COUNT];     ///< h, v, cp
+	double fx[TABLE_PROPERTY_COUNT];    ///< derivatives with respect to pressure
+	double fy[TABLE_PROPERTY_COUNT];    ///< derivatives with respect to temperature
+	double fxy[TABLE_PROPERTY_COUNT];   ///< cross derivatives
+};
+
+////////////////////////////////////////////////////////
+///	\brief Active table of the current thread, or 0 if none.
+////////////////////////////////////////////////////////
+static thread_local const TablePT *current_table = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief identifies the equation and phase that apply at a statepoint
+///
+/// Statepoints with the same phase are connected by the same smooth equation.  The
+/// boundaries between phases are all non-decreasing curves p(t), so a cell lies
+/// entirely within one phase if its four corners do.
+///
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+///
+/// \return 1, 2, or 5 for those regions; 3 for the liquid and supercritical part of
+///  region 3 and 4 for its vapor part (below the critical pressure, at or above the
+///  saturation line or critical temperature)
+///////////////////////////////////////////////////////////////////////////////
+static int phase_pt(double p, double t)
+{
+	int region = region_pt(p, t);
+	if ((region == 3) && (p < PC) && ((t >= TC) || (p < PSAT_T(t))))
+		return 4;
+	return region;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the tabulated properties from the equation of a phase
+///
+/// \param[in] phase see phase_pt
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] f h, ln(v), and cp
+///////////////////////////////////////////////////////////////////////////////
+static void properties_pt(int phase, double p, double t, double f[TABLE_PROPERTY_COUNT])
+{
+	StatePT state;
+	switch (phase) {
+		case 1:
+			state_pt_1(p, t, state);
+			break;
+		case 2:
+			state_pt_2(p, t, state);
+			break;
+		case 5:
+			state_pt_5(p, t, state);
+			break;
+		default: {
+			// region 3, searching for the density on the side of the saturation line
+			// given by the phase
+			double d;
+			if (t >= TC)
+				d = d_pt_3(p, t);
+			else if (phase == 4)
+				d = dv_pt_3(p, t);
+			else if (p >= PC)
+				d = d_pt_3(p, t);
+			else
+				d = df_pt_3(p, t);
+			state_dt_3(d, t, state);
+			break;
+		}
+	}
+	f[TABLE_H] = state.h;
+	// the volume is tabulated as its logarithm, which varies far less than the
+	// volume itself across the vapour at low pressure
+	f[TABLE_V] = log(state.v);
+	f[TABLE_CP] = state.cp;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the values and scaled derivatives of the tabulated properties
+///  at a grid point
+///
+/// \param[in] table table under construction
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] node values and derivatives
+///////////////////////////////////////////////////////////////////////////////
+static void build_node(const TablePT &table, double p, double t, TableNode &node)
+{
+	node.phase = phase_pt(p, t);
+	double hp = difference_step * table.dp;
+	double ht = difference_step * table.dt;
+	double f[3][3][TABLE_PROPERTY_COUNT];
+	for (int i=0; i<3; i++) {
+		for (int j=0; j<3; j++)
+			properties_pt(node.phase, p + (i-1)*hp, t + (j-1)*ht, f[i][j]);
+	}
+	for (int k=0; k<TABLE_PROPERTY_COUNT; k++) {
+		node.f[k] = f[1][1][k];
+		node.fx[k] = (f[2][1][k] - f[0][1][k]) / (2*difference_step);
+		node.fy[k] = (f[1][2][k] - f[1][0][k]) / (2*difference_step);
+		node.fxy[k] = (f[2][2][k] - f[2][0][k] - f[0][2][k] + f[0][0][k]) / (4*difference_step*difference_step);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the bicubic coefficients of a cell from its corners
+///
+/// \param[in] n00 corner at the lower pressure and temperature
+/// \param[in] n10 corner at the higher pressure and lower temperature
+/// \param[in] n01 corner at the lower pressure and higher temperature
+/// \param[in] n11 corner at the higher pressure and temperature
+/// \param[in] k  index of the tabulated property
+/// \param[out] a coefficients
+///////////////////////////////////////////////////////////////////////////////
+static void bicubic_coefficients(const TableNode &n00, const TableNode &n10, const TableNode &n01, const TableNode &n11, int k, double a[16])
+{
+	// values and derivatives at the corners, arranged as
+	// [f(0,0) f(0,1) fy(0,0) fy(0,1); f(1,0) f(1,1) fy(1,0) fy(1,1); fx ... ; fx ...]
+	double F[4][4] = {
+		{n00.f[k],  n01.f[k],  n00.fy[k],  n01.fy[k]},
+		{n10.f[k],  n11.f[k],  n10.fy[k],  n11.fy[k]},
+		{n00.fx[k], n01.fx[k], n00.fxy[k], n01.fxy[k]},
+		{n10.fx[k], n11.fx[k], n10.fxy[k], n11.fxy[k]}
+	};
+	const double M[4][4] = {
+		{1, 0, 0, 0},
+		{0, 0, 1, 0},
+		{-3, 3, -2, -1},
+		{2, -2, 1, 1}
+	};
+	// a = M * F * transpose(M)
+	double MF[4][4];
+	for (int i=0; i<4; i++) {
+		for (int j=0; j<4; j++) {
+			MF[i][j] = 0;
+			for (int m=0; m<4; m++)
+				MF[i][j] += M[i][m] * F[m][j];
+		}
+	}
+	for (int i=0; i<4; i++) {
+		for (int j=0; j<4; j++) {
+			double sum = 0;
+			for (int m=0; m<4; m++)
+				sum += MF[i][m] * M[j][m];
+			a[4*i+j] = sum;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief evaluates a bicubic patch
+///
+/// \param[in] a coefficients
+/// \param[in] x  scaled pressure within the cell
+/// \param[in] y  scaled temperature within the cell
+///
+/// \return interpolated value
+///////////////////////////////////////////////////////////////////////////////
+static double bicubic(const double a[16], double x, double y)
+{
+	double result = 0;
+	for (int i=3; i>=0; i--) {
+		const double *row = a + 4*i;
+		result = result*x + ((row[3]*y + row[2])*y + row[1])*y + row[0];
+	}
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief interpolates a property in a table
+///
+/// \param[in] table property table
+/// \param[in] property tabulated property
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] value interpolated value
+///
+/// \return false if the statepoint is outside the table or in a cell without a patch
+///////////////////////////////////////////////////////////////////////////////
+static bool table_lookup(const TablePT &table, TableProperty property, double p, double t, double &value)
+{
+	double x = (p - table.p_min) / table.dp;
+	double y = (t - table.t_min) / table.dt;
+	if (!((x >= 0) && (x <= table.p_intervals) && (y >= 0) && (y <= table.t_intervals)))
+		return false;
+	int i = (int) x;
+	int j = (int) y;
+	if (i == table.p_intervals)
+		i--;
+	if (j == table.t_intervals)
+		j--;
+	const TableCell &cell = table.cells[(long) i*table.t_intervals + j];
+	if (!cell.valid)
+		return false;
+	value = bicubic(cell.a[property], x - i, y - j);
+	if (property == TABLE_V)
+		value = exp(value);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief interpolates a property in the active table of the current thread
+///
+/// \param[in] property tabulated property
+/// \param[in] p  pressure
+/// \param[in] t  temperature
+/// \param[out] value interpolated value
+///
+/// \return false if no table is active or the statepoint is not covered by a patch,
+///  in which case the caller uses the region equations
+///////////////////////////////////////////////////////////////////////////////
+bool table_pt_value(TableProperty property, double p, double t, double &value)
+{
+	if (current_table == 0)
+		return false;
+	return table_lookup(*current_table, property, p, t, value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the active table of the current thread
+///
+/// \return property table, or 0 if none
+///////////////////////////////////////////////////////////////////////////////
+const TablePT *active_table_pt(void)
+{
+	return current_table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief builds a table of specific enthalpy, specific volume, and isobaric heat
+///  capacity as functions of pressure and temperature
+///
+/// The largest relative error of each property is found by comparing the patches with
+/// the region equations at the centre of every cell.
+///
+/// \param[in] p_min lowest pressure
+/// \param[in] p_max highest pressure
+/// \param[in] t_min lowest temperature
+/// \param[in] t_max highest temperature
+/// \param[in] p_intervals number of cells in pressure
+/// \param[in] t_intervals number of cells in temperature
+/// \param[in] input_units input units of measure
+///
+/// \return the new table, to be released with TABLE_PT_FREE
+///
+/// \exception std::invalid_argument the rectangle is empty or outside the range of the equations
+///////////////////////////////////////////////////////////////////////////////
+TablePT *TABLE_PT_BUILD(double p_min, double p_max, double t_min, double t_max, int p_intervals, int t_intervals, Units input_units)
+{
+	double p_min_input = p_min;
+	double p_max_input = p_max;
+	double t_min_input = t_min;
+	double t_max_input = t_max;
+	if (input_units ==  ENGLISH) {
+		p_min = convert_pressure_english_to_si(p_min);
+		p_max = convert_pressure_english_to_si(p_max);
+		t_min = convert_temp_english_to_kelvin(t_min);
+		t_max = convert_temp_english_to_kelvin(t_max);
+	}
+	else {
+		t_min = convert_temp_centigrade_to_kelvin(t_min);
+		t_max = convert_temp_centigrade_to_kelvin(t_max);
+	}
+	if (!((p_max > p_min) && (t_max > t_min) && (p_intervals > 0) && (t_intervals > 0)))
+		throw std::invalid_argument("invalid table dimensions in table_pt_build");
+	TablePT *table = new TablePT;
+	table->bounds[0] = p_min_input;
+	table->bounds[1] = p_max_input;
+	table->bounds[2] = t_min_input;
+	table->bounds[3] = t_max_input;
+	table->units = input_units;
+	table->mapping = 0;
+	table->mapping_size = 0;
+	table->p_min = p_min;
+	table->t_min = t_min;
+	table->dp = (p_max - p_min) / p_intervals;
+	table->dt = (t_max - t_min) / t_intervals;
+	table->p_intervals = p_intervals;
+	table->t_intervals = t_intervals;
+	// value-initialized, so that the padding of the cells is zero in a saved file
+	table->cells = new TableCell[(long) p_intervals * t_intervals]();
+	table->exact_cells = 0;
+	for (int k=0; k<TABLE_PROPERTY_COUNT; k++)
+		table->error[k] = 0;
+	// grid points of two adjacent rows of cells
+	TableNode *row0 = new TableNode[t_intervals + 1];
+	TableNode *row1 = new TableNode[t_intervals + 1];
+	try {
+		for (int j=0; j<=t_intervals; j++)
+			build_node(*table, p_min, t_min + j*table->dt, row0[j]);
+		for (int i=0; i<p_intervals; i++) {
+			double p = p_min + (i+1)*table->dp;
+			for (int j=0; j<=t_intervals; j++)
+				build_node(*table, p, t_min + j*table->dt, row1[j]);
+			for (int j=0; j<t_intervals; j++) {
+				TableCell &cell = table->cells[(long) i*t_intervals + j];
+				int phase = row0[j].phase;
+				cell.valid = (row1[j].phase == phase) && (row0[j+1].phase == phase) && (row1[j+1].phase == phase);
+				if (!cell.valid) {
+					table->exact_cells++;
+					continue;
+				}
+				for (int k=0; k<TABLE_PROPERTY_COUNT; k++)
+					bicubic_coefficients(row0[j], row1[j], row0[j+1], row1[j+1], k, cell.a[k]);
+				// compare with the equations at the centre of the cell
+				double f[TABLE_PROPERTY_COUNT];
+				properties_pt(phase, p_min + (i+0.5)*table->dp, t_min + (j+0.5)*table->dt, f);
+				for (int k=0; k<TABLE_PROPERTY_COUNT; k++) {
+					double a = bicubic(cell.a[k], 0.5, 0.5);
+					double e = (k == TABLE_V) ? fabs(exp(a - f[k]) - 1) : fabs(a / f[k] - 1);
+					if (e > table->error[k])
+						table->error[k] = e;
+				}
+			}
+			TableNode *swap = row0;
+			row0 = row1;
+			row1 = swap;
+		}
+	}
+	catch(char const* chowder) {
+		delete [] row0;
+		delete [] row1;
+		TABLE_PT_FREE(table);
+		// rethrow the original error message as std::invalid_argument
+		throw std::invalid_argument(chowder);
+	}
+	delete [] row0;
+	delete [] row1;
+	return table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief releases a table built by TABLE_PT_BUILD or mapped by TABLE_PT_LOAD
+///
+/// The table must not be active in any thread.
+///
+/// \param[in] table property table
+///////////////////////////////////////////////////////////////////////////////
+void TABLE_PT_FREE(TablePT *table)
+{
+	if (table == 0)
+		return;
+	if (table->mapping != 0) {
+#ifdef _WIN32
+		UnmapViewOfFile(table->mapping);
+#else
+		munmap(table->mapping, table->mapping_size);
+#endif
+	}
+	else
+		delete [] table->cells;
+	delete table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the largest relative interpolation error of a property in a table
+///
+/// \param[in] table property table
+/// \param[in] property tabulated property
+///
+/// \return largest relative error found at the cell centres
+///////////////////////////////////////////////////////////////////////////////
+double TABLE_PT_ERROR(const TablePT *table, TableProperty property)
+{
+	return table->error[property];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief returns the number of cells of a table that straddle a region boundary or the
+///  saturation line, and so are calculated from the region equations
+///
+/// \param[in] table property table
+///
+/// \return number of cells without a patch
+///////////////////////////////////////////////////////////////////////////////
+long TABLE_PT_EXACT_CELLS(const TablePT *table)
+{
+	return table->exact_cells;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief makes a table the active table of the calling thread
+///
+/// \param[in] table property table, or 0 to stop using a table
+///
+/// \return the previously active table, or 0
+///////////////////////////////////////////////////////////////////////////////
+const TablePT *USE_TABLE_PT(const TablePT *table)
+{
+	const TablePT *previous = current_table;
+	current_table = table;
+	return previous;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates the checksum of the cells of a table file
+///
+/// FNV-1a over 64-bit words, which is fast enough to verify a mapped file at every
+/// load and detects truncated or partially written files.
+///
+/// \param[in] data cells
+/// \param[in] size length of the cells in bytes, a multiple of 8
+///
+/// \return checksum
+///////////////////////////////////////////////////////////////////////////////
+static uint64_t table_checksum(const void *data, uint64_t size)
+{
+	const uint64_t *word = (const uint64_t *) data;
+	uint64_t hash = 14695981039346656037ULL;
+	for (uint64_t i=0; i<size/8; i++) {
+		hash ^= word[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief saves a table to a binary file that TABLE_PT_LOAD can map
+///
+/// The file is written under a temporary name and renamed when complete, so that
+/// processes loading it concurrently see either a complete file or none.
+///
+/// \param[in] table property table
+/// \param[in] path name of the file
+///
+/// \exception std::ios_base::failure the file cannot be written
+///////////////////////////////////////////////////////////////////////////////
+void TABLE_PT_SAVE(const TablePT *table, const char *path)
+{
+	TableFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, table_file_magic, sizeof(header.magic));
+	header.format = table_file_format;
+	header.byte_order = table_file_byte_order;
+	strncpy(header.version, _WatpropPyVersion(), sizeof(header.version) - 1);
+	header.cell_size = sizeof(TableCell);
+	header.units = table->units;
+	for (int k=0; k<4; k++)
+		header.bounds[k] = table->bounds[k];
+	header.p_intervals = table->p_intervals;
+	header.t_intervals = table->t_intervals;
+	header.p_min = table->p_min;
+	header.t_min = table->t_min;
+	header.dp = table->dp;
+	header.dt = table->dt;
+	header.exact_cells = table->exact_cells;
+	for (int k=0; k<TABLE_PROPERTY_COUNT; k++)
+		header.error[k] = table->error[k];
+	header.cells_offset = table_file_alignment;
+	header.cells_size = (uint64_t) table->p_intervals * table->t_intervals * sizeof(TableCell);
+	header.checksum = table_checksum(table->cells, header.cells_size);
+
+	// a temporary name of its own for each process, in case several save the same table
+#ifdef _WIN32
+	std::string temporary = std::string(path) + "." + std::to_string(GetCurrentProcessId()) + ".tmp";
+#else
+	std::string temporary = std::string(path) + "." + std::to_string(getpid()) + ".tmp";
+#endif
+	FILE *file = fopen(temporary.c_str(), "wb");
+	if (file == 0)
+		throw std::ios_base::failure("cannot create table file in table_pt_save");
+	static const char zeros[4096] = {0};
+	bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+	for (uint64_t position = sizeof(header); ok && (position < header.cells_offset); ) {
+		size_t count = (size_t) std::min<uint64_t>(sizeof(zeros), header.cells_offset - position);
+		ok = fwrite(zeros, 1, count, file) == count;
+		position += count;
+	}
+	ok = ok && (fwrite(table->cells, 1, (size_t) header.cells_size, file) == header.cells_size);
+	ok = (fclose(file) == 0) && ok;
+#ifdef _WIN32
+	// rename does not replace an existing file on Windows
+	ok = ok && MoveFileExA(temporary.c_str(), path, MOVEFILE_REPLACE_EXISTING);
+#else
+	ok = ok && (rename(temporary.c_str(), path) == 0);
+#endif
+	if (!ok) {
+		remove(temporary.c_str());
+		throw std::ios_base::failure("cannot write table file in table_pt_save");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief checks that the header of a mapped table file matches the library and the
+///  requested table
+///
+/// \param[in] header file header
+/// \param[in] size length of the file
+/// \param[in] bounds p_min, p_max, t_min, and t_max as requested
+/// \param[in] p_intervals number of cells in pressure
+/// \param[in] t_intervals number of cells in temperature
+/// \param[in] input_units input units of measure
+///
+/// \return true if the file holds the requested table
+///////////////////////////////////////////////////////////////////////////////
+static bool table_file_matches(const TableFileHeader &header, uint64_t size, const double bounds[4], int p_intervals, int t_intervals, Units input_units)
+{
+	char version[sizeof(header.version)] = {0};
+	strncpy(version, _WatpropPyVersion(), sizeof(version) - 1);
+	if ((memcmp(header.magic, table_file_magic, sizeof(header.magic)) != 0)
+		|| (header.format != table_file_format)
+		|| (header.byte_order != table_file_byte_order)
+		|| (memcmp(header.version, version, sizeof(version)) != 0)
+		|| (header.cell_size != sizeof(TableCell))
+		|| (header.units != input_units)
+		|| (header.p_intervals != p_intervals)
+		|| (header.t_intervals != t_intervals))
+		return false;
+	for (int k=0; k<4; k++) {
+		if (header.bounds[k] != bounds[k])
+			return false;
+	}
+	return (header.cells_offset % table_file_alignment == 0)
+		&& (header.cells_size == (uint64_t) p_intervals * t_intervals * sizeof(TableCell))
+		&& (header.cells_offset <= size)
+		&& (header.cells_size <= size - header.cells_offset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief maps a table saved by TABLE_PT_SAVE read-only
+///
+/// The file is used only if it was written by the same version of the library on a
+/// compatible machine, for the same rectangle, cells, and units, and its checksum is
+/// intact.  Processes mapping the same file share its cells.
+///
+/// \param[in] path name of the file
+/// \param[in] p_min lowest pressure
+/// \param[in] p_max highest pressure
+/// \param[in] t_min lowest temperature
+/// \param[in] t_max highest temperature
+/// \param[in] p_intervals number of cells in pressure
+/// \param[in] t_intervals number of cells in temperature
+/// \param[in] input_units input units of measure
+///
+/// \return the mapped table, to be released with TABLE_PT_FREE, or 0 if the file
+///  does not exist or is refused
+///////////////////////////////////////////////////////////////////////////////
+TablePT *TABLE_PT_LOAD(const char *path, double p_min, double p_max, double t_min, double t_max, int p_intervals, int t_intervals, Units input_units)
+{
+	void *mapping = 0;
+	uint64_t size = 0;
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if (file == INVALID_HANDLE_VALUE)
+		return 0;
+	LARGE_INTEGER length;
+	if (GetFileSizeEx(file, &length) && (length.QuadPart >= (LONGLONG) sizeof(TableFileHeader))) {
+		size = (uint64_t) length.QuadPart;
+		HANDLE section = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+		if (section != 0) {
+			mapping = MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(section);
+		}
+	}
+	CloseHandle(file);
+#else
+	int file = open(path, O_RDONLY);
+	if (file < 0)
+		return 0;
+	struct stat status;
+	if ((fstat(file, &status) == 0) && (status.st_size >= (off_t) sizeof(TableFileHeader))) {
+		size = (uint64_t) status.st_size;
+		mapping = mmap(0, (size_t) size, PROT_READ, MAP_SHARED, file, 0);
+		if (mapping == MAP_FAILED)
+			mapping = 0;
+	}
+	close(file);
+#endif
+	if (mapping == 0)
+		return 0;
+	const TableFileHeader &header = *(const TableFileHeader *) mapping;
+	const double bounds[4] = {p_min, p_max, t_min, t_max};
+	const char *cells = (const char *) mapping + header.cells_offset;
+	if (!table_file_matches(header, size, bounds, p_intervals, t_intervals, input_units)
+		|| (table_checksum(cells, header.cells_size) != header.checksum)) {
+#ifdef _WIN32
+		UnmapViewOfFile(mapping);
+#else
+		munmap(mapping, (size_t) size);
+#endif
+		return 0;
+	}
+	TablePT *table = new TablePT;
+	for (int k=0; k<4; k++)
+		table->bounds[k] = bounds[k];
+	table->units = input_units;
+	table->mapping = mapping;
+	table->mapping_size = (size_t) size;
+	table->p_min = header.p_min;
+	table->t_min = header.t_min;
+	table->dp = header.dp;
+	table->dt = header.dt;
+	table->p_intervals = p_intervals;
+	table->t_intervals = t_intervals;
+	table->cells = (TableCell *) cells;
+	table->exact_cells = (long) header.exact_cells;
+	for (int k=0; k<TABLE_PROPERTY_COUNT; k++)
+		table->error[k] = header.error[k];
+	return table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief tells whether the cells of a table are mapped from a file
+///
+/// \param[in] table property table
+///
+/// \return true for a table from TABLE_PT_LOAD, false for one from TABLE_PT_BUILD
+///////////////////////////////////////////////////////////////////////////////
+bool TABLE_PT_MAPPED(const TablePT *table)
+{
+	return table->mapping != 0;
+}
@@ -0,0 +1,322 @@
+# test WatpropPy array functions against the scalar functions
+import pytest
+import numpy
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+english = WatpropPy.units.english
+
+tol = 1e-12
+#       pressure, deg-C
+pt_data = [
+	[3.0,      26.85],
+	[80.0,     26.85],
+	[0.0035,   426.85],
+	[30.0,     426.85],
+	[25.5837018, 376.85],
+	[30.0,     1726.85]]
+
+#=============================================================
+class TestFunctionsOfPT():
+	def test_Case0(self):
+		pressure = [row[0] for row in pt_data]
+		temperature = [row[1] for row in pt_data]
+		answer = WatpropPy.h_pt_array(pressure, temperature, si, si)
+		for i in range(len(pt_data)):
+			assert answer[i] == pytest.approx(WatpropPy.h_pt(pressure[i], temperature[i], si, si), rel=tol)
+
+	def test_Case1(self):
+		pressure = [row[0] for row in pt_data]
+		temperature = [row[1] for row in pt_data]
+		answer = WatpropPy.v_pt_array(pressure, temperature, si, si)
+		for i in range(len(pt_data)):
+			assert answer[i] == pytest.approx(WatpropPy.v_pt(pressure[i], temperature[i], si, si), rel=tol)
+
+	def test_Case2(self):
+		# a scalar pressure is broadcast against an array of temperatures
+		temperature = numpy.linspace(100, 1000, 7)
+		answer = WatpropPy.s_pt_array(2000, temperature)
+		assert answer.shape == temperature.shape
+		for i in range(len(temperature)):
+			assert answer[i] == pytest.approx(WatpropPy.s_pt(2000, temperature[i]), rel=tol)
+
+	def test_Case3(self):
+		# the shape of the inputs is preserved
+		pressure = numpy.full((2, 3), 1000.)
+		temperature = numpy.array([[100., 200., 300.], [400., 500., 600.]])
+		answer = WatpropPy.cp_pt_array(pressure, temperature)
+		assert answer.shape == (2, 3)
+		assert answer[1][2] == pytest.approx(WatpropPy.cp_pt(1000, 600), rel=tol)
+
+	def test_Case4(self):
+		answer = WatpropPy.w_pt_array([], [])
+		assert len(answer) == 0
+
+	def test_Case5(self):
+		with pytest.raises(ValueError) as excinfo:
+			WatpropPy.h_pt_array([3.0, 100.1], [20, 20], si, si)
+		assert "pressure out of bounds" in str(excinfo.value)
+
+#=============================================================
+class TestFunctionsOfT():
+	def test_Case0(self):
+		temperature = numpy.linspace(50, 700, 14)
+		answer = WatpropPy.p_t_array(temperature)
+		for i in range(len(temperature)):
+			assert answer[i] == pytest.approx(WatpropPy.p_t(temperature[i]), rel=tol)
+
+	def test_Case1(self):
+		temperature = numpy.linspace(1, 373, 14)
+		answer = WatpropPy.hg_t_array(temperature, si, si)
+		for i in range(len(temperature)):
+			assert answer[i] == pytest.approx(WatpropPy.hg_t(temperature[i], si, si), rel=tol)
+
+#=============================================================
+class TestFunctionsOfP():
+	def test_Case0(self):
+		pressure = numpy.linspace(1, 3200, 14)
+		answer = WatpropPy.t_p_array(pressure)
+		for i in range(len(pressure)):
+			assert answer[i] == pytest.approx(WatpropPy.t_p(pressure[i]), rel=tol)
+
+	def test_Case1(self):
+		pressure = numpy.linspace(1, 3200, 14)
+		answer = WatpropPy.vf_p_array(pressure)
+		for i in range(len(pressure)):
+			assert answer[i] == pytest.approx(WatpropPy.vf_p(pressure[i]), rel=tol)
+
+#=============================================================
+class TestFunctionsOfPH():
+	def test_Case0(self):
+		pressure = [0.001, 3.0, 3.0, 25.0, 80.0]
+		enthalpy = [3000.0, 500.0, 2000.0, 2000.0, 1000.0]
+		answer = WatpropPy.t_ph_array(pressure, enthalpy, si, si)
+		for i in range(len(pressure)):
+			assert answer[i] == pytest.approx(WatpropPy.t_ph(pressure[i], enthalpy[i], si, si), rel=tol)
+
+	def test_Case1(self):
+		pressure = [0.001, 3.0, 3.0, 25.0, 80.0]
+		enthalpy = [3000.0, 500.0, 2000.0, 2000.0, 1000.0]
+		answer = WatpropPy.s_ph_array(pressure, enthalpy, si, si)
+		for i in range(len(pressure)):
+			assert answer[i] == pytest.approx(WatpropPy.s_ph(pressure[i], enthalpy[i], si, si), rel=tol)
+
+#=============================================================
+class TestThreads():
+	# enough statepoints for several chunks per thread, over regions 1, 2, 3, and 5
+	pressure = numpy.linspace(1, 14000, 20000)
+	temperature = numpy.linspace(40, 2000, 20000)[::-1].copy()
+
+	def test_Case0(self):
+		serial = WatpropPy.h_pt_array(self.pressure, self.temperature)
+		for threads in (0, 2, 7):
+			assert numpy.array_equal(WatpropPy.h_pt_array(self.pressure, self.temperature, threads=threads), serial)
+
+	def test_Case1(self):
+		serial = WatpropPy.state_pt_array(self.pressure, self.temperature)
+		answer = WatpropPy.state_pt_array(self.pressure, self.temperature, threads=4)
+		# vis and k are NaN outside the range of the transport property equations
+		for name in serial.dtype.names:
+			assert numpy.array_equal(answer[name], serial[name], equal_nan=True)
+
+	def test_Case2(self):
+		# the workers use the solver options of the calling thread
+		pressure = numpy.linspace(1, 3000, 5000)
+		enthalpy = numpy.linspace(100, 1500, 5000)
+		with WatpropPy.settings(ph=WatpropPy.ph_method.interpolate):
+			answer = WatpropPy.t_ph_array(pressure, enthalpy, threads=4)
+			expected = [WatpropPy.t_ph(pressure[i], enthalpy[i]) for i in range(len(pressure))]
+		assert numpy.array_equal(answer, expected)
+
+	def test_Case3(self):
+		# the workers use the property table of the calling thread
+		table = WatpropPy.TablePT(100.0, 2000.0, 100.0, 1000.0, p_intervals=20, t_intervals=20)
+		pressure = numpy.linspace(100, 2000, 5000)
+		temperature = numpy.linspace(100, 1000, 5000)
+		with WatpropPy.use_table(table):
+			answer = WatpropPy.v_pt_array(pressure, temperature, threads=4)
+			expected = [WatpropPy.v_pt(pressure[i], temperature[i]) for i in range(len(pressure))]
+		assert numpy.array_equal(answer, expected)
+
+	def test_Case4(self):
+		# the error at the lowest index is raised, as in a serial evaluation
+		pressure = numpy.full(20000, 3.0)
+		temperature = numpy.full(20000, 20.0)
+		pressure[5000] = 100.1
+		temperature[19000] = 2001.0
+		with pytest.raises(ValueError) as excinfo:
+			WatpropPy.h_pt_array(pressure, temperature, si, si, threads=4)
+		assert "pressure out of bounds" in str(excinfo.value)
+
+	def test_Case5(self):
+		# array functions release the GIL and may be called from several Python threads
+		from concurrent.futures import ThreadPoolExecutor
+		serial = WatpropPy.s_pt_array(self.pressure, self.temperature)
+		with ThreadPoolExecutor(4) as pool:
+			answers = list(pool.map(lambda threads: WatpropPy.s_pt_array(self.pressure, self.temperature, threads=threads), [1, 2, 1, 2]))
+		for answer in answers:
+			assert numpy.array_equal(answer, serial)
+
+#=============================================================
+class TestErrors():
+	def test_Case0(self):
+		# with errors='nan' a statepoint out of bounds is NaN and the others are calculated
+		answer = WatpropPy.h_pt_array([3.0, 100.1, 3.0, 80.0], [20, 20, 2001, 1900], si, si, errors='nan')
+		assert answer[0] == WatpropPy.h_pt(3.0, 20, si, si)
+		assert numpy.isnan(answer[1]) and numpy.isnan(answer[2]) and numpy.isnan(answer[3])
+
+	def test_Case1(self):
+		# by default the first statepoint out of bounds raises the error of the scalar function
+		with pytest.raises(ValueError) as excinfo:
+			WatpropPy.h_pt_array([3.0, 80.0, 100.1], [20, 1900, 20], si, si)
+		assert "pressure/temperature combination out of bounds" in str(excinfo.value)
+		with pytest.raises(ValueError) as excinfo:
+			WatpropPy.hf_p_array([1000.0, 3300.0])
+		assert "invalid pressure in hf_p" in str(excinfo.value)
+		# the saturation functions keep their messages
+		with pytest.raises(ValueError) as excinfo:
+			WatpropPy.t_p_array([1.0, 23.0], si, si)
+		assert str(excinfo.value) == "input pressure out of bounds"
+		with pytest.raises(ValueError) as excinfo:
+			WatpropPy.p_t_array([100.0, 400.0], si, si)
+		assert str(excinfo.value) == "input temperature out of bounds"
+
+	def test_Case2(self):
+		# functions of one property and of (p,h)
+		answer = WatpropPy.vg_t_array([100.0, 800.0, 200.0], errors='nan')
+		assert numpy.isnan(answer[1])
+		assert answer[2] == WatpropPy.vg_t(200.0)
+		answer = WatpropPy.t_ph_array([1000.0, 15000.0], [1000.0, 1000.0], errors='nan')
+		assert answer[0] == WatpropPy.t_ph(1000.0, 1000.0)
+		assert numpy.isnan(answer[1])
+
+	def test_Case3(self):
+		# every field of a failed statepoint is NaN
+		answer = WatpropPy.state_pt_array([3.0, 100.1], [20, 20], si, si, errors='nan')
+		assert answer['h'][0] == WatpropPy.h_pt(3.0, 20, si, si)
+		for name in answer.dtype.names:
+			assert numpy.isnan(answer[name][1])
+
+	def test_Case4(self):
+		# failures across threads
+		pressure = numpy.full(20000, 3.0)
+		pressure[::7] = 100.1
+		answer = WatpropPy.s_pt_array(pressure, 20, si, si, threads=4, errors='nan')
+		assert numpy.array_equal(numpy.isnan(answer), pressure > 100)
+
+	def test_Case5(self):
+		with pytest.raises(ValueError):
+			WatpropPy.w_pt_array([3.0], [20], si, si, errors='ignore')
+
+#=============================================================
+class TestRegion1Kernel():
+	# compressed liquid feedwater sweep, with a few points in regions 2 and 3 and out of bounds
+	pressure = numpy.linspace(1, 100, 3001)
+	temperature = numpy.linspace(5, 345, 3001)
+	pressure[::50] = 0.5
+	temperature[::97] = 360.0
+	pressure[::301] = 100.1
+
+	def test_Case0(self):
+		# the vectorized Region 1 kernel gives the scalar results to the last bit
+		for array, scalar in ((WatpropPy.h_pt_array, WatpropPy.h_pt), (WatpropPy.v_pt_array, WatpropPy.v_pt),
+				(WatpropPy.s_pt_array, WatpropPy.s_pt), (WatpropPy.cp_pt_array, WatpropPy.cp_pt)):
+			answer = array(self.pressure, self.temperature, si, si, errors='nan')
+			for i in range(len(self.pressure)):
+				if self.pressure[i] > 100:
+					assert numpy.isnan(answer[i])
+				else:
+					assert answer[i] == scalar(self.pressure[i], self.temperature[i], si, si)
+
+	def test_Case1(self):
+		# English units
+		pressure = numpy.linspace(100, 14000, 2000)
+		temperature = numpy.linspace(40, 650, 2000)
+		answer = WatpropPy.h_pt_array(pressure, temperature, threads=2)
+		for i in range(len(pressure)):
+			assert answer[i] == WatpropPy.h_pt(pressure[i], temperature[i])
+
+	def test_Case2(self):
+		answer = WatpropPy.state_pt_array(self.pressure, self.temperature, si, si, errors='nan')
+		for i in range(len(self.pressure)):
+			if self.pressure[i] > 100:
+				continue
+			p = self.pressure[i]
+			t = self.temperature[i]
+			assert answer['h'][i] == WatpropPy.h_pt(p, t, si, si)
+			assert answer['v'][i] == WatpropPy.v_pt(p, t, si, si)
+			assert answer['cp'][i] == WatpropPy.cp_pt(p, t, si, si)
+			assert answer['vis'][i] == WatpropPy.vis_pt(p, t, si, si)
+			assert answer['k'][i] == WatpropPy.k_pt(p, t, si, si)
+
+	def test_Case3(self):
+		# an active property table takes precedence over the kernel
+		table = WatpropPy.TablePT(20.0, 100.0, 10.0, 340.0, 10, 10, si)
+		with WatpropPy.use_table(table):
+			answer = WatpropPy.h_pt_array(self.pressure, self.temperature, si, si, errors='nan')
+			for i in range(0, len(self.pressure), 13):
+				if self.pressure[i] <= 100:
+					assert answer[i] == WatpropPy.h_pt(self.pressure[i], self.temperature[i], si, si)
+
+#=============================================================
+class TestRegion2Kernel():
+	# turbine expansion line in superheated steam, ending in a few Region 1 points
+	pressure = numpy.geomspace(16.0, 0.005, 3001)
+	temperature = numpy.linspace(560, 30, 3001)
+
+	def test_Case0(self):
+		# the vectorized Region 2 kernel gives the scalar results to the last bit
+		for array, scalar in ((WatpropPy.h_pt_array, WatpropPy.h_pt), (WatpropPy.v_pt_array, WatpropPy.v_pt),
+				(WatpropPy.s_pt_array, WatpropPy.s_pt), (WatpropPy.cp_pt_array, WatpropPy.cp_pt)):
+			answer = array(self.pressure, self.temperature, si, si)
+			for i in range(len(self.pressure)):
+				assert answer[i] == scalar(self.pressure[i], self.temperature[i], si, si)
+
+	def test_Case1(self):
+		# English units, across threads
+		pressure = numpy.geomspace(2400, 0.5, 5000)
+		temperature = numpy.linspace(1050, 90, 5000)
+		answer = WatpropPy.s_pt_array(pressure, temperature, threads=3)
+		for i in range(len(pressure)):
+			assert answer[i] == WatpropPy.s_pt(pressure[i], temperature[i])
+
+	def test_Case2(self):
+		answer = WatpropPy.state_pt_array(self.pressure, self.temperature, si, si)
+		for i in range(0, len(self.pressure), 7):
+			p = self.pressure[i]
+			t = self.temperature[i]
+			assert answer['h'][i] == WatpropPy.h_pt(p, t, si, si)
+			assert answer['s'][i] == WatpropPy.s_pt(p, t, si, si)
+			assert answer['vis'][i] == WatpropPy.vis_pt(p, t, si, si)
+			assert answer['k'][i] == WatpropPy.k_pt(p, t, si, si)
+
+#=============================================================
+class TestLockStepTPH():
+	# compressed liquid and superheated steam, with a few statepoints in regions 3 and 4 and out of bounds
+	pressure = numpy.concatenate((numpy.linspace(1, 100, 1500), numpy.geomspace(0.01, 10, 1500), [25.0, 1.0, 101.0]))
+	enthalpy = numpy.concatenate((numpy.linspace(100, 1400, 1500), numpy.linspace(2900, 3600, 1500), [2000.0, 1500.0, 1000.0]))
+
+	def test_Case0(self):
+		# the lock-step searches give the temperatures of the scalar function to the last bit
+		answer = WatpropPy.t_ph_array(self.pressure, self.enthalpy, si, si, errors='nan')
+		for i in range(len(self.pressure) - 1):
+			assert answer[i] == WatpropPy.t_ph(self.pressure[i], self.enthalpy[i], si, si)
+		assert numpy.isnan(answer[-1])
+
+	def test_Case1(self):
+		# English units, across threads
+		pressure = numpy.linspace(100, 3000, 5000)
+		enthalpy = numpy.linspace(50, 1500, 5000)
+		answer = WatpropPy.t_ph_array(pressure, enthalpy, threads=3)
+		for i in range(0, len(pressure), 3):
+			assert answer[i] == WatpropPy.t_ph(pressure[i], enthalpy[i])
+
+	def test_Case2(self):
+		# the backward equations are used when selected
+		with WatpropPy.settings(backward_ph=WatpropPy.backward_mode.polish):
+			answer = WatpropPy.t_ph_array(self.pressure[:-1], self.enthalpy[:-1], si, si)
+			for i in range(0, len(self.pressure) - 1, 11):
+				assert answer[i] == WatpropPy.t_ph(self.pressure[i], self.enthalpy[i], si, si)
@@ -0,0 +1,190 @@
+# test WatpropPy with the IAPWS-IF97 backward equations selected
+import pytest
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+off = WatpropPy.backward_mode.off
+direct = WatpropPy.backward_mode.direct
+polish = WatpropPy.backward_mode.polish
+
+tol = 1e-7
+# IAPWS-IF97 verification values of the backward equations T(p,h)
+#       pressure,  enthalpy,  deg-K
+tph_data = [
+	[3.0,      500.0,  0.391798509E+03],
+	[80.0,     500.0,  0.378108626E+03],
+	[80.0,    1500.0,  0.611041229E+03],
+	[0.001,   3000.0,  0.534433241E+03],
+	[3.0,     3000.0,  0.575373370E+03],
+	[3.0,     4000.0,  0.101077577E+04],
+	[5.0,     3500.0,  0.801299102E+03],
+	[5.0,     4000.0,  0.101531583E+04],
+	[25.0,    3500.0,  0.875279054E+03],
+	[40.0,    2700.0,  0.743056411E+03],
+	[60.0,    2700.0,  0.791137067E+03],
+	[60.0,    3200.0,  0.882756860E+03]]
+
+#=============================================================
+class TestBackwardTPH():
+	def test_Case0(self):
+		# the backward equations are evaluated directly
+		with WatpropPy.settings(backward_ph=direct):
+			for row in tph_data:
+				assert WatpropPy.t_ph(row[0], row[1], si, si) + 273.15 == pytest.approx(row[2], rel=tol)
+
+	def test_Case1(self):
+		# the Newton polish agrees with iterating on the forward equations alone
+		for row in tph_data:
+			expected = WatpropPy.t_ph(row[0], row[1], si, si)
+			with WatpropPy.settings(backward_ph=polish):
+				assert WatpropPy.t_ph(row[0], row[1], si, si) == pytest.approx(expected, rel=1e-12)
+				assert WatpropPy.v_ph(row[0], row[1], si, si) == pytest.approx(WatpropPy.v_pt(row[0], expected, si, si), rel=1e-12)
+
+	def test_Case2(self):
+		# the forward equations are used unless the backward equations are requested
+		assert WatpropPy.get_settings()['backward_ph'] == off
+
+# IAPWS-IF97 verification values of the Region 3 backward equations v(p,T), two in
+# each of subregions 3a to 3z
+#       pressure,  deg-K,  specific volume
+vpt_data = [
+	[50.0,  630.0,  0.1470853100E-02],
+	[80.0,  670.0,  0.1503831359E-02],
+	[50.0,  710.0,  0.2204728587E-02],
+	[80.0,  750.0,  0.1973692940E-02],
+	[20.0,  630.0,  0.1761696406E-02],
+	[30.0,  650.0,  0.1819560617E-02],
+	[26.0,  656.0,  0.2245587720E-02],
+	[30.0,  670.0,  0.2506897702E-02],
+	[26.0,  661.0,  0.2970225962E-02],
+	[30.0,  675.0,  0.3004627086E-02],
+	[26.0,  671.0,  0.5019029401E-02],
+	[30.0,  690.0,  0.4656470142E-02],
+	[23.6,  649.0,  0.2163198378E-02],
+	[24.0,  650.0,  0.2166044161E-02],
+	[23.6,  652.0,  0.2651081407E-02],
+	[24.0,  654.0,  0.2967802335E-02],
+	[23.6,  653.0,  0.3273916816E-02],
+	[24.0,  655.0,  0.3550329864E-02],
+	[23.5,  655.0,  0.4545001142E-02],
+	[24.0,  660.0,  0.5100267704E-02],
+	[23.0,  660.0,  0.6109525997E-02],
+	[24.0,  670.0,  0.6427325645E-02],
+	[22.6,  646.0,  0.2117860851E-02],
+	[23.0,  646.0,  0.2062374674E-02],
+	[22.6,  648.6,  0.2533063780E-02],
+	[22.8,  649.3,  0.2572971781E-02],
+	[22.6,  649.0,  0.2923432711E-02],
+	[22.8,  649.7,  0.2913311494E-02],
+	[22.6,  649.1,  0.3131208996E-02],
+	[22.8,  649.9,  0.3221160278E-02],
+	[22.6,  649.4,  0.3715596186E-02],
+	[22.8,  650.2,  0.3664754790E-02],
+	[21.1,  640.0,  0.1970999272E-02],
+	[21.8,  643.0,  0.2043919161E-02],
+	[21.1,  644.0,  0.5251009921E-02],
+	[21.8,  648.0,  0.5256844741E-02],
+	[19.1,  635.0,  0.1932829079E-02],
+	[20.0,  638.0,  0.1985387227E-02],
+	[17.0,  626.0,  0.8483262001E-02],
+	[20.0,  640.0,  0.6227528101E-02],
+	[21.5,  644.6,  0.2268366647E-02],
+	[22.0,  646.1,  0.2296350553E-02],
+	[22.5,  648.6,  0.2832373260E-02],
+	[22.3,  647.9,  0.2811424405E-02],
+	[22.15, 647.5,  0.3694032281E-02],
+	[22.3,  648.1,  0.3622226305E-02],
+	[22.11, 648.0,  0.4528072649E-02],
+	[22.3,  649.0,  0.4556905799E-02],
+	[22.0,  646.84, 0.2698354719E-02],
+	[22.064, 647.05, 0.2717655648E-02],
+	[22.0,  646.89, 0.3798732962E-02],
+	[22.064, 647.15, 0.3701940010E-02]]
+
+# IAPWS-IF97 verification values of the subregion boundary equations T(p).  T3ab, T3ef,
+# and T3gh are left out: at their verification points the backward equations on either
+# side agree to within rounding, so there is no step in v to locate.
+#       pressure,  deg-K
+boundary_data = [
+	[25.0,  649.3659208],  # 3cd
+	[23.0,  651.5778091],  # 3ij
+	[23.0,  655.8338344],  # 3jk
+	[22.8,  649.6054133],  # 3mn
+	[22.8,  650.0106943],  # 3op
+	[22.0,  645.6355027],  # 3qu
+	[22.0,  648.2622754],  # 3rx
+	[22.3,  647.7996121],  # 3uv
+	[22.3,  648.2049480]]  # 3wx
+
+#=============================================================
+class TestBackwardVPT():
+	def test_Case0(self):
+		# the backward equations are evaluated directly
+		with WatpropPy.settings(backward_pt=direct):
+			for row in vpt_data:
+				assert WatpropPy.v_pt(row[0], row[1] - 273.15, si, si) == pytest.approx(row[2], rel=tol)
+
+	def test_Case1(self):
+		# the Newton polish agrees with iterating on the forward equations alone
+		for row in vpt_data:
+			expected = WatpropPy.v_pt(row[0], row[1] - 273.15, si, si)
+			with WatpropPy.settings(backward_pt=polish):
+				assert WatpropPy.v_pt(row[0], row[1] - 273.15, si, si) == pytest.approx(expected, rel=1e-12)
+
+	def test_Case2(self):
+		# the forward equations are used unless the backward equations are requested
+		assert WatpropPy.get_settings()['backward_pt'] == off
+
+	def test_Case3(self):
+		# the backward equations change from one subregion to the next at the boundary
+		# temperature: the step in v across it is far larger than the steps either side
+		dt = 1e-7
+		with WatpropPy.settings(backward_pt=direct):
+			for row in boundary_data:
+				v = [WatpropPy.v_pt(row[0], row[1] - 273.15 + k*dt, si, si) for k in (-3, -1, 1, 3)]
+				left = v[1] - v[0]
+				right = v[3] - v[2]
+				step = v[2] - v[1]
+				assert abs(step - (left + right)/2) > 10*max(abs(left), abs(right))
+
+# IAPWS-IF97 verification values of the Region 3 backward equations T(p,h) and v(p,h)
+#       pressure,  enthalpy,  deg-K,  specific volume
+r3ph_data = [
+	[20.0,    1700.0,  0.6293083892E+03,  0.1749903962E-02],
+	[50.0,    2000.0,  0.6905718338E+03,  0.1908139035E-02],
+	[100.0,   2100.0,  0.7336163014E+03,  0.1676229776E-02],
+	[20.0,    2500.0,  0.6418418053E+03,  0.6670547043E-02],
+	[50.0,    2400.0,  0.7351848618E+03,  0.2801244590E-02],
+	[100.0,   2700.0,  0.8420460876E+03,  0.2404234998E-02]]
+
+#=============================================================
+class TestBackwardRegion3PH():
+	def test_Case0(self):
+		# the backward equations are evaluated directly
+		with WatpropPy.settings(backward_ph=direct):
+			for row in r3ph_data:
+				assert WatpropPy.t_ph(row[0], row[1], si, si) + 273.15 == pytest.approx(row[2], rel=tol)
+				assert WatpropPy.v_ph(row[0], row[1], si, si) == pytest.approx(row[3], rel=tol)
+
+	def test_Case1(self):
+		# the Newton polish agrees with iterating on the forward equations alone
+		for row in r3ph_data:
+			t = WatpropPy.t_ph(row[0], row[1], si, si)
+			v = WatpropPy.v_ph(row[0], row[1], si, si)
+			s = WatpropPy.s_ph(row[0], row[1], si, si)
+			with WatpropPy.settings(backward_ph=polish):
+				assert WatpropPy.t_ph(row[0], row[1], si, si) == pytest.approx(t, rel=1e-12)
+				assert WatpropPy.v_ph(row[0], row[1], si, si) == pytest.approx(v, rel=1e-12)
+				assert WatpropPy.s_ph(row[0], row[1], si, si) == pytest.approx(s, rel=1e-12)
+
+	def test_Case2(self):
+		# two-phase states return the saturation temperature in every mode
+		p = 20.0
+		h = 0.5 * (WatpropPy.hf_p(p, si, si) + WatpropPy.hg_p(p, si, si))
+		expected = WatpropPy.t_ph(p, h, si, si)
+		for mode in [direct, polish]:
+			with WatpropPy.settings(backward_ph=mode):
+				assert WatpropPy.t_ph(p, h, si, si) == pytest.approx(expected, rel=1e-12)
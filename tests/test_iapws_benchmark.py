@@ -0,0 +1,147 @@
+# benchmark the WatpropPy bindings: scalar calls, the array functions, and (p,h) sweeps
+#
+# These are deselected by default (see pytest.ini); run them with
+#     python -m pytest -m benchmark --benchmark-save=baseline
+# and compare a later build against the saved baseline with
+#     python -m pytest -m benchmark --benchmark-compare --benchmark-compare-fail=mean:20%
+import pytest
+import numpy
+
+import WatpropPy
+
+pytestmark = pytest.mark.benchmark
+
+si = WatpropPy.units.si
+
+#       p_min,  p_max,  t_min,  t_max (MPa, deg-C) of a grid of statepoints in each region
+regions = {
+	'region1': (20.0,   100.0,  5.0,    345.0),
+	'region2': (0.01,   15.0,   380.0,  795.0),
+	'region3': (50.0,   100.0,  380.0,  500.0),
+	'region5': (0.5,    50.0,   850.0,  1950.0)}
+
+def grid_pt(region, n=32):
+	p_min, p_max, t_min, t_max = regions[region]
+	p, t = numpy.meshgrid(numpy.linspace(p_min, p_max, n), numpy.linspace(t_min, t_max, n))
+	return p.ravel(), t.ravel()
+
+def grid_ph(region, n=32):
+	p, t = grid_pt(region, n)
+	return p, WatpropPy.h_pt_array(p, t, si, si)
+
+def grid_two_phase(n=32):
+	p = numpy.repeat(numpy.logspace(-2, numpy.log10(21.0), n), n)
+	hf = WatpropPy.hf_p_array(p, si, si)
+	hg = WatpropPy.hg_p_array(p, si, si)
+	quality = numpy.tile((numpy.arange(n) + 0.5) / n, n)
+	return p, hf + quality * (hg - hf)
+
+def grid_sweep(n=64):
+	# covers Regions 1 to 5 and some statepoints outside them, which return NaN
+	p, h = numpy.meshgrid(numpy.logspace(-2, numpy.log10(50.0), n), numpy.linspace(50.0, 5500.0, n))
+	return p.ravel(), h.ravel()
+
+def run(benchmark, function, calls):
+	# times function and reports the rate of the library calls it makes
+	benchmark(function)
+	if benchmark.stats:
+		benchmark.extra_info['calls_per_second'] = calls / benchmark.stats.stats.mean
+
+def scalar_loop(function, x, y):
+	def loop():
+		for i in range(len(x)):
+			function(x[i], y[i], si, si)
+	return loop
+
+#=============================================================
+@pytest.mark.benchmark(group='scalar')
+class TestScalar():
+	# one call per statepoint, the cost of the wrapper included
+	@pytest.mark.parametrize('region', sorted(regions))
+	def test_Case0(self, benchmark, region):
+		p, t = grid_pt(region, 16)
+		run(benchmark, scalar_loop(WatpropPy.h_pt, p.tolist(), t.tolist()), len(p))
+
+	@pytest.mark.parametrize('region', sorted(regions))
+	def test_Case1(self, benchmark, region):
+		p, t = grid_pt(region, 16)
+		run(benchmark, scalar_loop(WatpropPy.v_pt, p.tolist(), t.tolist()), len(p))
+
+	@pytest.mark.parametrize('region', sorted(regions))
+	def test_Case2(self, benchmark, region):
+		p, t = grid_pt(region, 16)
+		run(benchmark, scalar_loop(WatpropPy.state_pt, p.tolist(), t.tolist()), len(p))
+
+	@pytest.mark.parametrize('region', sorted(regions))
+	def test_Case3(self, benchmark, region):
+		p, h = grid_ph(region, 16)
+		run(benchmark, scalar_loop(WatpropPy.t_ph, p.tolist(), h.tolist()), len(p))
+
+	def test_Case4(self, benchmark):
+		p, h = grid_two_phase(16)
+		run(benchmark, scalar_loop(WatpropPy.t_ph, p.tolist(), h.tolist()), len(p))
+
+	def test_Case5(self, benchmark):
+		t = numpy.linspace(0.01, 373.0, 256).tolist()
+		def loop():
+			for x in t:
+				WatpropPy.p_t(x, si, si)
+				WatpropPy.hf_t(x, si, si)
+				WatpropPy.hg_t(x, si, si)
+		run(benchmark, loop, 3 * len(t))
+
+#=============================================================
+@pytest.mark.benchmark(group='array')
+class TestArray():
+	# one call per array of statepoints
+	@pytest.mark.parametrize('region', sorted(regions))
+	def test_Case0(self, benchmark, region):
+		p, t = grid_pt(region)
+		run(benchmark, lambda: WatpropPy.h_pt_array(p, t, si, si), len(p))
+
+	@pytest.mark.parametrize('region', sorted(regions))
+	def test_Case1(self, benchmark, region):
+		p, t = grid_pt(region)
+		run(benchmark, lambda: WatpropPy.state_pt_array(p, t, si, si), len(p))
+
+	@pytest.mark.parametrize('region', sorted(regions))
+	def test_Case2(self, benchmark, region):
+		p, h = grid_ph(region)
+		run(benchmark, lambda: WatpropPy.t_ph_array(p, h, si, si), len(p))
+
+	def test_Case3(self, benchmark):
+		p, h = grid_two_phase()
+		run(benchmark, lambda: WatpropPy.t_ph_array(p, h, si, si), len(p))
+
+	def test_Case4(self, benchmark):
+		t = numpy.linspace(0.01, 373.0, 1024)
+		run(benchmark, lambda: WatpropPy.hf_t_array(t, si, si), len(t))
+
+	def test_Case5(self, benchmark):
+		# the same statepoints as a list, converted by the wrapper
+		p, t = grid_pt('region1')
+		p, t = p.tolist(), t.tolist()
+		run(benchmark, lambda: WatpropPy.h_pt_array(p, t, si, si), len(p))
+
+#=============================================================
+@pytest.mark.benchmark(group='sweep')
+class TestSweep():
+	# t, v, and s over a (p,h) grid spanning Regions 1 to 5
+	def test_Case0(self, benchmark):
+		p, h = grid_sweep()
+		def sweep():
+			WatpropPy.t_ph_array(p, h, si, si, errors='nan')
+			WatpropPy.v_ph_array(p, h, si, si, errors='nan')
+			WatpropPy.s_ph_array(p, h, si, si, errors='nan')
+		run(benchmark, sweep, 3 * len(p))
+
+	def test_Case1(self, benchmark):
+		p, h = grid_sweep(32)
+		valid = ~numpy.isnan(WatpropPy.t_ph_array(p, h, si, si, errors='nan'))
+		p, h = p[valid].tolist(), h[valid].tolist()
+		def sweep():
+			for i in range(len(p)):
+				WatpropPy.t_ph(p[i], h[i], si, si)
+				WatpropPy.v_ph(p[i], h[i], si, si)
+				WatpropPy.s_ph(p[i], h[i], si, si)
+		run(benchmark, sweep, 3 * len(p))
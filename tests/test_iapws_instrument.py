@@ -0,0 +1,79 @@
+# test WatpropPy solver instrumentation
+import pytest
+import numpy
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+
+instrumented = pytest.mark.skipif(not WatpropPy.solver_instrumented(),
+	reason='built without WATPROP_INSTRUMENT')
+
+#=============================================================
+class TestSolverStatistics():
+	def test_Case0(self):
+		# every solver has its counts and histograms, and every branch its count
+		statistics = WatpropPy.solver_statistics()
+		assert set(statistics['solvers']) == {'t_ph_1', 't_ph_2', 't_ph_3', 't_ph_5', 'd_pt_3_brent', 'd_pt_3_newton', 'polish',
+			't_ps_1', 't_ps_2', 't_ps_3', 't_ps_5', 'p_hs'}
+		for counts in statistics['solvers'].values():
+			assert len(counts['iterations']) == 32
+			assert len(counts['bracket']) == 32
+		assert 't_ph_3_saturated' in statistics['branches']
+
+	def test_Case1(self):
+		# without the instrumentation nothing is counted
+		if WatpropPy.solver_instrumented():
+			pytest.skip('built with WATPROP_INSTRUMENT')
+		WatpropPy.t_ph(25.0, 2000.0, si, si)
+		statistics = WatpropPy.solver_statistics()
+		assert all(counts['solves'] == 0 for counts in statistics['solvers'].values())
+		assert all(count == 0 for count in statistics['branches'].values())
+
+	@instrumented
+	def test_Case2(self):
+		# each evaluation of h in the Region 3 T(p,h) search solves for density once
+		WatpropPy.reset_solver_statistics()
+		WatpropPy.t_ph(25.0, 2000.0, si, si)
+		statistics = WatpropPy.solver_statistics()
+		t_ph_3 = statistics['solvers']['t_ph_3']
+		assert t_ph_3['solves'] == 1
+		assert t_ph_3['failures'] == 0
+		assert sum(t_ph_3['iterations']) == 1
+		assert sum(t_ph_3['bracket']) == 1
+		assert t_ph_3['iterations'][t_ph_3['evaluations'] - 2] == 1
+		assert statistics['solvers']['d_pt_3_newton']['solves'] == t_ph_3['evaluations']
+		assert statistics['branches']['t_ph_3_supercritical'] == 1
+
+	@instrumented
+	def test_Case3(self):
+		# the two-phase branch of T(p,h) in Region 3 needs no search
+		WatpropPy.reset_solver_statistics()
+		WatpropPy.t_ph(20.0, 2000.0, si, si)
+		statistics = WatpropPy.solver_statistics()
+		assert statistics['branches']['t_ph_3_saturated'] == 1
+		assert statistics['solvers']['t_ph_3']['solves'] == 0
+
+	@instrumented
+	def test_Case4(self):
+		# the counts of worker threads are kept after the threads exit, until a reset
+		WatpropPy.reset_solver_statistics()
+		p = numpy.full(100, 3.0)
+		h = numpy.linspace(100.0, 1000.0, 100)
+		WatpropPy.t_ph_array(p, h, si, si, threads=4)
+		assert WatpropPy.solver_statistics()['solvers']['t_ph_1']['solves'] == 100
+		WatpropPy.reset_solver_statistics()
+		assert WatpropPy.solver_statistics()['solvers']['t_ph_1']['solves'] == 0
+
+	@instrumented
+	def test_Case5(self):
+		# the Newton polish of the backward equation replaces the Brent search
+		WatpropPy.reset_solver_statistics()
+		with WatpropPy.settings(backward_ph=WatpropPy.backward_mode.polish):
+			WatpropPy.t_ph(3.0, 500.0, si, si)
+		statistics = WatpropPy.solver_statistics()
+		assert statistics['solvers']['polish']['solves'] == 1
+		assert statistics['solvers']['t_ph_1']['solves'] == 0
+		assert statistics['branches']['polish_fallback'] == 0
@@ -0,0 +1,92 @@
+# test WatpropPy call metrics
+import threading
+
+import pytest
+import numpy
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+
+@pytest.fixture
+def metrics():
+	# collect from zero, and restore the initial state afterwards
+	enabled = WatpropPy.metrics_enabled()
+	WatpropPy.set_metrics_enabled(True)
+	WatpropPy.reset_function_metrics()
+	yield
+	WatpropPy.set_metrics_enabled(enabled)
+	WatpropPy.reset_function_metrics()
+
+#=============================================================
+class TestFunctionMetrics():
+	def test_Case0(self, metrics):
+		# every steam table function has scalar and array counts and a latency histogram
+		snapshot = WatpropPy.function_metrics()
+		assert len(snapshot) == 30
+		assert {'h_pt', 'state_pt', 't_ph', 'vg_p'} <= set(snapshot)
+		for kinds in snapshot.values():
+			for counts in kinds.values():
+				assert counts['calls'] == 0
+				assert counts['messages'] == {}
+				assert len(counts['latency']) == 40
+
+	def test_Case1(self, metrics):
+		# each call of one statepoint is counted once, with its duration
+		for t in (100.0, 200.0, 300.0):
+			WatpropPy.h_pt(1.0, t, si, si)
+		h_pt = WatpropPy.function_metrics()['h_pt']['scalar']
+		assert h_pt['calls'] == 3
+		assert h_pt['points'] == 3
+		assert h_pt['errors'] == 0
+		assert sum(h_pt['latency']) == 3
+		assert h_pt['total_ns'] > 0
+
+	def test_Case2(self, metrics):
+		# errors are counted by message
+		for p in (200.0, 300.0):
+			with pytest.raises(ValueError):
+				WatpropPy.h_pt(p, 100.0, si, si)
+		with pytest.raises(ValueError):
+			WatpropPy.hf_t(400.0, si, si)
+		snapshot = WatpropPy.function_metrics()
+		assert snapshot['h_pt']['scalar']['errors'] == 2
+		assert snapshot['h_pt']['scalar']['messages'] == {'pressure out of bounds': 2}
+		assert snapshot['hf_t']['scalar']['messages'] == {'invalid temperature in hf_t': 1}
+
+	def test_Case3(self, metrics):
+		# an array call is counted once, with its statepoints and the statepoints that failed
+		p = numpy.array([1.0, 2.0, 200.0, 300.0])
+		t = numpy.array([100.0, 200.0, 100.0, 100.0])
+		WatpropPy.v_pt_array(p, t, si, si, errors='nan')
+		v_pt = WatpropPy.function_metrics()['v_pt']
+		assert v_pt['array']['calls'] == 1
+		assert v_pt['array']['points'] == 4
+		assert v_pt['array']['errors'] == 2
+		assert v_pt['array']['messages'] == {'pressure out of bounds': 2}
+		assert v_pt['scalar']['calls'] == 0
+
+	def test_Case4(self, metrics):
+		# the counts of worker threads and Python threads are kept after the threads exit
+		count = 10000
+		WatpropPy.t_ph_array(numpy.full(count, 1.0), numpy.full(count, 500.0), si, si, threads=4)
+		workers = [threading.Thread(target=WatpropPy.s_ph, args=(1.0, 500.0, si, si)) for i in range(4)]
+		for worker in workers:
+			worker.start()
+		for worker in workers:
+			worker.join()
+		snapshot = WatpropPy.function_metrics()
+		assert snapshot['t_ph']['array']['calls'] == 1
+		assert snapshot['t_ph']['array']['points'] == count
+		assert snapshot['s_ph']['scalar']['calls'] == 4
+
+	def test_Case5(self, metrics):
+		# nothing is counted while collection is off, and a reset clears the counts
+		WatpropPy.p_t(100.0, si, si)
+		WatpropPy.set_metrics_enabled(False)
+		WatpropPy.p_t(100.0, si, si)
+		assert WatpropPy.function_metrics()['p_t']['scalar']['calls'] == 1
+		WatpropPy.reset_function_metrics()
+		assert WatpropPy.function_metrics()['p_t']['scalar']['calls'] == 0
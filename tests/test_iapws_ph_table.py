@@ -0,0 +1,95 @@
+# test WatpropPy with the (p,h) table selected
+import numpy
+import pytest
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+english = WatpropPy.units.english
+iterate = WatpropPy.ph_method.iterate
+interpolate = WatpropPy.ph_method.interpolate
+
+functions = {'t': WatpropPy.t_ph, 'v': WatpropPy.v_ph, 's': WatpropPy.s_ph}
+
+# statepoints (MPa, kJ/kg) in every piece of the table: compressed liquid, superheated
+# steam, the liquid and vapor sides of region 3, and supercritical region 3
+single_phase = [(0.001, 20.0), (0.1, 200.0), (1.0, 700.0), (10.0, 1400.0), (16.0, 1600.0), (50.0, 500.0), (100.0, 1500.0),
+	(0.005, 2600.0), (0.1, 2700.0), (1.0, 3500.0), (10.0, 2800.0), (16.0, 4000.0), (30.0, 3000.0), (100.0, 3600.0),
+	(18.0, 1650.0), (20.0, 2450.0), (25.0, 2000.0), (60.0, 1900.0), (100.0, 2200.0)]
+# two-phase statepoints below 16.5292 MPa
+two_phase = [(0.0015, 100.0), (0.0123, 1500.0), (0.101325, 2600.0), (1.0, 800.0), (5.0, 2000.0), (16.0, 2500.0)]
+# statepoints not covered by the table: below 1 kPa, region 5, the region 3 two-phase
+# region, and near the critical point
+uncovered = [(0.0008, 2600.0), (1.0, 4500.0), (20.0, 2000.0), (22.0, 2100.0)]
+
+def difference(name, value, expected):
+	# the error in the specific volume is relative
+	if name == 'v':
+		return abs(value/expected - 1)
+	return abs(value - expected)
+
+#=============================================================
+class TestPHTable():
+	def test_Case0(self):
+		# iteration on the region equations is the default
+		assert WatpropPy.get_settings()['ph'] == iterate
+
+	def test_Case1(self):
+		# the error bounds are small
+		errors = WatpropPy.ph_table_error()
+		assert sorted(errors) == sorted(functions)
+		assert 0 < errors['t'] < 5e-3
+		assert 0 < errors['v'] < 1e-4
+		assert 0 < errors['s'] < 1e-4
+
+	@pytest.mark.parametrize('p, h', single_phase + two_phase)
+	def test_Case2(self, p, h):
+		# interpolated values agree with the region equations within the error bounds
+		errors = WatpropPy.ph_table_error()
+		interpolated = False
+		for name, f in functions.items():
+			expected = f(p, h, si, si)
+			with WatpropPy.settings(ph=interpolate):
+				value = f(p, h, si, si)
+			interpolated = interpolated or (value != expected)
+			assert difference(name, value, expected) <= errors[name]
+		assert interpolated
+
+	@pytest.mark.parametrize('p, h', uncovered)
+	def test_Case3(self, p, h):
+		# statepoints outside the table use the region equations
+		for f in functions.values():
+			expected = f(p, h, si, si)
+			with WatpropPy.settings(ph=interpolate):
+				assert f(p, h, si, si) == expected
+
+	def test_Case4(self):
+		# two-phase states lie on the straight line between the saturated endpoints
+		p = 1.0
+		with WatpropPy.settings(ph=interpolate):
+			v = [WatpropPy.v_ph(p, h, si, si) for h in (900.0, 1700.0, 2500.0)]
+			s = [WatpropPy.s_ph(p, h, si, si) for h in (900.0, 1700.0, 2500.0)]
+			t = [WatpropPy.t_ph(p, h, si, si) for h in (900.0, 1700.0, 2500.0)]
+		assert v[1] == pytest.approx((v[0] + v[2])/2, rel=1e-12)
+		assert s[1] == pytest.approx((s[0] + s[2])/2, rel=1e-12)
+		assert t[0] == t[1] == t[2]
+
+	def test_Case5(self):
+		# unit conversion and the array functions are unchanged
+		with WatpropPy.settings(ph=interpolate):
+			assert WatpropPy.t_ph(1000.0, 1300.0, english, english) == pytest.approx(
+				WatpropPy.t_ph(1000.0/145.0377, 1300.0*2.326, si, english), rel=1e-5)
+			p = numpy.array([p for p, h in single_phase])
+			h = numpy.array([h for p, h in single_phase])
+			expected = [WatpropPy.s_ph(x, y, si, si) for x, y in single_phase]
+			assert list(WatpropPy.s_ph_array(p, h, si, si)) == expected
+
+	def test_Case6(self):
+		# out of range statepoints are still rejected
+		with WatpropPy.settings(ph=interpolate):
+			with pytest.raises(ValueError):
+				WatpropPy.t_ph(1.0, -100.0, si, si)
+			with pytest.raises(ValueError):
+				WatpropPy.t_ph(101.0, 1000.0, si, si)
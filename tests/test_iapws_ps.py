@@ -0,0 +1,176 @@
+# test WatpropPy as a function of P,S and H,S
+import pytest
+import numpy
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+english = WatpropPy.units.english
+
+tol = 1e-7
+# statepoints in Regions 1, 2, 3, and 5
+#       pressure,  deg-K
+pt_data = [
+	[3.0,      300.0],
+	[80.0,     300.0],
+	[3.0,      500.0],
+	[0.0035,   300.0],
+	[0.0035,   700.0],
+	[30.0,     700.0],
+	[25.0,     650.0],
+	[22.064,   660.0],
+	[18.0,     630.0],
+	[50.0,     750.0],
+	[0.5,     1500.0],
+	[30.0,    2000.0]]
+
+# IAPWS-IF97 verification values of the backward equations T(p,s), which the
+# Newton polish on the forward equations must reproduce to within their accuracy
+#       pressure,  entropy,  deg-K
+tps_data = [
+	[3.0,      0.5,  0.307842258E+03],
+	[80.0,     3.0,  0.565899909E+03],
+	[0.1,      7.5,  0.399517097E+03],
+	[2.5,      8.0,  0.103984917E+04],
+	[8.0,      6.0,  0.600484040E+03],
+	[90.0,     6.0,  0.103801126E+04],
+	[20.0,     5.75, 0.697992849E+03],
+	[20.0,     3.8,  0.628295999E+03],
+	[100.0,    4.0,  0.705688024E+03],
+	[100.0,    5.0,  0.847433282E+03]]
+
+#=============================================================
+class TestTemperaturePS():
+	def test_Case0(self):
+		# the temperature is recovered from the entropy in every region
+		for row in pt_data:
+			temperature = row[1]-273.15
+			entropy = WatpropPy.s_pt(row[0], temperature, si, si)
+			assert WatpropPy.t_ps(row[0], entropy, si, si) == pytest.approx(temperature, rel=tol)
+
+	def test_Case1(self):
+		# the backward equations are accurate to within 25 mK
+		for row in tps_data:
+			assert WatpropPy.t_ps(row[0], row[1], si, si) + 273.15 == pytest.approx(row[2], abs=0.025)
+
+	def test_Case2(self):
+		# a two-phase mixture is at the saturation temperature
+		sf = WatpropPy.sf_p(1.0, si, si)
+		sg = WatpropPy.sg_p(1.0, si, si)
+		assert WatpropPy.t_ps(1.0, (sf+sg)/2, si, si) == pytest.approx(WatpropPy.t_p(1.0, si, si), rel=tol)
+
+	def test_Case3(self):
+		# English units
+		entropy = WatpropPy.s_pt(1000.0, 500.0, english, english)
+		assert WatpropPy.t_ps(1000.0, entropy, english, english) == pytest.approx(500.0, rel=tol)
+
+	def test_Case4(self):
+		# round-off beyond the upper temperature limits is not out of bounds
+		for row in [[0.5, 2000.0], [30.0, 2000.0], [80.0, 800.0]]:
+			entropy = WatpropPy.s_pt(row[0], row[1], si, si)*(1+1e-12)
+			assert WatpropPy.t_ps(row[0], entropy, si, si) == pytest.approx(row[1], rel=tol)
+
+#=============================================================
+class TestStatePS():
+	def test_Case0(self):
+		# specific enthalpy and volume agree with the functions of (p,T)
+		for row in pt_data:
+			temperature = row[1]-273.15
+			entropy = WatpropPy.s_pt(row[0], temperature, si, si)
+			assert WatpropPy.h_ps(row[0], entropy, si, si) == pytest.approx(WatpropPy.h_pt(row[0], temperature, si, si), rel=tol)
+			assert WatpropPy.v_ps(row[0], entropy, si, si) == pytest.approx(WatpropPy.v_pt(row[0], temperature, si, si), rel=tol)
+
+	def test_Case1(self):
+		# two-phase mixtures in Regions 4 and 3 are interpolated by quality
+		for pressure in (1.0, 20.0):
+			sf = WatpropPy.sf_p(pressure, si, si)
+			sg = WatpropPy.sg_p(pressure, si, si)
+			entropy = sf + 0.25*(sg-sf)
+			hf = WatpropPy.hf_p(pressure, si, si)
+			hg = WatpropPy.hg_p(pressure, si, si)
+			vf = WatpropPy.vf_p(pressure, si, si)
+			vg = WatpropPy.vg_p(pressure, si, si)
+			assert WatpropPy.h_ps(pressure, entropy, si, si) == pytest.approx(hf + 0.25*(hg-hf), rel=tol)
+			assert WatpropPy.v_ps(pressure, entropy, si, si) == pytest.approx(vf + 0.25*(vg-vf), rel=tol)
+
+	def test_Case2(self):
+		# statepoints outside the range of the equations are errors
+		with pytest.raises(ValueError, match='pressure out of bounds'):
+			WatpropPy.t_ps(101.0, 5.0, si, si)
+		with pytest.raises(ValueError, match='entropy out of bounds'):
+			WatpropPy.h_ps(1.0, -1.0, si, si)
+		with pytest.raises(ValueError, match='entropy out of bounds'):
+			WatpropPy.v_ps(60.0, 11.0, si, si)
+
+#=============================================================
+class TestHS():
+	def test_Case0(self):
+		# pressure and temperature are recovered from the enthalpy and entropy in every region
+		for row in pt_data:
+			temperature = row[1]-273.15
+			enthalpy = WatpropPy.h_pt(row[0], temperature, si, si)
+			entropy = WatpropPy.s_pt(row[0], temperature, si, si)
+			assert WatpropPy.p_hs(enthalpy, entropy, si, si) == pytest.approx(row[0], rel=tol)
+			assert WatpropPy.t_hs(enthalpy, entropy, si, si) == pytest.approx(temperature, rel=tol)
+
+	def test_Case1(self):
+		# a two-phase mixture
+		sf = WatpropPy.sf_p(1.0, si, si)
+		sg = WatpropPy.sg_p(1.0, si, si)
+		hf = WatpropPy.hf_p(1.0, si, si)
+		hg = WatpropPy.hg_p(1.0, si, si)
+		assert WatpropPy.p_hs((hf+hg)/2, (sf+sg)/2, si, si) == pytest.approx(1.0, rel=tol)
+		assert WatpropPy.t_hs((hf+hg)/2, (sf+sg)/2, si, si) == pytest.approx(WatpropPy.t_p(1.0, si, si), rel=tol)
+
+	def test_Case2(self):
+		# English units
+		enthalpy = WatpropPy.h_pt(1000.0, 500.0, english, english)
+		entropy = WatpropPy.s_pt(1000.0, 500.0, english, english)
+		assert WatpropPy.p_hs(enthalpy, entropy, english, english) == pytest.approx(1000.0, rel=tol)
+		assert WatpropPy.t_hs(enthalpy, entropy, english, english) == pytest.approx(500.0, rel=tol)
+
+	def test_Case3(self):
+		# no pressure from the triple point to 100 MPa gives the enthalpy at this entropy
+		with pytest.raises(ValueError, match='enthalpy out of bounds'):
+			WatpropPy.p_hs(100.0, 0.5, si, si)
+		with pytest.raises(ValueError, match='enthalpy out of bounds'):
+			WatpropPy.t_hs(5000.0, 1.0, si, si)
+
+	def test_Case4(self):
+		# a wet state on the liquid side of the dome, and a Region 5 state left to the search
+		sf = WatpropPy.sf_p(10.0, si, si)
+		sg = WatpropPy.sg_p(10.0, si, si)
+		hf = WatpropPy.hf_p(10.0, si, si)
+		hg = WatpropPy.hg_p(10.0, si, si)
+		enthalpy = hf + 0.2*(hg-hf)
+		entropy = sf + 0.2*(sg-sf)
+		assert WatpropPy.p_hs(enthalpy, entropy, si, si) == pytest.approx(10.0, rel=tol)
+		assert WatpropPy.t_hs(enthalpy, entropy, si, si) == pytest.approx(WatpropPy.t_p(10.0, si, si), rel=tol)
+		enthalpy = WatpropPy.h_pt(10.0, 1500.0, si, si)
+		entropy = WatpropPy.s_pt(10.0, 1500.0, si, si)
+		assert WatpropPy.p_hs(enthalpy, entropy, si, si) == pytest.approx(10.0, rel=tol)
+		assert WatpropPy.t_hs(enthalpy, entropy, si, si) == pytest.approx(1500.0, rel=tol)
+
+#=============================================================
+class TestArrayPS():
+	def test_Case0(self):
+		# the array versions agree with the scalar ones
+		p = numpy.array([row[0] for row in pt_data])
+		t = numpy.array([row[1]-273.15 for row in pt_data])
+		s = WatpropPy.s_pt_array(p, t, si, si)
+		h = WatpropPy.h_pt_array(p, t, si, si)
+		numpy.testing.assert_allclose(WatpropPy.t_ps_array(p, s, si, si, threads=2), t, rtol=tol)
+		numpy.testing.assert_allclose(WatpropPy.h_ps_array(p, s, si, si), h, rtol=tol)
+		numpy.testing.assert_allclose(WatpropPy.v_ps_array(p, s, si, si), WatpropPy.v_pt_array(p, t, si, si), rtol=tol)
+		numpy.testing.assert_allclose(WatpropPy.p_hs_array(h, s, si, si, threads=2), p, rtol=tol)
+		numpy.testing.assert_allclose(WatpropPy.t_hs_array(h, s, si, si), t, rtol=tol)
+
+	def test_Case1(self):
+		# statepoints that fail are NaN
+		t = WatpropPy.t_ps_array(numpy.array([1.0, 200.0]), numpy.array([6.0, 6.0]), si, si, errors='nan')
+		assert t[0] == pytest.approx(WatpropPy.t_ps(1.0, 6.0, si, si))
+		assert numpy.isnan(t[1])
+		with pytest.raises(ValueError, match='pressure out of bounds'):
+			WatpropPy.t_ps_array(numpy.array([1.0, 200.0]), numpy.array([6.0, 6.0]), si, si)
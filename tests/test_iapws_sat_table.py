@@ -0,0 +1,73 @@
+# test WatpropPy with the saturation table selected
+import pytest
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+english = WatpropPy.units.english
+exact = WatpropPy.saturation_method.exact
+table = WatpropPy.saturation_method.table
+
+functions_t = {'hf': WatpropPy.hf_t, 'hg': WatpropPy.hg_t, 'sf': WatpropPy.sf_t,
+	'sg': WatpropPy.sg_t, 'vf': WatpropPy.vf_t, 'vg': WatpropPy.vg_t}
+functions_p = {'hf': WatpropPy.hf_p, 'hg': WatpropPy.hg_p, 'sf': WatpropPy.sf_p,
+	'sg': WatpropPy.sg_p, 'vf': WatpropPy.vf_p, 'vg': WatpropPy.vg_p}
+
+# saturation temperatures, deg-C, spanning both parts of the table and the exact range near the critical point
+temperatures = [0.0, 0.01, 1.234, 25.0, 99.974, 150.5, 212.3, 300.0, 349.99, 350.0, 350.01, 360.1, 371.0, 373.0, 373.9]
+# saturation pressures, MPa
+pressures = [0.000611213, 0.001, 0.101325, 1.0, 7.5, 16.5292, 17.0, 20.0, 21.5, 22.0]
+
+def difference(name, value, expected):
+	# the error in the specific volumes is relative
+	if name[0] == 'v':
+		return abs(value/expected - 1)
+	return abs(value - expected)
+
+#=============================================================
+class TestSaturationTable():
+	def test_Case0(self):
+		# exact calculation is the default
+		assert WatpropPy.get_settings()['saturation'] == exact
+
+	def test_Case1(self):
+		# the error bounds are small
+		errors = WatpropPy.saturation_table_error()
+		assert sorted(errors) == sorted(functions_t)
+		for name in ['hf', 'hg']:
+			assert 0 < errors[name] < 1e-4
+		for name in ['sf', 'sg', 'vf', 'vg']:
+			assert 0 < errors[name] < 1e-6
+
+	def test_Case2(self):
+		# functions of temperature agree with the exact calculation within the error bounds
+		errors = WatpropPy.saturation_table_error()
+		for name, f in functions_t.items():
+			for t in temperatures:
+				expected = f(t, si, si)
+				with WatpropPy.settings(saturation=table):
+					assert difference(name, f(t, si, si), expected) <= errors[name]
+
+	def test_Case3(self):
+		# functions of pressure agree with the exact calculation within the error bounds
+		errors = WatpropPy.saturation_table_error()
+		for name, f in functions_p.items():
+			for p in pressures:
+				expected = f(p, si, si)
+				with WatpropPy.settings(saturation=table):
+					assert difference(name, f(p, si, si), expected) <= errors[name]
+
+	def test_Case4(self):
+		# unit conversion is unchanged
+		with WatpropPy.settings(saturation=table):
+			assert WatpropPy.hf_t(212.0, english, english) == pytest.approx(WatpropPy.hf_t(100.0, si, si) / 2.326, rel=1e-6)
+
+	def test_Case5(self):
+		# out of range temperatures are still rejected
+		with WatpropPy.settings(saturation=table):
+			with pytest.raises(ValueError):
+				WatpropPy.hf_t(-1.0, si, si)
+			with pytest.raises(ValueError):
+				WatpropPy.vg_t(374.0, si, si)
@@ -0,0 +1,129 @@
+# test WatpropPy solver options
+import os
+import subprocess
+import sys
+
+import pytest
+import numpy
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+newton = WatpropPy.density_solver.newton
+legacy = WatpropPy.density_solver.legacy
+
+#       pressure,     deg-K     (IAPWS Region 3)
+data = [
+	[0.255837018E+02, 650.0],
+	[0.222930643E+02, 650.0],
+	[0.783095639E+02, 750.0],
+	[22.1,     647.1],
+	[17.0,     628.15],
+	[40.0,     820.0]]
+
+#=============================================================
+class TestSettings():
+	def test_Case0(self):
+		# the Newton density solver is the default
+		assert WatpropPy.get_settings()['density_solver'] == newton
+
+	def test_Case1(self):
+		# the context manager restores the previous options on exit
+		with WatpropPy.settings(density_solver=legacy):
+			assert WatpropPy.get_settings()['density_solver'] == legacy
+		assert WatpropPy.get_settings()['density_solver'] == newton
+
+	def test_Case2(self):
+		# set_settings returns the previous options
+		previous = WatpropPy.set_settings(density_solver=legacy)
+		try:
+			assert previous['density_solver'] == newton
+		finally:
+			WatpropPy.set_settings(**previous)
+		assert WatpropPy.get_settings() == previous
+
+	def test_Case3(self):
+		with pytest.raises(TypeError):
+			WatpropPy.set_settings(no_such_option=1)
+
+	def test_Case4(self):
+		# the Newton and Brent density solvers agree in Region 3
+		for row in data:
+			t = row[1] - 273.15
+			with WatpropPy.settings(density_solver=legacy):
+				expected = WatpropPy.v_pt(row[0], t, si, si)
+			assert WatpropPy.v_pt(row[0], t, si, si) == pytest.approx(expected, rel=1e-12)
+
+	def test_Case5(self):
+		# IAPWS-IF97 verification values of the specific volume in Region 3
+		for solver in (newton, legacy):
+			with WatpropPy.settings(density_solver=solver):
+				assert WatpropPy.v_pt(0.255837018E+02, 650.0-273.15, si, si) == pytest.approx(1/500, rel=1e-7)
+				assert WatpropPy.v_pt(0.222930643E+02, 650.0-273.15, si, si) == pytest.approx(1/200, rel=1e-7)
+				assert WatpropPy.v_pt(0.783095639E+02, 750.0-273.15, si, si) == pytest.approx(1/500, rel=1e-7)
+
+	def test_Case6(self):
+		# by default the solvers iterate to machine precision with no iteration limit
+		assert WatpropPy.get_settings()['relative_tolerance'] == 0
+		assert WatpropPy.get_settings()['max_iterations'] == 0
+
+	def test_Case7(self):
+		# a looser relative tolerance trades accuracy for fewer iterations
+		for p, h in ((3.0, 500.0), (0.01, 3000.0), (25.0, 2000.0), (80.0, 2500.0)):
+			exact = WatpropPy.t_ph(p, h, si, si) + 273.15
+			with WatpropPy.settings(relative_tolerance=1e-8):
+				loose = WatpropPy.t_ph(p, h, si, si) + 273.15
+				assert WatpropPy.t_ph_array([p], [h], si, si)[0] + 273.15 == loose
+			assert loose == pytest.approx(exact, rel=1e-8)
+		for row in data:
+			t = row[1] - 273.15
+			for solver in (newton, legacy):
+				with WatpropPy.settings(density_solver=solver):
+					exact = WatpropPy.v_pt(row[0], t, si, si)
+				with WatpropPy.settings(relative_tolerance=1e-8, density_solver=solver):
+					assert WatpropPy.v_pt(row[0], t, si, si) == pytest.approx(exact, rel=1e-7)
+
+	def test_Case8(self):
+		# a search that reaches the iteration limit fails rather than returning a poor estimate
+		with WatpropPy.settings(max_iterations=2):
+			with pytest.raises(ValueError) as excinfo:
+				WatpropPy.t_ph(3.0, 500.0, si, si)
+			assert "did not converge" in str(excinfo.value)
+			assert numpy.isnan(WatpropPy.t_ph_array([3.0], [500.0], si, si, errors='nan')[0])
+		# a generous limit leaves converging searches untouched
+		exact = WatpropPy.t_ph(3.0, 500.0, si, si)
+		with WatpropPy.settings(max_iterations=100):
+			assert WatpropPy.t_ph(3.0, 500.0, si, si) == exact
+
+	def test_Case9(self):
+		with pytest.raises(ValueError):
+			WatpropPy.set_settings(relative_tolerance=-1e-10)
+		with pytest.raises(ValueError):
+			WatpropPy.set_settings(max_iterations=-1)
+
+	def test_Case10(self):
+		# the shared tables are built with the default options whatever the options of the
+		# thread that builds them, so build them first under loose ones in a fresh process
+		script = (
+			"import WatpropPy\n"
+			"legacy = WatpropPy.density_solver.legacy\n"
+			"with WatpropPy.settings(relative_tolerance=1e-3, max_iterations=3, density_solver=legacy):\n"
+			"\tsat = WatpropPy.saturation_table_error()\n"
+			"\tph = WatpropPy.ph_table_error()\n"
+			"\tprint(sat['hf'], sat['hg'], sat['vf'], sat['vg'], ph['t'], ph['v'], ph['s'])\n")
+		path = os.path.dirname(os.path.abspath(WatpropPy.__file__))
+		env = dict(os.environ, PYTHONPATH=os.pathsep.join([path, os.environ.get('PYTHONPATH', '')]))
+		result = subprocess.run([sys.executable, '-c', script], env=env, capture_output=True, text=True)
+		assert result.returncode == 0, result.stderr
+		hf, hg, vf, vg, t, v, s = [float(x) for x in result.stdout.split()]
+		sat = WatpropPy.saturation_table_error()
+		ph = WatpropPy.ph_table_error()
+		assert hf == pytest.approx(sat['hf'], rel=1e-6) and hf < 1e-4
+		assert hg == pytest.approx(sat['hg'], rel=1e-6) and hg < 1e-4
+		assert vf == pytest.approx(sat['vf'], rel=1e-6)
+		assert vg == pytest.approx(sat['vg'], rel=1e-6)
+		assert t == pytest.approx(ph['t'], rel=1e-6)
+		assert v == pytest.approx(ph['v'], rel=1e-6)
+		assert s == pytest.approx(ph['s'], rel=1e-6)
@@ -0,0 +1,67 @@
+# test WatpropPy state_pt against the individual property functions
+import math
+import pytest
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+english = WatpropPy.units.english
+
+tol = 1e-12
+#       pressure,     deg-K
+data = [
+	[3.0,      300.0],
+	[80.0,     300.0],
+	[3.0,      500.0],
+	[0.0035,   300.0],
+	[0.0035,   700.0],
+	[30.0,     700.0],
+	[0.255837018E+02, 650.0],
+	[0.222930643E+02, 650.0],
+	[0.783095639E+02, 750.0],
+	[0.5,      1000.0]]
+
+functions = {'h': WatpropPy.h_pt, 's': WatpropPy.s_pt, 'v': WatpropPy.v_pt, 'cp': WatpropPy.cp_pt,
+	'w': WatpropPy.w_pt, 'vis': WatpropPy.vis_pt, 'k': WatpropPy.k_pt}
+
+def check_state(pressure, temperature, iunits, ounits):
+	state = WatpropPy.state_pt(pressure, temperature, iunits, ounits)
+	for name, function in functions.items():
+		assert state[name] == pytest.approx(function(pressure, temperature, iunits, ounits), rel=tol)
+
+#=============================================================
+class TestStatePT():
+	def test_Case0(self):
+		for row in data:
+			check_state(row[0], row[1]-273.15, si, si)
+
+	def test_Case1(self):
+		for row in data:
+			check_state(row[0]*145.0377, (row[1]-273.15)*1.8+32, english, english)
+
+	def test_Case2(self):
+		# IAPWS-IF97 verification value of the isochoric heat capacity in Region 1
+		state = WatpropPy.state_pt(3.0, 300.0-273.15, si, si)
+		assert state['cv'] == pytest.approx(0.412120160E+01, rel=1e-7)
+
+	def test_Case3(self):
+		# transport properties are not available above 1173.15 K
+		state = WatpropPy.state_pt(30.0, 1500.0-273.15, si, si)
+		assert state['h'] == pytest.approx(0.516723514E+04, rel=1e-7)
+		assert math.isnan(state['vis'])
+		assert math.isnan(state['k'])
+
+	def test_Case4(self):
+		with pytest.raises(ValueError) as excinfo:
+			WatpropPy.state_pt(100.1, 20, si, si)
+		assert "pressure out of bounds" in str(excinfo.value)
+
+	def test_Case5(self):
+		pressure = [row[0] for row in data]
+		temperature = [row[1]-273.15 for row in data]
+		states = WatpropPy.state_pt_array(pressure, temperature, si, si)
+		for i in range(len(data)):
+			assert states['h'][i] == pytest.approx(WatpropPy.h_pt(pressure[i], temperature[i], si, si), rel=tol)
+			assert states['cv'][i] == pytest.approx(WatpropPy.state_pt(pressure[i], temperature[i], si, si)['cv'], rel=tol)
@@ -0,0 +1,103 @@
+# test WatpropPy with a (p,T) property table in use
+import pytest
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+si = WatpropPy.units.si
+english = WatpropPy.units.english
+
+functions = {'h': WatpropPy.h_pt, 'v': WatpropPy.v_pt, 'cp': WatpropPy.cp_pt}
+
+# compressed liquid and superheated steam, psia and deg-F, crossing the saturation line
+box = (100.0, 2000.0, 100.0, 1000.0)
+# statepoints inside the box, away from the saturation line
+inside = [(150.0, 120.0), (500.0, 300.0), (1234.5, 450.0), (1999.0, 999.0), (200.0, 700.0), (800.0, 900.0)]
+
+def relative(value, expected):
+	return abs(value/expected - 1)
+
+@pytest.fixture(scope='module')
+def table():
+	return WatpropPy.TablePT(*box, p_intervals=100, t_intervals=100)
+
+#=============================================================
+class TestTablePT():
+	def test_Case1(self, table):
+		# the interpolation errors measured during the build are small
+		error = table.error()
+		assert error['h'] < 1e-5
+		assert error['v'] < 1e-3
+		assert error['cp'] < 1e-3
+		# some cells straddle the saturation line
+		assert table.exact_cells() > 0
+
+	@pytest.mark.parametrize('p, t', inside)
+	def test_Case2(self, table, p, t):
+		# interpolated values agree with the equations within twice the measured error
+		error = table.error()
+		expected = {name: f(p, t) for name, f in functions.items()}
+		with WatpropPy.use_table(table):
+			for name, f in functions.items():
+				assert relative(f(p, t), expected[name]) <= 2*error[name] + 1e-12
+
+	@pytest.mark.parametrize('p, t', [(50.0, 300.0), (3000.0, 500.0), (1000.0, 50.0), (1000.0, 1100.0)])
+	def test_Case3(self, table, p, t):
+		# statepoints outside the table use the equations
+		expected = {name: f(p, t) for name, f in functions.items()}
+		with WatpropPy.use_table(table):
+			for name, f in functions.items():
+				assert f(p, t) == expected[name]
+
+	def test_Case4(self, table):
+		# statepoints in cells straddling the saturation line use the equations
+		p = 1000.0
+		tsat = WatpropPy.t_p(p)
+		for t in [tsat - 0.01, tsat + 0.01]:
+			expected = {name: f(p, t) for name, f in functions.items()}
+			with WatpropPy.use_table(table):
+				for name, f in functions.items():
+					assert f(p, t) == expected[name]
+
+	def test_Case5(self, table):
+		# the table is only used within the block, and blocks nest
+		p, t = inside[2]
+		expected = WatpropPy.h_pt(p, t)
+		other = WatpropPy.TablePT(1000.0, 1500.0, 400.0, 500.0, p_intervals=2, t_intervals=2)
+		with WatpropPy.use_table(table):
+			fine = WatpropPy.h_pt(p, t)
+			with WatpropPy.use_table(other):
+				coarse = WatpropPy.h_pt(p, t)
+			assert WatpropPy.h_pt(p, t) == fine
+		assert WatpropPy.h_pt(p, t) == expected
+		assert fine != expected
+		assert coarse != fine
+
+	def test_Case6(self):
+		# the table is restored when the block raises
+		table = WatpropPy.TablePT(*box, p_intervals=10, t_intervals=10)
+		p, t = inside[1]
+		expected = WatpropPy.v_pt(p, t)
+		with pytest.raises(RuntimeError):
+			with WatpropPy.use_table(table):
+				raise RuntimeError
+		assert WatpropPy.v_pt(p, t) == expected
+
+	def test_Case7(self):
+		# tables in SI units: MPa and deg-C
+		table = WatpropPy.TablePT(1.0, 10.0, 20.0, 150.0, p_intervals=20, t_intervals=20, iunits=si)
+		assert table.exact_cells() == 0
+		error = table.error()
+		for p, t in [(1.5, 25.0), (5.0, 100.0), (9.9, 149.0)]:
+			expected = {name: f(p, t, si) for name, f in functions.items()}
+			with WatpropPy.use_table(table):
+				for name, f in functions.items():
+					assert relative(f(p, t, si), expected[name]) <= 2*error[name] + 1e-12
+
+	@pytest.mark.parametrize('args', [(2000.0, 100.0, 100.0, 1000.0), (100.0, 2000.0, 100.0, 1000.0, 0, 10),
+		(100.0, 2000.0, 10.0, 1000.0), (100.0, 2000.0, 100.0, 5000.0)])
+	def test_Case8(self, args):
+		# invalid ranges are rejected
+		with pytest.raises(ValueError):
+			WatpropPy.TablePT(*args)
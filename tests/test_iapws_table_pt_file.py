@@ -0,0 +1,107 @@
+# test WatpropPy with (p,T) property tables saved to and mapped from files
+import os
+import struct
+import pytest
+
+import WatpropPy
+
+pytestmark = pytest.mark.basic
+
+functions = {'h': WatpropPy.h_pt, 'v': WatpropPy.v_pt, 'cp': WatpropPy.cp_pt}
+
+# compressed liquid and superheated steam, psia and deg-F, crossing the saturation line
+box = (100.0, 2000.0, 100.0, 1000.0)
+# valid both in psia and deg-F and in MPa and deg-C
+small = (1.0, 10.0, 150.0, 300.0)
+points = [(150.0, 120.0), (500.0, 300.0), (1234.5, 450.0), (1999.0, 999.0), (200.0, 700.0), (800.0, 900.0), (300.0, 417.0)]
+
+def values(table):
+	with WatpropPy.use_table(table):
+		return [{name: f(p, t) for name, f in functions.items()} for p, t in points]
+
+@pytest.fixture
+def path(tmp_path):
+	return tmp_path / 'table_pt.bin'
+
+#=============================================================
+class TestTablePTFile():
+	def test_Case1(self, path):
+		# the first table is built and saved, the second is mapped from the file
+		built = WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path)
+		assert not built.mapped
+		assert path.exists()
+		mapped = WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path)
+		assert mapped.mapped
+		assert mapped.error() == built.error()
+		assert mapped.exact_cells() == built.exact_cells()
+		# the mapped table interpolates exactly as the built one
+		assert values(mapped) == values(built)
+
+	def test_Case2(self, path):
+		# the cells are page aligned in the file
+		WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30).save(str(path))
+		# each cell is a flag, padded to 8 bytes, and 16 coefficients for each of 3 properties
+		cells = 40*30*(8 + 3*16*8)
+		assert (os.path.getsize(path) - cells) % 4096 == 0
+		assert WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=str(path)).mapped
+
+	@pytest.mark.parametrize('arguments', [
+		dict(p_intervals=41, t_intervals=30),
+		dict(p_intervals=40, t_intervals=31),
+		dict(p_intervals=40, t_intervals=30, iunits=WatpropPy.units.si),
+	])
+	def test_Case3(self, path, arguments):
+		# a file for a different grid or units is refused and replaced
+		WatpropPy.TablePT(*small, p_intervals=40, t_intervals=30, path=path)
+		table = WatpropPy.TablePT(*small, **arguments, path=path)
+		assert not table.mapped
+		assert WatpropPy.TablePT(*small, **arguments, path=path).mapped
+
+	def test_Case4(self, path):
+		# a file for a different rectangle is refused
+		WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path)
+		assert not WatpropPy.TablePT(100.0, 2000.0, 100.0, 999.0, p_intervals=40, t_intervals=30, path=path).mapped
+
+	def test_Case5(self, path):
+		# a corrupted or truncated file is refused by its checksum
+		WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path)
+		data = bytearray(path.read_bytes())
+		data[-100] ^= 0x01
+		path.write_bytes(bytes(data))
+		assert not WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path).mapped
+		path.write_bytes(bytes(data[:-8]))
+		assert not WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path).mapped
+
+	def test_Case6(self, path):
+		# a file from another library version is refused
+		WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path)
+		data = bytearray(path.read_bytes())
+		version = data.index(b'WatpropPy')
+		data[version] ^= 0x20
+		path.write_bytes(bytes(data))
+		assert not WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path).mapped
+
+	def test_Case7(self, tmp_path):
+		# a file that cannot be written raises OSError
+		table = WatpropPy.TablePT(*box, p_intervals=10, t_intervals=10)
+		with pytest.raises(OSError):
+			table.save(tmp_path / 'missing' / 'table_pt.bin')
+
+	def test_Case8(self, path):
+		# a header whose cell offset would wrap around past the end of the file is refused
+		WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path)
+		data = bytearray(path.read_bytes())
+		# cells_offset follows the 160 bytes of the header before it
+		offset, size = struct.unpack_from('=QQ', data, 160)
+		assert offset % 4096 == 0 and size == 40*30*(8 + 3*16*8)
+		struct.pack_into('=Q', data, 160, 2**64 - offset)
+		path.write_bytes(bytes(data))
+		assert not WatpropPy.TablePT(*box, p_intervals=40, t_intervals=30, path=path).mapped
+
+	def test_Case9(self, tmp_path):
+		# a table that cannot be saved to its path is still built
+		path = tmp_path / 'missing' / 'table_pt.bin'
+		table = WatpropPy.TablePT(*box, p_intervals=10, t_intervals=10, path=path)
+		assert not table.mapped
+		assert not path.exists()
+		assert values(table) == values(WatpropPy.TablePT(*box, p_intervals=10, t_intervals=10))
@@ -26,6 +26,9 @@
  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#ifndef UTILITIES_H
+#define UTILITIES_H
+
 #include<cctype>
 #include<string>
 
@@ -39,8 +42,88 @@
 //#define ENGLISH 1
 
 double interpolate(const double x[], const double y[], int size, double given);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief state of one search for a root by Brent's method
+///
+/// This is a modified version of "zeroin" from NETLIB, split into steps so that
+/// the function under investigation can be evaluated by the caller, either for one
+/// root at a time (zeroin) or for many roots in lock step (zeroin_batch).
+///
+/// Algorithm
+///	G.Forsythe, M.Malcolm, C.Moler, Computer methods for mathematical
+///	computations. M., Mir, 1980, p.180 of the Russian edition
+///
+///	The function makes use of the bissection procedure combined with
+///	the linear or quadric inverse interpolation.
+///	At every step program operates on three abscissae - a, b, and c.
+///	b - the last and the best approximation to the root
+///	a - the last but one approximation
+///	c - the last but one or even earlier approximation than a that
+///		1) |f(b)| <= |f(c)|
+///		2) f(b) and f(c) have opposite signs, i.e. b and c confine
+///		   the root
+///	At every step the search selects one of the two new approximations, the
+///	former being obtained by the bissection procedure and the latter
+///	resulting in the interpolation (if a,b, and c are all different
+///	the quadric interpolation is utilized, otherwise the linear one).
+///	If the latter (i.e. obtained by the interpolation) point is
+///	reasonable (i.e. lies within the current interval [b,c] not being
+/// too close to the boundaries) it is accepted. The bissection result
+///	is used in the other case. Therefore, the range of uncertainty is
+///	ensured to be reduced at least by the factor 1.6
+///////////////////////////////////////////////////////////////////////////////
+struct BrentState {
+  double a,b,c;				/* Abscissae, descr. see above	*/
+  double fa;				/* f(a)				*/
+  double fb;				/* f(b)				*/
+  double fc;				/* f(c)				*/
+};
+
+bool brent_start(BrentState &s, double ax, double fa, double bx, double fb);
+bool brent_advance(BrentState &s, double tol, double rtol);
+void brent_update(BrentState &s, double fb);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds root of [f(x) - target] using Brent's method
+///
+/// f may be any callable, such as a lambda that fixes the other arguments of a
+/// property function, so that the compiler can inline it into the iteration.
+///
+/// \param[in] f function under investigation
+/// \param[in] ax lower end of range that must contain the root
+/// \param[in] bx upper end of the range that must contain the root
+/// \param[in] target value of f(x) corresponding to the desired root
+/// \param[in] tol acceptable tolerance
+/// \param[in] rtol acceptable tolerance relative to the root
+/// \param[in] max_iterations largest number of iterations, or 0 for no limit
+///
+/// \return value an estimate for the root with accuracy (4*EPSILON + rtol)*abs(x) + tol
+///
+/// \exception char const* the range does not contain a root, or the search did not
+///  converge within max_iterations
+///////////////////////////////////////////////////////////////////////////////
+template <class Function>
+double zeroin(const Function &f, double ax, double bx, double target, double tol, double rtol = 0, int max_iterations = 0)
+{
+	BrentState s;
+	double fa = f(ax) - target;
+	double fb = f(bx) - target;
+	if (!brent_start(s, ax, fa, bx, fb))
+		throw "error in brent root routine";
+	for (int iteration=0; !brent_advance(s, tol, rtol); iteration++) {
+		if ((max_iterations > 0) && (iteration >= max_iterations))
+			throw "brent root routine did not converge";
+		brent_update(s, f(s.b) - target);
+	}
+	return s.b;
+}
+
 double zeroin1(double (*f)(double, double), double dummy, double ax, double bx, double target, double tol);	
 double zeroin2(double (*f)(double, double), double dummy, double ax, double bx, double target, double tol);	
+long zeroin_batch(void (*f)(const double[], const double[], double[], long), const double dummy[], const double ax[], const double bx[], const double target[], double tol, double rtol, int max_iterations, double root[], long count, int iterations[] = 0);
+bool newton2(void (*f)(double, double, double &, double &), double dummy, double ax, double bx, double target, double &x, int *iterations = 0);
+double power_series(const int I[], const int J[], const double n[], int count, double x, double y);
 
 //int check_input_units(std::string units);
 //int check_output_units(std::string units);
@@ -77,3 +160,5 @@ double convert_vis_english_to_si(double vis);
 
 double convert_k_si_to_english(double k);
 double convert_k_english_to_si(double k);
+
+#endif // UTILITIES_H
@@ -30,6 +30,8 @@
 */
 
 #include <math.h>
+#include <cmath>
+#include <limits>
 #include <string>
 #include "wat.h"
 #include "utilities.h"
@@ -93,6 +95,128 @@ static LPWSTR rgFuncs[rgFuncsRows][rgFuncsCols] = {
 };
 */
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief describes the reason that a property cannot be calculated
+///
+/// \param[in] status reason
+/// \param[in] function name of the steam table function
+///
+/// \return error message
+///////////////////////////////////////////////////////////////////////////////
+std::string status_message(Status status, const char *function)
+{
+	switch (status) {
+		case STATUS_OK:
+			return "no error";
+		case STATUS_PRESSURE:
+			return "pressure out of bounds";
+		case STATUS_TEMPERATURE:
+			return "temperature out of bounds";
+		case STATUS_PRESSURE_TEMPERATURE:
+			return "pressure/temperature combination out of bounds";
+		case STATUS_ENTHALPY:
+			return "enthalpy out of bounds";
+		case STATUS_INVALID_PRESSURE:
+			return std::string("invalid pressure in ") + function;
+		case STATUS_INVALID_TEMPERATURE:
+			return std::string("invalid temperature in ") + function;
+		case STATUS_VISCOSITY:
+			return "shear viscosity calculation is not valid in portions of Region 5";
+		case STATUS_REGION:
+			return std::string("invalid region number in ") + function;
+		case STATUS_INPUT_PRESSURE:
+			return "input pressure out of bounds";
+		case STATUS_INPUT_TEMPERATURE:
+			return "input temperature out of bounds";
+		case STATUS_ENTROPY:
+			return "entropy out of bounds";
+		default:
+			return std::string("calculation failed in ") + function;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calls a property calculation and raises an exception if it fails
+///
+/// The call and its errors are counted by the call metrics (see FUNCTION_METRICS).
+///
+/// \param[in] value property calculation
+/// \param[in] function steam table function, for error messages and the call metrics
+/// \param[in] args arguments of the property calculation
+///
+/// \return property
+///
+/// \exception std::invalid_argument the statepoint is invalid or an iterative
+///  calculation failed
+///////////////////////////////////////////////////////////////////////////////
+template <class Result, class Value, class... Args>
+static Result checked(Value value, SteamFunction function, Args... args)
+{
+	MetricTimer timer(function, false);
+	try {
+		Result result;
+		Status status = value(args..., result);
+		if (status != STATUS_OK) {
+			std::string message = status_message(status, FUNCTION_NAME(function));
+			timer.error(message);
+			throw std::invalid_argument(message);
+		}
+		return result;
+	}
+	catch(char const* chowder) {
+		// rethrow the original error message as std::invalid_argument
+		timer.error(chowder);
+		throw std::invalid_argument(chowder);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief sets a property to NaN
+///
+/// \param[out] value property
+///////////////////////////////////////////////////////////////////////////////
+static void set_nan(double &value)
+{
+	value = NAN;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief sets all of the properties at a statepoint to NaN
+///
+/// \param[out] state properties
+///////////////////////////////////////////////////////////////////////////////
+static void set_nan(StatePT &state)
+{
+	state.h = state.s = state.v = state.cp = state.cv = state.w = state.vis = state.k = NAN;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calls a property calculation without letting an exception escape
+///
+/// Invalid statepoints are reported by the property calculations without raising
+/// an exception; only the rare failure of an iterative calculation is caught here.
+///
+/// \param[in] value property calculation
+/// \param[out] result property, or NaN if it cannot be calculated
+/// \param[in] args arguments of the property calculation
+///
+/// \return STATUS_OK, or the reason that the result is NaN
+///////////////////////////////////////////////////////////////////////////////
+template <class Result, class Value, class... Args>
+static Status guarded(Value value, Result &result, Args... args)
+{
+	Status status;
+	try {
+		status = value(args..., result);
+	}
+	catch(...) {
+		status = STATUS_FAILED;
+	}
+	if (status != STATUS_OK)
+		set_nan(result);
+	return status;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief returns the version number for the WATPROP library
 ///
@@ -110,23 +234,29 @@ static LPWSTR rgFuncs[rgFuncsRows][rgFuncsCols] = {
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy
 ///
-/// \return specific enthalpy
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 H_PT(double p, double t, Units input_units, Units output_units)
+static Status h_pt_value(double p, double t, Units input_units, Units output_units, double &h)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// interpolate in the active property table when it covers this statepoint
+	if (!table_pt_value(TABLE_H, p, t, h)) {
 		// check for region
-		int region = region_pt(p,t);
+		int region = 0;
+		Status status = region_pt_status(p, t, region);
+		if (status != STATUS_OK)
+			return status;
 		// call region function for h
-		double h = 0;
 		double v = 0;
 		double d = 0;
 		switch (region) {
@@ -144,18 +274,47 @@ static LPWSTR rgFuncs[rgFuncsRows][rgFuncsCols] = {
 				h = h_pt_5(p,t);
 				break;
 			default:
-				throw "invalid region number in h_pt";
+				return STATUS_REGION;
 		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			h = convert_enthalpy_si_to_english(h);
-		// return
-		return h;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
 	}
+	// convert units
+	if (output_units ==  ENGLISH)
+		h = convert_enthalpy_si_to_english(h);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific enthalpy as a function of pressure and temperature
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific enthalpy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 H_PT(double p, double t, Units input_units, Units output_units)
+{
+	return checked<double>(h_pt_value, FUNCTION_H_PT, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific enthalpy as a function of pressure and temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that h is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status H_PT_STATUS(double p, double t, Units input_units, Units output_units, double *h)
+{
+	return guarded(h_pt_value, *h, p, t, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -165,23 +324,29 @@ static LPWSTR rgFuncs[rgFuncsRows][rgFuncsCols] = {
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] v specific volume
 ///
-/// \return specific volume
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 V_PT(double p, double t, Units input_units, Units output_units)
+static Status v_pt_value(double p, double t, Units input_units, Units output_units, double &v)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// interpolate in the active property table when it covers this statepoint
+	if (!table_pt_value(TABLE_V, p, t, v)) {
 		// check for region
-		int region = region_pt(p,t);
+		int region = 0;
+		Status status = region_pt_status(p, t, region);
+		if (status != STATUS_OK)
+			return status;
 		// call region function for v (or d)
-		double v = 0;
 		switch (region) {
 			case 1:
 				v = v_pt_1(p,t);
@@ -196,1130 +361,2422 @@ static LPWSTR rgFuncs[rgFuncsRows][rgFuncsCols] = {
 				v = v_pt_5(p,t);
 				break;
 			default:
-				throw "invalid region number in v_pt";
+				return STATUS_REGION;
 		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			v = convert_spvolume_si_to_english(v);
-		return v;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
 	}
+	// convert units
+	if (output_units ==  ENGLISH)
+		v = convert_spvolume_si_to_english(v);
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates speed of sound as a function of pressure and temperature
+/// \brief calculates specific volume as a function of pressure and temperature
 ///
 /// \param[in] p pressure
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
 ///
-/// \return speed of sound
+/// \return specific volume
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 W_PT(double p, double t, Units input_units, Units output_units)
+ LPXLOPER12 V_PT(double p, double t, Units input_units, Units output_units)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// check for region
-		int region = region_pt(p,t);
-		// call region function for w
-		double v = 0;
-		double w = 0;
-		double d = 0;
-		switch (region) {
-			case 1:
-				w = w_pt_1(p,t);
-				break;
-			case 2:
-				w = w_pt_2(p,t);
-				break;
-			case 3:
-				d = d_pt_3(p,t);
-				w = w_dt_3(d,t);
-				break;
-			case 5:
-				w = w_pt_5(p,t);
-				break;
-			default:
-				throw "invalid region number in w_pt";
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			w = convert_w_si_to_english(w);
-		// return
-		return w;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return checked<double>(v_pt_value, FUNCTION_V_PT, p, t, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated liquid specific enthalpy as a function of temperature
+/// \brief calculates specific volume as a function of pressure and temperature
 ///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] v specific volume, or NaN if it cannot be calculated
 ///
-/// \return specific enthalpy
+/// \return STATUS_OK, or the reason that v is NaN
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 HF_T(double t, Units input_units, Units output_units)
+ Status V_PT_STATUS(double p, double t, Units input_units, Units output_units, double *v)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// verify that saturation conditions can exist at this temperature
-		if ((t < 273.15) || (t > 647.096))
-			throw "invalid temperature in hf_t";
-		// calculate the saturation pressure
-		double p = PSAT_T(t);
-		double h = 0;
-		if (t<= 623.15) {
-			// get the enthalpy from the region 1 correlations
-			h = h_pt_1(p, t);
-		}
-		else {
-			// need to get the enthalpy from the region 3 correlations
-			double d = df_pt_3(p,t);
-			h = h_dt_3(d,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			h = convert_enthalpy_si_to_english(h);
-		// return
-		return h;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return guarded(v_pt_value, *v, p, t, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated vapor specific enthalpy as a function of temperature
+/// \brief calculates speed of sound as a function of pressure and temperature
 ///
+/// \param[in] p pressure
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] w speed of sound
 ///
-/// \return specific enthalpy
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 HG_T(double t, Units input_units, Units output_units)
+static Status w_pt_value(double p, double t, Units input_units, Units output_units, double &w)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// verify that saturation conditions can exist at this temperature
-		if ((t < 273.15) || (t > 647.096))
-			throw "invalid temperature in hg_t";
-		// calculate the saturation pressure
-		double p = PSAT_T(t);
-		double h = 0;
-		if (t<= 623.15) {
-			// get the enthalpy from the region 2 correlations
-			h = h_pt_2(p, t);
-		}
-		else {
-			// need to get the enthalpy from the region 3 correlations
-			double d = dv_pt_3(p,t);
-			h = h_dt_3(d,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			h = convert_enthalpy_si_to_english(h);
-		// return
-		return h;
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
 	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
+	// check for region
+	int region = 0;
+	Status status = region_pt_status(p, t, region);
+	if (status != STATUS_OK)
+		return status;
+	// call region function for w
+	double v = 0;
+	double d = 0;
+	switch (region) {
+		case 1:
+			w = w_pt_1(p,t);
+			break;
+		case 2:
+			w = w_pt_2(p,t);
+			break;
+		case 3:
+			d = d_pt_3(p,t);
+			w = w_dt_3(d,t);
+			break;
+		case 5:
+			w = w_pt_5(p,t);
+			break;
+		default:
+			return STATUS_REGION;
 	}
+	// convert units
+	if (output_units ==  ENGLISH)
+		w = convert_w_si_to_english(w);
+	// return
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated liquid specific volume as a function of temperature
+/// \brief calculates speed of sound as a function of pressure and temperature
 ///
+/// \param[in] p pressure
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
 ///
-/// \return specific volume
+/// \return speed of sound
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 VF_T(double t, Units input_units, Units output_units)
+ LPXLOPER12 W_PT(double p, double t, Units input_units, Units output_units)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// verify that saturation conditions can exist at this temperature
-		if ((t < 273.15) || (t > 647.096))
-			throw "invalid temperature in vf_t";
-		// calculate the saturation pressure
-		double p = PSAT_T(t);
-		double v = 0;
-		if (t<= 623.15) {
-			// get the enthalpy from the region 1 correlations
-			v = v_pt_1(p, t);
-		}
-		else {
-			// need to get the enthalpy from the region 3 correlations
-			v = 1 / df_pt_3(p,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			v = convert_spvolume_si_to_english(v);
-		// return
-		return v;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return checked<double>(w_pt_value, FUNCTION_W_PT, p, t, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated vapor specific volume as a function of temperature
+/// \brief calculates speed of sound as a function of pressure and temperature
+///
+/// Errors are reported as a status rather than an exception.
 ///
+/// \param[in] p pressure
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] w speed of sound, or NaN if it cannot be calculated
 ///
-/// \return specific volume
+/// \return STATUS_OK, or the reason that w is NaN
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 VG_T(double t, Units input_units, Units output_units)
+ Status W_PT_STATUS(double p, double t, Units input_units, Units output_units, double *w)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// verify that saturation conditions can exist at this temperature
-		if ((t < 273.15) || (t > 647.096))
-			throw "invalid temperature in vg_t";
-		// calculate the saturation pressure
-		double p = PSAT_T(t);
-		double v = 0;
-		if (t<= 623.15) {
-			// get the specific volume from the region 2 correlations
-			v = v_pt_2(p, t);
-		}
-		else {
-			// need to get the specific volume from the region 3 correlations
-			v = 1 / dv_pt_3(p,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			v = convert_spvolume_si_to_english(v);
-		// return
-		return v;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return guarded(w_pt_value, *w, p, t, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturation pressure as a function of temperature
+/// \brief calculates saturated liquid specific enthalpy as a function of temperature
 ///
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy
 ///
-/// \return pressure
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 P_T(double t, Units input_units, Units output_units)
+static Status hf_t_value(double t, Units input_units, Units output_units, double &h)
 {
-	try {
-		// convert the temperature to kelvin if necessary
-		if (input_units ==  ENGLISH)
-			t = convert_temp_english_to_kelvin(t);
-		else
-			t = convert_temp_centigrade_to_kelvin(t);
-		check_saturated_t(t);
-		double p = PSAT_T(t);
-		if (output_units ==  ENGLISH)
-			p = convert_pressure_si_to_english(p);
-		// return
-		return p;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
+	if (input_units ==  ENGLISH) {
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
 	}
+	// verify that saturation conditions can exist at this temperature
+	if ((t < 273.15) || (t > 647.096))
+		return STATUS_INVALID_TEMPERATURE;
+	// calculate the saturation pressure
+	double p = PSAT_T(t);
+	h = saturated_property(SAT_HF, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		h = convert_enthalpy_si_to_english(h);
+	// return
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturation temperature as a function of pressure
+/// \brief calculates saturated liquid specific enthalpy as a function of temperature
 ///
-/// \param[in] p pressure
+/// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
 ///
-/// \return temperature
+/// \return specific enthalpy
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 T_P(double p, Units input_units, Units output_units)
+ LPXLOPER12 HF_T(double t, Units input_units, Units output_units)
 {
-	try {
-		// convert the pressure to MPa if necessary
-		if (input_units ==  ENGLISH)
-			p = convert_pressure_english_to_si(p);
-		check_saturated_p(p);
-		double t = TSAT_P(p);
-		if (output_units ==  ENGLISH)
-			t=convert_temp_kelvin_to_english(t);
-		else
-			t=convert_temp_kelvin_to_centigrade(t);
-		// return
-		return t;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return checked<double>(hf_t_value, FUNCTION_HF_T, t, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates specific entropy as a function of pressure and temperature
+/// \brief calculates saturated liquid specific enthalpy as a function of temperature
+///
+/// Errors are reported as a status rather than an exception.
 ///
-/// \param[in] p pressure
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy, or NaN if it cannot be calculated
 ///
-/// \return specific entropy
+/// \return STATUS_OK, or the reason that h is NaN
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 S_PT(double p, double t, Units input_units, Units output_units)
+ Status HF_T_STATUS(double t, Units input_units, Units output_units, double *h)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// check for region
-		int region = region_pt(p,t);
-		// call region function for s
-		double v = 0;
-		double s = 0;
-		double d = 0;
-		switch (region) {
-			case 1:
-				s = s_pt_1(p,t);
-				break;
-			case 2:
-				s = s_pt_2(p,t);
-				break;
-			case 3:
-				d = d_pt_3(p,t);
-				s = s_dt_3(d,t);
-				break;
-			case 5:
-				s = s_pt_5(p,t);
-				break;
-			default:
-				throw "invalid region number in s_pt";
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			s = convert_entropy_si_to_english(s);
-		// return
-		return s;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return guarded(hf_t_value, *h, t, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates isobaric heat capacity as a function of pressure and temperature
+/// \brief calculates saturated vapor specific enthalpy as a function of temperature
 ///
-/// \param[in] p pressure
 /// \param[in] t temperature
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy
 ///
-/// \return isobaric heat capacity
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 CP_PT(double p, double t, Units input_units, Units output_units)
+static Status hg_t_value(double t, Units input_units, Units output_units, double &h)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
+	if (input_units ==  ENGLISH) {
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// verify that saturation conditions can exist at this temperature
+	if ((t < 273.15) || (t > 647.096))
+		return STATUS_INVALID_TEMPERATURE;
+	// calculate the saturation pressure
+	double p = PSAT_T(t);
+	h = saturated_property(SAT_HG, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		h = convert_enthalpy_si_to_english(h);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific enthalpy as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific enthalpy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 HG_T(double t, Units input_units, Units output_units)
+{
+	return checked<double>(hg_t_value, FUNCTION_HG_T, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific enthalpy as a function of temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that h is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status HG_T_STATUS(double t, Units input_units, Units output_units, double *h)
+{
+	return guarded(hg_t_value, *h, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific volume as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific volume
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status vf_t_value(double t, Units input_units, Units output_units, double &v)
+{
+	if (input_units ==  ENGLISH) {
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// verify that saturation conditions can exist at this temperature
+	if ((t < 273.15) || (t > 647.096))
+		return STATUS_INVALID_TEMPERATURE;
+	// calculate the saturation pressure
+	double p = PSAT_T(t);
+	v = saturated_property(SAT_VF, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		v = convert_spvolume_si_to_english(v);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific volume as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific volume
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 VF_T(double t, Units input_units, Units output_units)
+{
+	return checked<double>(vf_t_value, FUNCTION_VF_T, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific volume as a function of temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific volume, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that v is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status VF_T_STATUS(double t, Units input_units, Units output_units, double *v)
+{
+	return guarded(vf_t_value, *v, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific volume as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific volume
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status vg_t_value(double t, Units input_units, Units output_units, double &v)
+{
+	if (input_units ==  ENGLISH) {
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// verify that saturation conditions can exist at this temperature
+	if ((t < 273.15) || (t > 647.096))
+		return STATUS_INVALID_TEMPERATURE;
+	// calculate the saturation pressure
+	double p = PSAT_T(t);
+	v = saturated_property(SAT_VG, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		v = convert_spvolume_si_to_english(v);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific volume as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific volume
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 VG_T(double t, Units input_units, Units output_units)
+{
+	return checked<double>(vg_t_value, FUNCTION_VG_T, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific volume as a function of temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific volume, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that v is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status VG_T_STATUS(double t, Units input_units, Units output_units, double *v)
+{
+	return guarded(vg_t_value, *v, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturation pressure as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] p pressure
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status p_t_value(double t, Units input_units, Units output_units, double &p)
+{
+	// convert the temperature to kelvin if necessary
+	if (input_units ==  ENGLISH)
+		t = convert_temp_english_to_kelvin(t);
+	else
+		t = convert_temp_centigrade_to_kelvin(t);
+	Status status = check_saturated_t(t);
+	if (status != STATUS_OK)
+		return status;
+	p = PSAT_T(t);
+	if (output_units ==  ENGLISH)
+		p = convert_pressure_si_to_english(p);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturation pressure as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return pressure
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 P_T(double t, Units input_units, Units output_units)
+{
+	return checked<double>(p_t_value, FUNCTION_P_T, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturation pressure as a function of temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] p pressure, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that p is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status P_T_STATUS(double t, Units input_units, Units output_units, double *p)
+{
+	return guarded(p_t_value, *p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturation temperature as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] t temperature
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status t_p_value(double p, Units input_units, Units output_units, double &t)
+{
+	// convert the pressure to MPa if necessary
+	if (input_units ==  ENGLISH)
+		p = convert_pressure_english_to_si(p);
+	Status status = check_saturated_p(p);
+	if (status != STATUS_OK)
+		return status;
+	t = TSAT_P(p);
+	if (output_units ==  ENGLISH)
+		t=convert_temp_kelvin_to_english(t);
+	else
+		t=convert_temp_kelvin_to_centigrade(t);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturation temperature as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 T_P(double p, Units input_units, Units output_units)
+{
+	return checked<double>(t_p_value, FUNCTION_T_P, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturation temperature as a function of pressure
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] t temperature, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that t is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status T_P_STATUS(double p, Units input_units, Units output_units, double *t)
+{
+	return guarded(t_p_value, *t, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific entropy as a function of pressure and temperature
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific entropy
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status s_pt_value(double p, double t, Units input_units, Units output_units, double &s)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// check for region
+	int region = 0;
+	Status status = region_pt_status(p, t, region);
+	if (status != STATUS_OK)
+		return status;
+	// call region function for s
+	double v = 0;
+	double d = 0;
+	switch (region) {
+		case 1:
+			s = s_pt_1(p,t);
+			break;
+		case 2:
+			s = s_pt_2(p,t);
+			break;
+		case 3:
+			d = d_pt_3(p,t);
+			s = s_dt_3(d,t);
+			break;
+		case 5:
+			s = s_pt_5(p,t);
+			break;
+		default:
+			return STATUS_REGION;
+	}
+	// convert units
+	if (output_units ==  ENGLISH)
+		s = convert_entropy_si_to_english(s);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific entropy as a function of pressure and temperature
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific entropy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 S_PT(double p, double t, Units input_units, Units output_units)
+{
+	return checked<double>(s_pt_value, FUNCTION_S_PT, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific entropy as a function of pressure and temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific entropy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that s is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status S_PT_STATUS(double p, double t, Units input_units, Units output_units, double *s)
+{
+	return guarded(s_pt_value, *s, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates isobaric heat capacity as a function of pressure and temperature
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] cp isobaric heat capacity
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status cp_pt_value(double p, double t, Units input_units, Units output_units, double &cp)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// interpolate in the active property table when it covers this statepoint
+	if (!table_pt_value(TABLE_CP, p, t, cp)) {
 		// check for region
-		int region = region_pt(p,t);
+		int region = 0;
+		Status status = region_pt_status(p, t, region);
+		if (status != STATUS_OK)
+			return status;
 		// call region function for cp
 		double v = 0;
-		double cp = 0;
 		double d = 0;
 		switch (region) {
 			case 1:
-				cp = cp_pt_1(p,t);
+				cp = cp_pt_1(p,t);
+				break;
+			case 2:
+				cp = cp_pt_2(p,t);
+				break;
+			case 3:
+				d = d_pt_3(p,t);
+				cp = cp_dt_3(d,t);
+				break;
+			case 5:
+				cp = cp_pt_5(p,t);
+				break;
+			default:
+				return STATUS_REGION;
+		}
+	}
+	// convert units
+	if (output_units ==  ENGLISH)
+		cp = convert_cp_si_to_english(cp);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates isobaric heat capacity as a function of pressure and temperature
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return isobaric heat capacity
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 CP_PT(double p, double t, Units input_units, Units output_units)
+{
+	return checked<double>(cp_pt_value, FUNCTION_CP_PT, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates isobaric heat capacity as a function of pressure and temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] cp isobaric heat capacity, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that cp is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status CP_PT_STATUS(double p, double t, Units input_units, Units output_units, double *cp)
+{
+	return guarded(cp_pt_value, *cp, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates dynamic viscosity as a function of density and temperature
+///
+/// \param[in] d density in kg/m3
+/// \param[in] t temperature in Kelvin
+///
+/// \return dynamic viscosity in Pa*sec
+///////////////////////////////////////////////////////////////////////////////
+static double vis_dt(double d, double t)
+{
+	double t_star = 647.226;
+	double d_star = 317.763;
+	double vis_star = 55.071e-6;
+	// calculate reduced properties
+	double t_bar = t/t_star;
+	double d_bar = d/d_star;
+	// calculate part 1
+	const int PART1_COUNT = 4;
+	double h[PART1_COUNT] = {1.000000,0.978197, 0.579829,-0.202354};
+	double part1 = 0;
+	for (int i=0; i<PART1_COUNT; i++) {
+		part1 += h[i]/pow(t_bar,i);
+	}
+	part1 = pow(t_bar, 0.5)/part1;
+
+	// calculate part 2
+	const int PART2_COUNT = 19;
+	double I[PART2_COUNT] = {0,1,4,5,0,1,2,3,0,1,2,0,1,2,3,0,3,1,3};
+	double J[PART2_COUNT] = {0,0,0,0,1,1,1,1,2,2,2,3,3,3,3,4,4,5,6};
+	double H[PART2_COUNT] = {0.5132047, 0.3205656, -0.7782567, 0.1885447, 0.2151778, 0.7317883, 1.241044, 1.476783, 
+							-0.2818107, -1.070786, -1.263184, 0.1778064, 0.4605040, 0.2340379, -0.4924179, -0.04176610,
+							 0.1600435, -0.01578386, -0.003629481};
+	double tt = 1 / t_bar - 1;
+	double dd = d_bar - 1;
+	double part2 = 0;
+	for (int i = 0; i < PART2_COUNT; i++) {
+		part2 += H[i] * pow(tt, I[i]) * pow(dd, J[i]);
+	}
+	part2 = exp(part2*d_bar);
+	// combined parts
+	return part1*part2*vis_star;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates dynamic viscosity as a function of pressure and temperature
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] vis dynamic viscosity
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status vis_pt_value(double p, double t, Units input_units, Units output_units, double &vis)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// check for region
+	int region = 0;
+	Status status = region_pt_status(p, t, region);
+	if (status != STATUS_OK)
+		return status;
+	// calculate density
+	// call region function for v (or d)
+	double d = 0;
+	switch (region) {
+		case 1:
+			d = 1. / v_pt_1(p,t);
+			break;
+		case 2:
+			d = 1. / v_pt_2(p,t);
+			break;
+		case 3:
+			d = d_pt_3(p,t);
+			break;
+		case 5:
+			if (t > 1173.15)
+				return STATUS_VISCOSITY;
+			d = 1. / v_pt_5(p,t);
+			break;
+		default:
+			return STATUS_REGION;
+	}
+	vis = vis_dt(d, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		vis = convert_vis_si_to_english(vis);
+	else
+		vis = vis * 1E6; // convert to microPa*sec
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates dynamic viscosity as a function of pressure and temperature
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return dynamic viscosity
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 VIS_PT(double p, double t, Units input_units, Units output_units)
+{
+	return checked<double>(vis_pt_value, FUNCTION_VIS_PT, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates dynamic viscosity as a function of pressure and temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] vis dynamic viscosity, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that vis is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status VIS_PT_STATUS(double p, double t, Units input_units, Units output_units, double *vis)
+{
+	return guarded(vis_pt_value, *vis, p, t, input_units, output_units);
+}
+
+#define THCON_a_COUNT 4
+const double THCON_a[THCON_a_COUNT] = {
+	0.0102811
+	,0.0299621
+	,0.0156146
+	,-0.00422464
+};
+
+
+#define THCON_b0 -0.397070
+#define THCON_b1 0.400302
+#define THCON_b2 1.060000
+#define THCON_B1 -0.171587
+#define THCON_B2 2.392190
+
+#define THCON_d1 0.0701309
+#define THCON_d2 0.0118520
+#define THCON_d3 0.00169937
+#define THCON_d4 -1.0200
+
+#define THCON_C1 0.642857
+#define THCON_C2 -4.11717
+#define THCON_C3 -6.17937
+#define THCON_C4 0.00308976
+#define THCON_C5 0.0822994
+#define THCON_C6 10.0932
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates thermal conductivity as a function of density and temperature
+///
+/// \param[in] d density in kg/m3
+/// \param[in] t temperature in Kelvin
+///
+/// \return thermal conductivity in W/m/K
+///////////////////////////////////////////////////////////////////////////////
+static double k_dt(double d, double t)
+{
+	double t_ref = 647.26;
+	double d_ref = 317.7;
+
+	double Tbar = t/t_ref;
+	double rhobar = d/d_ref;
+
+	// calculate lambda0
+	double Tpow = sqrt(Tbar);
+	double acc = 0;
+	for(int k = 0; k < THCON_a_COUNT; ++k) {
+		acc += THCON_a[k] * Tpow;
+		Tpow *= Tbar;
+	}
+	double l0 = acc;
+
+	// calculate lambda1
+	double l1 = THCON_b0 + THCON_b1 * rhobar + THCON_b2 * exp(THCON_B1 * pow(rhobar + THCON_B2,2));
+
+	// calculate lambda2
+	double DTbar = fabs(Tbar - 1) + THCON_C4;
+
+	double Q = 2 + THCON_C5 / pow(DTbar,0.6);
+
+	double S;
+	if(Tbar > 1){
+		S = 1 / DTbar;
+	}else{
+		S = THCON_C6 / pow(DTbar,0.6);
+	}
+
+	double l2 = 
+		(THCON_d1 / pow(Tbar,10) + THCON_d2) * pow(rhobar,1.8) * 
+			exp(THCON_C1 * (1 - pow(rhobar,2.8)))
+		+ THCON_d3 * S * pow(rhobar,Q) *
+			exp((Q/(1+Q))*(1 - pow(rhobar,1+Q)))
+		+ THCON_d4 *
+			exp(THCON_C2 * pow(Tbar,1.5) + THCON_C3 / pow(rhobar,5));
+	return l0+l1+l2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates thermal conductivity as a function of pressure and temperature
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] k thermal conductivity
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status k_pt_value(double p, double t, Units input_units, Units output_units, double &k)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// check for a valid set of conditions
+	if ((t < 273.15) || (t > 1075.15))
+		return STATUS_INVALID_TEMPERATURE;
+	if ((p > 100) || (p <= 0))
+		return STATUS_INVALID_PRESSURE;
+
+	// check for region
+	int region = 0;
+	Status status = region_pt_status(p, t, region);
+	if (status != STATUS_OK)
+		return status;
+	// call region function for v (or d)
+	double d = 0;
+	switch (region) {
+		case 1:
+			d = 1. / v_pt_1(p,t);
+			break;
+		case 2:
+			d = 1. / v_pt_2(p,t);
+			break;
+		case 3:
+			d = d_pt_3(p,t);
+			break;
+		case 5:
+			d = 1. / v_pt_5(p,t);
+			break;
+		default:
+			return STATUS_REGION;
+	}
+
+	k = k_dt(d, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		k = convert_k_si_to_english(k);
+	else
+		k = k * 1E3; // convert to mW/m/K
+	// return
+	return STATUS_OK;
+
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates thermal conductivity as a function of pressure and temperature
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return thermal conductivity
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 K_PT(double p, double t, Units input_units, Units output_units)
+{
+	return checked<double>(k_pt_value, FUNCTION_K_PT, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates thermal conductivity as a function of pressure and temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] k thermal conductivity, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that k is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status K_PT_STATUS(double p, double t, Units input_units, Units output_units, double *k)
+{
+	return guarded(k_pt_value, *k, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief adds the transport properties to the thermodynamic properties of a statepoint
+///  and converts them all to the output units
+///
+/// Viscosity and conductivity are NaN where their correlations are not valid.
+///
+/// \param[in] region IAPWS region of the statepoint
+/// \param[in] t temperature in K
+/// \param[in] output_units output units of measure
+/// \param[in,out] state thermodynamic properties in SI units, which receives the
+///  transport properties
+///////////////////////////////////////////////////////////////////////////////
+void complete_state_pt(int region, double t, Units output_units, StatePT &state)
+{
+	// transport properties from the density
+	double d = 1. / state.v;
+	if ((region == 5) && (t > 1173.15))
+		state.vis = NAN;
+	else
+		state.vis = vis_dt(d, t);
+	if (t > 1075.15)
+		state.k = NAN;
+	else
+		state.k = k_dt(d, t);
+	// convert units
+	if (output_units ==  ENGLISH) {
+		state.h = convert_enthalpy_si_to_english(state.h);
+		state.s = convert_entropy_si_to_english(state.s);
+		state.v = convert_spvolume_si_to_english(state.v);
+		state.cp = convert_cp_si_to_english(state.cp);
+		state.cv = convert_cp_si_to_english(state.cv);
+		state.w = convert_w_si_to_english(state.w);
+		state.vis = convert_vis_si_to_english(state.vis);
+		state.k = convert_k_si_to_english(state.k);
+	}
+	else {
+		state.vis = state.vis * 1E6; // convert to microPa*sec
+		state.k = state.k * 1E3; // convert to mW/m/K
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all of the thermodynamic and transport properties as a function
+///  of pressure and temperature
+///
+/// The region is determined once and the derivatives of the region's free energy
+/// equation are evaluated once for all of the properties.  Viscosity and
+/// conductivity are returned as NaN where their correlations are not valid
+/// (see VIS_PT and K_PT) rather than raising an exception.
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] state thermodynamic and transport properties
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status state_pt_value(double p, double t, Units input_units, Units output_units, StatePT &state)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// check for region
+	int region = 0;
+	Status status = region_pt_status(p, t, region);
+	if (status != STATUS_OK)
+		return status;
+	// call region function for the thermodynamic properties
+	switch (region) {
+		case 1:
+			state_pt_1(p,t,state);
+			break;
+		case 2:
+			state_pt_2(p,t,state);
+			break;
+		case 3:
+			state_dt_3(d_pt_3(p,t),t,state);
+			break;
+		case 5:
+			state_pt_5(p,t,state);
+			break;
+		default:
+			return STATUS_REGION;
+	}
+	complete_state_pt(region, t, output_units, state);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all of the thermodynamic and transport properties as a function
+///  of pressure and temperature
+///
+/// The region is determined once and the derivatives of the region's free energy
+/// equation are evaluated once for all of the properties.  Viscosity and
+/// conductivity are returned as NaN where their correlations are not valid
+/// (see VIS_PT and K_PT) rather than raising an exception.
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return thermodynamic and transport properties
+///////////////////////////////////////////////////////////////////////////////
+ StatePT STATE_PT(double p, double t, Units input_units, Units output_units)
+{
+	return checked<StatePT>(state_pt_value, FUNCTION_STATE_PT, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates all of the thermodynamic and transport properties as a function
+///  of pressure and temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// The region is determined once and the derivatives of the region's free energy
+/// equation are evaluated once for all of the properties.  Viscosity and
+/// conductivity are returned as NaN where their correlations are not valid
+/// (see VIS_PT and K_PT) rather than raising an exception.
+///
+/// \param[in] p pressure
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] state thermodynamic and transport properties, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that state is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status STATE_PT_STATUS(double p, double t, Units input_units, Units output_units, StatePT *state)
+{
+	return guarded(state_pt_value, *state, p, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific entropy as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific entropy
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status sf_t_value(double t, Units input_units, Units output_units, double &s)
+{
+	if (input_units ==  ENGLISH) {
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// verify that saturation conditions can exist at this temperature
+	if ((t < 273.15) || (t > 647.096))
+		return STATUS_INVALID_TEMPERATURE;
+	// calculate the saturation pressure
+	double p = PSAT_T(t);
+	s = saturated_property(SAT_SF, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		s = convert_entropy_si_to_english(s);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific entropy as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific entropy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 SF_T(double t, Units input_units, Units output_units)
+{
+	return checked<double>(sf_t_value, FUNCTION_SF_T, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific entropy as a function of temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific entropy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that s is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status SF_T_STATUS(double t, Units input_units, Units output_units, double *s)
+{
+	return guarded(sf_t_value, *s, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific entropy as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific entropy
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status sg_t_value(double t, Units input_units, Units output_units, double &s)
+{
+	if (input_units ==  ENGLISH) {
+		t = convert_temp_english_to_kelvin(t);
+	} 
+	else {
+		t = convert_temp_centigrade_to_kelvin(t);
+	}
+	// verify that saturation conditions can exist at this temperature
+	if ((t < 273.15) || (t > 647.096))
+		return STATUS_INVALID_TEMPERATURE;
+	// calculate the saturation pressure
+	double p = PSAT_T(t);
+	s = saturated_property(SAT_SG, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		s = convert_entropy_si_to_english(s);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific entropy as a function of temperature
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific entropy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 SG_T(double t, Units input_units, Units output_units)
+{
+	return checked<double>(sg_t_value, FUNCTION_SG_T, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific entropy as a function of temperature
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] t temperature
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific entropy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that s is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status SG_T_STATUS(double t, Units input_units, Units output_units, double *s)
+{
+	return guarded(sg_t_value, *s, t, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific enthalpy as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status hf_p_value(double p, Units input_units, Units output_units, double &h)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+	} 
+	// verify that saturation conditions can exist at this pressure
+	if ((p < 6.11213E-4) || (p > 22.064))
+		return STATUS_INVALID_PRESSURE;
+	// calculate the saturation temperature
+	double t = TSAT_P(p);
+	h = saturated_property(SAT_HF, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		h = convert_enthalpy_si_to_english(h);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific enthalpy as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific enthalpy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 HF_P(double p, Units input_units, Units output_units)
+{
+	return checked<double>(hf_p_value, FUNCTION_HF_P, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific enthalpy as a function of pressure
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that h is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status HF_P_STATUS(double p, Units input_units, Units output_units, double *h)
+{
+	return guarded(hf_p_value, *h, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific enthalpy as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status hg_p_value(double p, Units input_units, Units output_units, double &h)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+	} 
+	// verify that saturation conditions can exist at this pressure
+	if ((p < 6.11213E-4) || (p > 22.064))
+		return STATUS_INVALID_PRESSURE;
+	// calculate the saturation temperature
+	double t = TSAT_P(p);
+	h = saturated_property(SAT_HG, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		h = convert_enthalpy_si_to_english(h);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific enthalpy as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific enthalpy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 HG_P(double p, Units input_units, Units output_units)
+{
+	return checked<double>(hg_p_value, FUNCTION_HG_P, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific enthalpy as a function of pressure
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that h is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status HG_P_STATUS(double p, Units input_units, Units output_units, double *h)
+{
+	return guarded(hg_p_value, *h, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific volume as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific volume
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status vf_p_value(double p, Units input_units, Units output_units, double &v)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+	} 
+	// verify that saturation conditions can exist at this pressure
+	if ((p < 6.11213E-4) || (p > 22.064))
+		return STATUS_INVALID_PRESSURE;
+	// calculate the saturation temperature
+	double t = TSAT_P(p);
+	v = saturated_property(SAT_VF, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		v = convert_spvolume_si_to_english(v);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific volume as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific volume
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 VF_P(double p, Units input_units, Units output_units)
+{
+	return checked<double>(vf_p_value, FUNCTION_VF_P, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific volume as a function of pressure
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific volume, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that v is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status VF_P_STATUS(double p, Units input_units, Units output_units, double *v)
+{
+	return guarded(vf_p_value, *v, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific volume as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific volume
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status vg_p_value(double p, Units input_units, Units output_units, double &v)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+	} 
+	// verify that saturation conditions can exist at this pressure
+	if ((p < 6.11213E-4) || (p > 22.064))
+		return STATUS_INVALID_PRESSURE;
+	// calculate the saturation temperature
+	double t = TSAT_P(p);
+	v = saturated_property(SAT_VG, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		v = convert_spvolume_si_to_english(v);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific volume as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific volume
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 VG_P(double p, Units input_units, Units output_units)
+{
+	return checked<double>(vg_p_value, FUNCTION_VG_P, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific volume as a function of pressure
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific volume, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that v is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status VG_P_STATUS(double p, Units input_units, Units output_units, double *v)
+{
+	return guarded(vg_p_value, *v, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific enthalpy as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific enthalpy
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status sf_p_value(double p, Units input_units, Units output_units, double &s)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+	} 
+	// verify that saturation conditions can exist at this pressure
+	if ((p < 6.11213E-4) || (p > 22.064))
+		return STATUS_INVALID_PRESSURE;
+	// calculate the saturation temperature
+	double t = TSAT_P(p);
+	s = saturated_property(SAT_SF, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		s = convert_entropy_si_to_english(s);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific enthalpy as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific enthalpy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 SF_P(double p, Units input_units, Units output_units)
+{
+	return checked<double>(sf_p_value, FUNCTION_SF_P, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated liquid specific enthalpy as a function of pressure
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific enthalpy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that s is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status SF_P_STATUS(double p, Units input_units, Units output_units, double *s)
+{
+	return guarded(sf_p_value, *s, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific enthalpy as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific enthalpy
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status sg_p_value(double p, Units input_units, Units output_units, double &s)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+	} 
+	// verify that saturation conditions can exist at this pressure
+	if ((p < 6.11213E-4) || (p > 22.064))
+		return STATUS_INVALID_PRESSURE;
+	// calculate the saturation temperature
+	double t = TSAT_P(p);
+	s = saturated_property(SAT_SG, p, t);
+	// convert units
+	if (output_units ==  ENGLISH)
+		s = convert_entropy_si_to_english(s);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific enthalpy as a function of pressure
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific enthalpy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 SG_P(double p, Units input_units, Units output_units)
+{
+	return checked<double>(sg_p_value, FUNCTION_SG_P, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates saturated vapor specific enthalpy as a function of pressure
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific enthalpy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that s is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status SG_P_STATUS(double p, Units input_units, Units output_units, double *s)
+{
+	return guarded(sg_p_value, *s, p, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific enthalpy
+///
+/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] t temperature
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status t_ph_value(double p, double h, Units input_units, Units output_units, double &t)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		h = convert_enthalpy_english_to_si(h);
+	} 
+	// interpolate in the (p,h) table when it is selected and covers this statepoint
+	if (!table_ph_value(PH_T, p, h, t)) {
+		int region = 0;
+		Status status = region_ph_status(p, h, region);
+		if (status != STATUS_OK)
+			return status;
+		// call the appropriate region function
+		switch (region) {
+			case 1:
+				t = t_ph_1(p,h);
 				break;
 			case 2:
-				cp = cp_pt_2(p,t);
+				t = t_ph_2(p,h);
 				break;
 			case 3:
-				d = d_pt_3(p,t);
-				cp = cp_dt_3(d,t);
+				t = t_ph_3(p,h);
+				break;
+			case 4:
+				t = TSAT_P(p);
 				break;
 			case 5:
-				cp = cp_pt_5(p,t);
+				t = t_ph_5(p,h);
 				break;
 			default:
-				throw "invalid region number in cp_pt";
+				return STATUS_REGION;
 		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			cp = convert_cp_si_to_english(cp);
-		// return
-		return cp;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
 	}
+	// convert units
+	if (output_units ==  ENGLISH)
+		t=convert_temp_kelvin_to_english(t);
+	else
+		t=convert_temp_kelvin_to_centigrade(t);
+	// return
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates dynamic viscosity as a function of pressure and temperature
+/// \brief calculates temperature as a function of pressure and specific enthalpy
 ///
 /// \param[in] p pressure
-/// \param[in] t temperature
+/// \param[in] h specific enthalpy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
 ///
-/// \return dynamic viscosity
+/// \return temperature
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 VIS_PT(double p, double t, Units input_units, Units output_units)
+ LPXLOPER12 T_PH(double p, double h, Units input_units, Units output_units)
 {
-	double t_star = 647.226;
-	double d_star = 317.763;
-	double vis_star = 55.071e-6;
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// check for region
-		int region = region_pt(p,t);
-		// calculate density
-		// call region function for v (or d)
-		double d = 0;
+	return checked<double>(t_ph_value, FUNCTION_T_PH, p, h, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific enthalpy
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] t temperature, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that t is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status T_PH_STATUS(double p, double h, Units input_units, Units output_units, double *t)
+{
+	return guarded(t_ph_value, *t, p, h, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific volume as a function of pressure and specific enthalpy
+///
+/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific entropy
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status v_ph_value(double p, double h, Units input_units, Units output_units, double &v)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		h = convert_enthalpy_english_to_si(h);
+	}
+	// interpolate in the (p,h) table when it is selected and covers this statepoint
+	if (!table_ph_value(PH_V, p, h, v)) {
+		int region = 0;
+		Status status = region_ph_status(p, h, region);
+		if (status != STATUS_OK)
+			return status;
+		// call the appropriate region function
 		switch (region) {
 			case 1:
-				d = 1. / v_pt_1(p,t);
+				v = v_ph_1(p,h);
 				break;
 			case 2:
-				d = 1. / v_pt_2(p,t);
+				v = v_ph_2(p,h);
 				break;
 			case 3:
-				d = d_pt_3(p,t);
+				v = 1. / d_ph_3(p,h);
+				break;
+			case 4:
+				v = v_ph_4(p,h);
 				break;
 			case 5:
-				if (t > 1173.15)
-					throw "shear viscosity calculation is not valid in portions of Region 5";
-				d = 1. / v_pt_5(p,t);
+				v = v_ph_5(p,h);
 				break;
 			default:
-				throw "invalid region number in vis_pt";
-		}
-		// calculate reduced properties
-		double t_bar = t/t_star;
-		double d_bar = d/d_star;
-		// calculate part 1
-		const int PART1_COUNT = 4;
-		double h[PART1_COUNT] = {1.000000,0.978197, 0.579829,-0.202354};
-		double part1 = 0;
-		for (int i=0; i<PART1_COUNT; i++) {
-			part1 += h[i]/pow(t_bar,i);
+				return STATUS_REGION;
 		}
-		part1 = pow(t_bar, 0.5)/part1;
-
-		// calculate part 2
-		const int PART2_COUNT = 19;
-		double I[PART2_COUNT] = {0,1,4,5,0,1,2,3,0,1,2,0,1,2,3,0,3,1,3};
-		double J[PART2_COUNT] = {0,0,0,0,1,1,1,1,2,2,2,3,3,3,3,4,4,5,6};
-		double H[PART2_COUNT] = {0.5132047, 0.3205656, -0.7782567, 0.1885447, 0.2151778, 0.7317883, 1.241044, 1.476783, 
-								-0.2818107, -1.070786, -1.263184, 0.1778064, 0.4605040, 0.2340379, -0.4924179, -0.04176610,
-								 0.1600435, -0.01578386, -0.003629481};
-		double tt = 1 / t_bar - 1;
-		double dd = d_bar - 1;
-		double part2 = 0;
-		for (int i = 0; i < PART2_COUNT; i++) {
-			part2 += H[i] * pow(tt, I[i]) * pow(dd, J[i]);
+	}
+	// convert units
+	if (output_units ==  ENGLISH)
+		v = convert_spvolume_si_to_english(v);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific volume as a function of pressure and specific enthalpy
+///
+/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific entropy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 V_PH(double p, double h, Units input_units, Units output_units)
+{
+	return checked<double>(v_ph_value, FUNCTION_V_PH, p, h, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific volume as a function of pressure and specific enthalpy
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] v specific entropy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that v is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status V_PH_STATUS(double p, double h, Units input_units, Units output_units, double *v)
+{
+	return guarded(v_ph_value, *v, p, h, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific entropy as a function of pressure and specific enthalpy
+///
+/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific entropy
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status s_ph_value(double p, double h, Units input_units, Units output_units, double &s)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		h = convert_enthalpy_english_to_si(h);
+	}
+	// interpolate in the (p,h) table when it is selected and covers this statepoint
+	if (!table_ph_value(PH_S, p, h, s)) {
+		int region = 0;
+		Status status = region_ph_status(p, h, region);
+		if (status != STATUS_OK)
+			return status;
+		// call the appropriate region function
+		switch (region) {
+			case 1:
+				s = s_ph_1(p,h);
+				break;
+			case 2:
+				s = s_ph_2(p,h);
+				break;
+			case 3:
+				s = s_ph_3(p,h);
+				break;
+			case 4:
+				s = s_ph_4(p,h);
+				break;
+			case 5:
+				s = s_ph_5(p,h);
+				break;
+			default:
+				return STATUS_REGION;
 		}
-		part2 = exp(part2*d_bar);
-		// combined parts
-		double vis = part1*part2*vis_star;
-		// convert units
-		if (output_units ==  ENGLISH)
-			vis = convert_vis_si_to_english(vis);
-		else
-			vis = vis * 1E6; // convert to microPa*sec
-		// return
-		return vis;
 	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
+	// convert units
+	if (output_units ==  ENGLISH)
+		s = convert_entropy_si_to_english(s);
+	// return
+	return STATUS_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific entropy as a function of pressure and specific enthalpy
+///
+/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return specific entropy
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 S_PH(double p, double h, Units input_units, Units output_units)
+{
+	return checked<double>(s_ph_value, FUNCTION_S_PH, p, h, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates specific entropy as a function of pressure and specific enthalpy
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] s specific entropy, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that s is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status S_PH_STATUS(double p, double h, Units input_units, Units output_units, double *s)
+{
+	return guarded(s_ph_value, *s, p, h, input_units, output_units);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature, specific enthalpy, and specific volume as a function
+///  of pressure and specific entropy, in SI units
+///
+/// \param[in] p pressure in MPa
+/// \param[in] s specific entropy in kJ/kg/K
+/// \param[out] t temperature in K
+/// \param[out] h specific enthalpy in kJ/kg
+/// \param[out] v specific volume in m3/kg
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status state_ps(double p, double s, double &t, double &h, double &v)
+{
+	int region = 0;
+	Status status = region_ps_status(p, s, region);
+	if (status != STATUS_OK)
+		return status;
+	// call the appropriate region function
+	StatePT state;
+	switch (region) {
+		case 1:
+			t = t_ps_1(p,s);
+			state_pt_1(p, t, state);
+			break;
+		case 2:
+			t = t_ps_2(p,s);
+			state_pt_2(p, t, state);
+			break;
+		case 3:
+			state_ps_3(p, s, t, h, v);
+			return STATUS_OK;
+		case 4:
+			state_ps_4(p, s, t, h, v);
+			return STATUS_OK;
+		case 5:
+			t = t_ps_5(p,s);
+			state_pt_5(p, t, state);
+			break;
+		default:
+			return STATUS_REGION;
 	}
+	h = state.h;
+	v = state.v;
+	return STATUS_OK;
 }
 
-#define THCON_a_COUNT 4
-const double THCON_a[THCON_a_COUNT] = {
-	0.0102811
-	,0.0299621
-	,0.0156146
-	,-0.00422464
-};
+////////////////////////////////////////////////////////
+///	\brief Maximum number of iterations of search_p_hs when the solver options set
+///  no iteration limit.
+////////////////////////////////////////////////////////
+#define P_HS_MAX_ITER 100
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief finds pressure and temperature as a function of specific enthalpy and
+///  specific entropy by iterating on state_ps, in SI units
+///
+/// Along an isentrope specific enthalpy rises with pressure, with slope v, so the
+/// pressure is found by Newton's method on state_ps, safeguarded by bisection in log(p)
+/// between the triple point pressure and 100 MPa.  Where the isentrope leaves the range
+/// of the region equations, the pressure counts as too low if the isentrope would be
+/// colder than 273.15 K, and too high otherwise.
+///
+/// \param[in] h specific enthalpy in kJ/kg
+/// \param[in] s specific entropy in kJ/kg/K
+/// \param[out] p pressure in MPa
+/// \param[out] t temperature in K
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status search_p_hs(double h, double s, double &p, double &t)
+{
+	// h(p,s) - h and dh/dp in kJ/kg/MPa, or -/+HUGE_VAL off the cold/hot end of the isentrope
+	// or NaN if the forward calculation fails
+	auto residual = [h, s](double p, double &t, double &slope) {
+		double h_ps, v;
+		try {
+			if (state_ps(p, s, t, h_ps, v) != STATUS_OK)
+				return (s < s_pt_1(p, 273.15)) ? -HUGE_VAL : HUGE_VAL;
+		}
+		catch(char const*) {
+			return std::numeric_limits<double>::quiet_NaN();
+		}
+		slope = 1000 * v;
+		return h_ps - h;
+	};
+	const Settings &settings = active_settings();
+	double tol = (settings.relative_tolerance > 1E-12) ? settings.relative_tolerance : 1E-12;
+	int max_iterations = (settings.max_iterations > 0) ? settings.max_iterations : P_HS_MAX_ITER;
+	double p_low = PT;
+	double p_high = 100;
+	double slope_low = 0, slope_high = 0, t_low = 0, t_high = 0;
+	double f_low = residual(p_low, t_low, slope_low);
+	double f_high = residual(p_high, t_high, slope_high);
+	if ((f_low == HUGE_VAL) || (f_high == -HUGE_VAL))
+		return STATUS_ENTROPY;
+	// accept an end of the range that misses h only by round-off
+	if ((f_low > 0) && (f_low/slope_low <= tol*p_low)) {
+		p = p_low;
+		t = t_low;
+		return STATUS_OK;
+	}
+	if ((f_high < 0) && (-f_high/slope_high <= tol*p_high)) {
+		p = p_high;
+		t = t_high;
+		return STATUS_OK;
+	}
+	if ((f_low > 0) || (f_high < 0))
+		return STATUS_ENTHALPY;
+	double slope = 0;
+	int evaluations = 2;
+	double p_last = p_low;  // last pressure at which the forward calculation succeeded
+	bool newton = false;    // whether p is a Newton step
+	bool failed = false;    // whether the forward calculation has failed
+	p = sqrt(p_low*p_high);
+	for (int iteration=0; ; iteration++) {
+		double f = residual(p, t, slope);
+		evaluations++;
+		if (f == 0)
+			break;
+		double next;
+		if (std::isnan(f)) {
+			// the forward calculation failed (e.g. just below the critical pressure), so
+			// the bracket is narrowed on the failing side.  h(p) is concave along an
+			// isentrope, so a Newton step never passes the root; otherwise the root is
+			// taken to lie toward the last pressure at which the calculation succeeded.
+			failed = true;
+			if (newton || (p < p_last))
+				p_low = p;
+			else
+				p_high = p;
+			next = sqrt(p_low*p_high);
+			newton = false;
+		}
+		else {
+			if (f < 0)
+				p_low = p;
+			else
+				p_high = p;
+			p_last = p;
+			// Newton step, or bisection in log(p) off the isentrope or outside the bracket
+			bool on_isentrope = (fabs(f) < HUGE_VAL);
+			next = on_isentrope ? p - f/slope : 0;
+			newton = (next > p_low) && (next < p_high);
+			if (!newton)
+				next = sqrt(p_low*p_high);
+			if (on_isentrope && (fabs(next - p) <= tol*p))
+				break;
+		}
+		if (p_high - p_low <= tol*p_high) {
+			// the bracket closed on the end of the isentrope, short of h, or on a
+			// pressure at which the forward calculation fails
+			RECORD_SOLVE(SOLVER_P_HS, iteration + 1, evaluations, 100 - PT, false);
+			return failed ? STATUS_FAILED : STATUS_ENTHALPY;
+		}
+		if (iteration + 1 >= max_iterations) {
+			RECORD_SOLVE(SOLVER_P_HS, iteration + 1, evaluations, 100 - PT, false);
+			return STATUS_FAILED;
+		}
+		p = next;
+	}
+	RECORD_SOLVE(SOLVER_P_HS, evaluations - 2, evaluations, 100 - PT, true);
+	return STATUS_OK;
+}
 
-#define THCON_b0 -0.397070
-#define THCON_b1 0.400302
-#define THCON_b2 1.060000
-#define THCON_B1 -0.171587
-#define THCON_B2 2.392190
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates pressure and temperature as a function of specific enthalpy and
+///  specific entropy, in SI units
+///
+/// The supplementary backward equations p(h,s) of Regions 1, 2, and 3, and T_sat(h,s)
+/// of Region 4, are the starting points of Newton iterations on the forward equations,
+/// each of which also decides whether the statepoint lies in its region.  Region 5,
+/// the two-phase states above 623.15 K, and statepoints where none of the iterations
+/// settles fall back to search_p_hs.
+///
+/// \param[in] h specific enthalpy in kJ/kg
+/// \param[in] s specific entropy in kJ/kg/K
+/// \param[out] p pressure in MPa
+/// \param[out] t temperature in K
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status state_hs(double h, double s, double &p, double &t)
+{
+	if (state_hs_1(h, s, p, t) || state_hs_3(h, s, p, t) || state_hs_2(h, s, p, t) || state_hs_4(h, s, p, t))
+		return STATUS_OK;
+	RECORD_BRANCH(BRANCH_POLISH_FALLBACK);
+	return search_p_hs(h, s, p, t);
+}
 
-#define THCON_d1 0.0701309
-#define THCON_d2 0.0118520
-#define THCON_d3 0.00169937
-#define THCON_d4 -1.0200
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy
+///
+/// \param[in] p pressure
+/// \param[in] s specific entropy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] t temperature
+///
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
+///////////////////////////////////////////////////////////////////////////////
+static Status t_ps_value(double p, double s, Units input_units, Units output_units, double &t)
+{
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		s = convert_entropy_english_to_si(s);
+	}
+	int region = 0;
+	Status status = region_ps_status(p, s, region);
+	if (status != STATUS_OK)
+		return status;
+	// call the appropriate region function
+	switch (region) {
+		case 1:
+			t = t_ps_1(p,s);
+			break;
+		case 2:
+			t = t_ps_2(p,s);
+			break;
+		case 3:
+			t = t_ps_3(p,s);
+			break;
+		case 4:
+			t = TSAT_P(p);
+			break;
+		case 5:
+			t = t_ps_5(p,s);
+			break;
+		default:
+			return STATUS_REGION;
+	}
+	// convert units
+	if (output_units ==  ENGLISH)
+		t=convert_temp_kelvin_to_english(t);
+	else
+		t=convert_temp_kelvin_to_centigrade(t);
+	// return
+	return STATUS_OK;
+}
 
-#define THCON_C1 0.642857
-#define THCON_C2 -4.11717
-#define THCON_C3 -6.17937
-#define THCON_C4 0.00308976
-#define THCON_C5 0.0822994
-#define THCON_C6 10.0932
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy
+///
+/// \param[in] p pressure
+/// \param[in] s specific entropy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+///
+/// \return temperature
+///////////////////////////////////////////////////////////////////////////////
+ LPXLOPER12 T_PS(double p, double s, Units input_units, Units output_units)
+{
+	return checked<double>(t_ps_value, FUNCTION_T_PS, p, s, input_units, output_units);
+}
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief calculates temperature as a function of pressure and specific entropy
+///
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] s specific entropy
+/// \param[in] input_units input units of measure
+/// \param[in] output_units output units of measure
+/// \param[out] t temperature, or NaN if it cannot be calculated
+///
+/// \return STATUS_OK, or the reason that t is NaN
+///////////////////////////////////////////////////////////////////////////////
+ Status T_PS_STATUS(double p, double s, Units input_units, Units output_units, double *t)
+{
+	return guarded(t_ps_value, *t, p, s, input_units, output_units);
+}
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates thermal conductivity as a function of pressure and temperature
+/// \brief calculates specific enthalpy as a function of pressure and specific entropy
 ///
 /// \param[in] p pressure
-/// \param[in] t temperature
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy
 ///
-/// \return thermal conductivity
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 K_PT(double p, double t, Units input_units, Units output_units)
+static Status h_ps_value(double p, double s, Units input_units, Units output_units, double &h)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// check for a valid set of conditions
-		if ((t < 273.15) || (t > 1075.15))
-			throw "invalid temperature in k_pt";
-		if ((p > 100) || (p <= 0))
-			throw "invalid pressure in k_pt";
-
-		// check for region
-		int region = region_pt(p,t);
-		// call region function for v (or d)
-		double d = 0;
-		switch (region) {
-			case 1:
-				d = 1. / v_pt_1(p,t);
-				break;
-			case 2:
-				d = 1. / v_pt_2(p,t);
-				break;
-			case 3:
-				d = d_pt_3(p,t);
-				break;
-			case 5:
-				d = 1. / v_pt_5(p,t);
-				break;
-			default:
-				throw "invalid region number in d_pt";
-		}
-
-		double t_ref = 647.26;
-		double d_ref = 317.7;
-		double k_ref = 1;
-
-		double Tbar = t/t_ref;
-		double rhobar = d/d_ref;
-
-		// calculate lambda0
-		double Tpow = sqrt(Tbar);
-		double acc = 0;
-		for(int k = 0; k < THCON_a_COUNT; ++k) {
-			acc += THCON_a[k] * Tpow;
-			Tpow *= Tbar;
-		}
-		double l0 = acc;
-
-		// calculate lambda1
-		double l1 = THCON_b0 + THCON_b1 * rhobar + THCON_b2 * exp(THCON_B1 * pow(rhobar + THCON_B2,2));
-
-		// calculate lambda2
-		double DTbar = fabs(Tbar - 1) + THCON_C4;
-
-		double Q = 2 + THCON_C5 / pow(DTbar,0.6);
-
-		double S;
-		if(Tbar > 1){
-			S = 1 / DTbar;
-		}else{
-			S = THCON_C6 / pow(DTbar,0.6);
-		}
-
-		double l2 = 
-			(THCON_d1 / pow(Tbar,10) + THCON_d2) * pow(rhobar,1.8) * 
-				exp(THCON_C1 * (1 - pow(rhobar,2.8)))
-			+ THCON_d3 * S * pow(rhobar,Q) *
-				exp((Q/(1+Q))*(1 - pow(rhobar,1+Q)))
-			+ THCON_d4 *
-				exp(THCON_C2 * pow(Tbar,1.5) + THCON_C3 / pow(rhobar,5));
-		double k = l0+l1+l2;
-		// convert units
-		if (output_units ==  ENGLISH)
-			k = convert_k_si_to_english(k);
-		else
-			k = k * 1E3; // convert to mW/m/K
-		// return
-		return k;
-
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		s = convert_entropy_english_to_si(s);
 	}
+	double t, v;
+	Status status = state_ps(p, s, t, h, v);
+	if (status != STATUS_OK)
+		return status;
+	// convert units
+	if (output_units ==  ENGLISH)
+		h = convert_enthalpy_si_to_english(h);
+	// return
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated vapor specific entropy as a function of temperature
+/// \brief calculates specific enthalpy as a function of pressure and specific entropy
 ///
-/// \param[in] t temperature
+/// \param[in] p pressure
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
 ///
-/// \return specific entropy
+/// \return specific enthalpy
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 SF_T(double t, Units input_units, Units output_units)
+ LPXLOPER12 H_PS(double p, double s, Units input_units, Units output_units)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// verify that saturation conditions can exist at this temperature
-		if ((t < 273.15) || (t > 647.096))
-			throw "invalid temperature in sf_t";
-		// calculate the saturation pressure
-		double p = PSAT_T(t);
-		double s = 0;
-		if (t<= 623.15) {
-			// get the entropy from the region 1 correlations
-			s = s_pt_1(p, t);
-		}
-		else {
-			// need to get the entropy from the region 3 correlations
-			double d = df_pt_3(p,t);
-			s = s_dt_3(d,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			s = convert_entropy_si_to_english(s);
-		// return
-		return s;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return checked<double>(h_ps_value, FUNCTION_H_PS, p, s, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated vapor specific entropy as a function of temperature
+/// \brief calculates specific enthalpy as a function of pressure and specific entropy
 ///
-/// \param[in] t temperature
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] p pressure
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] h specific enthalpy, or NaN if it cannot be calculated
 ///
-/// \return specific entropy
+/// \return STATUS_OK, or the reason that h is NaN
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 SG_T(double t, Units input_units, Units output_units)
+ Status H_PS_STATUS(double p, double s, Units input_units, Units output_units, double *h)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			t = convert_temp_english_to_kelvin(t);
-		} 
-		else {
-			t = convert_temp_centigrade_to_kelvin(t);
-		}
-		// verify that saturation conditions can exist at this temperature
-		if ((t < 273.15) || (t > 647.096))
-			throw "invalid temperature in sg_t";
-		// calculate the saturation pressure
-		double p = PSAT_T(t);
-		double s = 0;
-		if (t<= 623.15) {
-			// get the entropy from the region 2 correlations
-			s = s_pt_2(p, t);
-		}
-		else {
-			// need to get the entropy from the region 3 correlations
-			double d = dv_pt_3(p,t);
-			s = s_dt_3(d,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			s = convert_entropy_si_to_english(s);
-		// return
-		return s;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return guarded(h_ps_value, *h, p, s, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated liquid specific enthalpy as a function of pressure
+/// \brief calculates specific volume as a function of pressure and specific entropy
 ///
 /// \param[in] p pressure
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] v specific volume
 ///
-/// \return specific enthalpy
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 HF_P(double p, Units input_units, Units output_units)
+static Status v_ps_value(double p, double s, Units input_units, Units output_units, double &v)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-		} 
-		// verify that saturation conditions can exist at this pressure
-		if ((p < 6.11213E-4) || (p > 22.064))
-			throw "invalid pressure in hf_p";
-		// calculate the saturation temperature
-		double t = TSAT_P(p);
-		double h = 0;
-		if (t<= 623.15) {
-			// get the enthalpy from the region 1 correlations
-			h = h_pt_1(p, t);
-		}
-		else {
-			// need to get the enthalpy from the region 3 correlations
-			double d = df_pt_3(p,t);
-			h = h_dt_3(d,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			h = convert_enthalpy_si_to_english(h);
-		// return
-		return h;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
+	if (input_units ==  ENGLISH) {
+		p = convert_pressure_english_to_si(p);
+		s = convert_entropy_english_to_si(s);
 	}
+	double t, h;
+	Status status = state_ps(p, s, t, h, v);
+	if (status != STATUS_OK)
+		return status;
+	// convert units
+	if (output_units ==  ENGLISH)
+		v = convert_spvolume_si_to_english(v);
+	// return
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated vapor specific enthalpy as a function of pressure
+/// \brief calculates specific volume as a function of pressure and specific entropy
 ///
 /// \param[in] p pressure
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
 ///
-/// \return specific enthalpy
+/// \return specific volume
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 HG_P(double p, Units input_units, Units output_units)
+ LPXLOPER12 V_PS(double p, double s, Units input_units, Units output_units)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-		} 
-		// verify that saturation conditions can exist at this pressure
-		if ((p < 6.11213E-4) || (p > 22.064))
-			throw "invalid pressure in hg_p";
-		// calculate the saturation temperature
-		double t = TSAT_P(p);
-		double h = 0;
-		if (t<= 623.15) {
-			// get the enthalpy from the region 2 correlations
-			h = h_pt_2(p, t);
-		}
-		else {
-			// need to get the enthalpy from the region 3 correlations
-			double d = dv_pt_3(p,t);
-			h = h_dt_3(d,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			h = convert_enthalpy_si_to_english(h);
-		// return
-		return h;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return checked<double>(v_ps_value, FUNCTION_V_PS, p, s, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated liquid specific volume as a function of pressure
+/// \brief calculates specific volume as a function of pressure and specific entropy
+///
+/// Errors are reported as a status rather than an exception.
 ///
 /// \param[in] p pressure
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] v specific volume, or NaN if it cannot be calculated
 ///
-/// \return specific volume
+/// \return STATUS_OK, or the reason that v is NaN
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 VF_P(double p, Units input_units, Units output_units)
+ Status V_PS_STATUS(double p, double s, Units input_units, Units output_units, double *v)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-		} 
-		// verify that saturation conditions can exist at this pressure
-		if ((p < 6.11213E-4) || (p > 22.064))
-			throw "invalid pressure in vf_p";
-		// calculate the saturation temperature
-		double t = TSAT_P(p);
-		double v = 0;
-		if (t<= 623.15) {
-			// get the enthalpy from the region 1 correlations
-			v = v_pt_1(p, t);
-		}
-		else {
-			// need to get the enthalpy from the region 3 correlations
-			v = 1 / df_pt_3(p,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			v = convert_spvolume_si_to_english(v);
-		// return
-		return v;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return guarded(v_ps_value, *v, p, s, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated vapor specific volume as a function of pressure
+/// \brief calculates pressure as a function of specific enthalpy and specific entropy
 ///
-/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] p pressure
 ///
-/// \return specific volume
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 VG_P(double p, Units input_units, Units output_units)
+static Status p_hs_value(double h, double s, Units input_units, Units output_units, double &p)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-		} 
-		// verify that saturation conditions can exist at this pressure
-		if ((p < 6.11213E-4) || (p > 22.064))
-			throw "invalid pressure in vg_p";
-		// calculate the saturation temperature
-		double t = TSAT_P(p);
-		double v = 0;
-		if (t<= 623.15) {
-			// get the specific volume from the region 2 correlations
-			v = v_pt_2(p, t);
-		}
-		else {
-			// need to get the specific volume from the region 3 correlations
-			v = 1 / dv_pt_3(p,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			v = convert_spvolume_si_to_english(v);
-		// return
-		return v;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
+	if (input_units ==  ENGLISH) {
+		h = convert_enthalpy_english_to_si(h);
+		s = convert_entropy_english_to_si(s);
 	}
+	double t;
+	Status status = state_hs(h, s, p, t);
+	if (status != STATUS_OK)
+		return status;
+	// convert units
+	if (output_units ==  ENGLISH)
+		p = convert_pressure_si_to_english(p);
+	// return
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated liquid specific enthalpy as a function of pressure
+/// \brief calculates pressure as a function of specific enthalpy and specific entropy
 ///
-/// \param[in] p pressure
+/// \param[in] h specific enthalpy
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
 ///
-/// \return specific enthalpy
+/// \return pressure
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 SF_P(double p, Units input_units, Units output_units)
+ LPXLOPER12 P_HS(double h, double s, Units input_units, Units output_units)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-		} 
-		// verify that saturation conditions can exist at this pressure
-		if ((p < 6.11213E-4) || (p > 22.064))
-			throw "invalid pressure in sf_p";
-		// calculate the saturation temperature
-		double t = TSAT_P(p);
-		double s = 0;
-		if (t<= 623.15) {
-			// get the entropy from the region 1 correlations
-			s = s_pt_1(p, t);
-		}
-		else {
-			// need to get the entropy from the region 3 correlations
-			double d = df_pt_3(p,t);
-			s = s_dt_3(d,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			s = convert_entropy_si_to_english(s);
-		// return
-		return s;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return checked<double>(p_hs_value, FUNCTION_P_HS, h, s, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates saturated vapor specific enthalpy as a function of pressure
+/// \brief calculates pressure as a function of specific enthalpy and specific entropy
 ///
-/// \param[in] p pressure
+/// Errors are reported as a status rather than an exception.
+///
+/// \param[in] h specific enthalpy
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] p pressure, or NaN if it cannot be calculated
 ///
-/// \return specific enthalpy
+/// \return STATUS_OK, or the reason that p is NaN
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 SG_P(double p, Units input_units, Units output_units)
+ Status P_HS_STATUS(double h, double s, Units input_units, Units output_units, double *p)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-		} 
-		// verify that saturation conditions can exist at this pressure
-		if ((p < 6.11213E-4) || (p > 22.064))
-			throw "invalid pressure in sg_p";
-		// calculate the saturation temperature
-		double t = TSAT_P(p);
-		double s = 0;
-		if (t<= 623.15) {
-			// get the entropy from the region 2 correlations
-			s = s_pt_2(p, t);
-		}
-		else {
-			// need to get the entropy from the region 3 correlations
-			double d = dv_pt_3(p,t);
-			s = s_dt_3(d,t);
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			s = convert_entropy_si_to_english(s);
-		// return
-		return s;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return guarded(p_hs_value, *p, h, s, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates temperature as a function of pressure and specific enthalpy
+/// \brief calculates temperature as a function of specific enthalpy and specific entropy
 ///
-/// \param[in] p pressure
 /// \param[in] h specific enthalpy
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] t temperature
 ///
-/// \return temperature
+/// \return STATUS_OK, or the reason that the statepoint is invalid
+///
+/// \exception char const* an iterative calculation failed
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 T_PH(double p, double h, Units input_units, Units output_units)
+static Status t_hs_value(double h, double s, Units input_units, Units output_units, double &t)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			h = convert_enthalpy_english_to_si(h);
-		} 
-		int region = region_ph(p, h);
-		// call the appropriate region function
-		double t = 0;
-		switch (region) {
-			case 1:
-				t = t_ph_1(p,h);
-				break;
-			case 2:
-				t = t_ph_2(p,h);
-				break;
-			case 3:
-				t = t_ph_3(p,h);
-				break;
-			case 4:
-				t = TSAT_P(p);
-				break;
-			case 5:
-				t = t_ph_5(p,h);
-				break;
-			default:
-				throw "invalid region number in t_ph";
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			t=convert_temp_kelvin_to_english(t);
-		else
-			t=convert_temp_kelvin_to_centigrade(t);
-		// return
-		return t;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
+	if (input_units ==  ENGLISH) {
+		h = convert_enthalpy_english_to_si(h);
+		s = convert_entropy_english_to_si(s);
 	}
+	double p;
+	Status status = state_hs(h, s, p, t);
+	if (status != STATUS_OK)
+		return status;
+	// convert units
+	if (output_units ==  ENGLISH)
+		t=convert_temp_kelvin_to_english(t);
+	else
+		t=convert_temp_kelvin_to_centigrade(t);
+	// return
+	return STATUS_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates specific volume as a function of pressure and specific enthalpy
+/// \brief calculates temperature as a function of specific enthalpy and specific entropy
 ///
-/// \param[in] p pressure
 /// \param[in] h specific enthalpy
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
 ///
-/// \return specific entropy
+/// \return temperature
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 V_PH(double p, double h, Units input_units, Units output_units)
+ LPXLOPER12 T_HS(double h, double s, Units input_units, Units output_units)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			h = convert_enthalpy_english_to_si(h);
-		}
-		int region = region_ph(p, h);
-		// call the appropriate region function
-		double v = 0;
-		switch (region) {
-			case 1:
-				v = v_ph_1(p,h);
-				break;
-			case 2:
-				v = v_ph_2(p,h);
-				break;
-			case 3:
-				v = 1. / d_ph_3(p,h);
-				break;
-			case 4:
-				v = v_ph_4(p,h);
-				break;
-			case 5:
-				v = v_ph_5(p,h);
-				break;
-			default:
-				throw "invalid region number in v_ph";
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			v = convert_spvolume_si_to_english(v);
-		// return
-		return v;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return checked<double>(t_hs_value, FUNCTION_T_HS, h, s, input_units, output_units);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief calculates specific entropy as a function of pressure and specific enthalpy
+/// \brief calculates temperature as a function of specific enthalpy and specific entropy
+///
+/// Errors are reported as a status rather than an exception.
 ///
-/// \param[in] p pressure
 /// \param[in] h specific enthalpy
+/// \param[in] s specific entropy
 /// \param[in] input_units input units of measure
 /// \param[in] output_units output units of measure
+/// \param[out] t temperature, or NaN if it cannot be calculated
 ///
-/// \return specific entropy
+/// \return STATUS_OK, or the reason that t is NaN
 ///////////////////////////////////////////////////////////////////////////////
- LPXLOPER12 S_PH(double p, double h, Units input_units, Units output_units)
+ Status T_HS_STATUS(double h, double s, Units input_units, Units output_units, double *t)
 {
-	try {
-		if (input_units ==  ENGLISH) {
-			p = convert_pressure_english_to_si(p);
-			h = convert_enthalpy_english_to_si(h);
-		}
-		int region = region_ph(p, h);
-		// call the appropriate region function
-		double s = 0;
-		switch (region) {
-			case 1:
-				s = s_ph_1(p,h);
-				break;
-			case 2:
-				s = s_ph_2(p,h);
-				break;
-			case 3:
-				s = s_ph_3(p,h);
-				break;
-			case 4:
-				s = s_ph_4(p,h);
-				break;
-			case 5:
-				s = s_ph_5(p,h);
-				break;
-			default:
-				throw "invalid region number in s_ph";
-		}
-		// convert units
-		if (output_units ==  ENGLISH)
-			s = convert_entropy_si_to_english(s);
-		// return
-		return s;
-	}
-	catch(char const* chowder) {
-		// rethrow the original error message as std::invalid_argument
-		throw std::invalid_argument(chowder);
-	}
+	return guarded(t_hs_value, *t, h, s, input_units, output_units);
 }
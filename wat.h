@@ -26,6 +26,9 @@
  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#ifndef WAT_H
+#define WAT_H
+
 #define WATPROP_API	
 #define LPXLOPER12 double
 #define XLOPER12 double						
@@ -33,8 +36,314 @@
 
 enum Units {SI, ENGLISH};
 
+/////////////////////////////////////////////////////////////////////////
+/// thermodynamic and transport properties at a statepoint
+/////////////////////////////////////////////////////////////////////////
+struct StatePT {
+	double h;   ///< specific enthalpy
+	double s;   ///< specific entropy
+	double v;   ///< specific volume
+	double cp;  ///< isobaric heat capacity
+	double cv;  ///< isochoric heat capacity
+	double w;   ///< speed of sound
+	double vis; ///< dynamic viscosity
+	double k;   ///< thermal conductivity
+};
+
+/// reasons that a property cannot be calculated at a statepoint
+enum Status {
+	STATUS_OK,                   ///< the property was calculated
+	STATUS_PRESSURE,             ///< pressure out of bounds
+	STATUS_TEMPERATURE,          ///< temperature out of bounds
+	STATUS_PRESSURE_TEMPERATURE, ///< pressure/temperature combination out of bounds
+	STATUS_ENTHALPY,             ///< enthalpy out of bounds
+	STATUS_INVALID_PRESSURE,     ///< pressure outside the range of the function (e.g. above the critical point)
+	STATUS_INVALID_TEMPERATURE,  ///< temperature outside the range of the function
+	STATUS_VISCOSITY,            ///< viscosity correlation not valid in this part of Region 5
+	STATUS_REGION,               ///< no region equation applies
+	STATUS_FAILED,               ///< an iterative calculation failed
+	STATUS_INPUT_PRESSURE,       ///< pressure outside the saturation range (P_T, T_P)
+	STATUS_INPUT_TEMPERATURE,    ///< temperature outside the saturation range (P_T, T_P)
+	STATUS_ENTROPY,              ///< entropy out of bounds
+	STATUS_COUNT                 ///< number of status codes; new codes go before this one
+};
+
+/// signature shared by the status versions of the steam table functions of one property (e.g. P_T_STATUS)
+typedef Status (*StatusFunction1)(double, Units, Units, double *);
+/// signature shared by the status versions of the steam table functions of two properties (e.g. H_PT_STATUS)
+typedef Status (*StatusFunction2)(double, double, Units, Units, double *);
+
+/// method used to find density from pressure and temperature in Region 3
+enum DensitySolver {
+	DENSITY_NEWTON, ///< safeguarded Newton iteration using the analytic dp/drho
+	DENSITY_LEGACY  ///< Brent's method on pressure alone, bit-for-bit with earlier releases
+};
+
+/// use of the IAPWS-IF97 backward equations in place of iterating on the forward equations
+enum BackwardMode {
+	BACKWARD_OFF,    ///< iterate on the forward equations only
+	BACKWARD_DIRECT, ///< return the value of the backward equation
+	BACKWARD_POLISH  ///< start a Newton iteration on the forward equations from the backward equation
+};
+
+/// method used to calculate the properties of saturated water and steam
+enum SaturationMethod {
+	SATURATION_EXACT, ///< evaluate the equations of the region at the saturation pressure
+	SATURATION_TABLE  ///< interpolate in a spline table built on first use
+};
+
+/// properties of saturated water and steam
+enum SaturatedProperty {
+	SAT_HF, ///< specific enthalpy of saturated liquid
+	SAT_HG, ///< specific enthalpy of saturated vapor
+	SAT_SF, ///< specific entropy of saturated liquid
+	SAT_SG, ///< specific entropy of saturated vapor
+	SAT_VF, ///< specific volume of saturated liquid
+	SAT_VG  ///< specific volume of saturated vapor
+};
+
+/// method used to calculate temperature, specific volume, and specific entropy from
+/// pressure and specific enthalpy
+enum PHMethod {
+	PH_EXACT, ///< solve the equations of the region
+	PH_TABLE  ///< interpolate in a table built on first use
+};
+
+/// properties held in the table of pressure and specific enthalpy
+enum PHProperty {
+	PH_T, ///< temperature
+	PH_V, ///< specific volume
+	PH_S  ///< specific entropy
+};
+
+/// properties held in a property table of pressure and temperature
+enum TableProperty {
+	TABLE_H,  ///< specific enthalpy
+	TABLE_V,  ///< specific volume
+	TABLE_CP  ///< isobaric heat capacity
+};
+
+/// bicubic property table of pressure and temperature (see TABLE_PT_BUILD)
+struct TablePT;
+
+/// iterative calculations counted by the solver instrumentation (see SOLVER_STATISTICS)
+enum Solver {
+	SOLVER_T_PH_1,        ///< Brent search for T(p,h) in Region 1, scalar or lock-step
+	SOLVER_T_PH_2,        ///< Brent search for T(p,h) in Region 2, scalar or lock-step
+	SOLVER_T_PH_3,        ///< Brent search for T(p,h) in Region 3
+	SOLVER_T_PH_5,        ///< Brent search for T(p,h) in Region 5
+	SOLVER_D_PT_3_BRENT,  ///< Brent search for density in Region 3
+	SOLVER_D_PT_3_NEWTON, ///< safeguarded Newton iteration for density in Region 3
+	SOLVER_POLISH,        ///< Newton iteration started from a backward equation
+	SOLVER_T_PS_1,        ///< Brent search for T(p,s) in Region 1, when the Newton polish fails
+	SOLVER_T_PS_2,        ///< Brent search for T(p,s) in Region 2, when the Newton polish fails
+	SOLVER_T_PS_3,        ///< Brent search for T(p,s) in Region 3, when the Newton polish fails
+	SOLVER_T_PS_5,        ///< Brent search for T(p,s) in Region 5
+	SOLVER_P_HS,          ///< safeguarded Newton iteration for p(h,s) along the isentrope
+	SOLVER_COUNT
+};
+
+/// branches of the iterative calculations counted by the solver instrumentation (see BRANCH_TAKEN)
+enum Branch {
+	BRANCH_D_PT_3_SUPERCRITICAL, ///< Region 3 density above the critical temperature
+	BRANCH_D_PT_3_LIQUID,        ///< Region 3 density at or above the saturation pressure
+	BRANCH_D_PT_3_VAPOR,         ///< Region 3 density below the saturation pressure
+	BRANCH_D_PT_3_FALLBACK,      ///< the Newton density iteration gave way to Brent's method
+	BRANCH_T_PH_3_SUPERCRITICAL, ///< Region 3 T(p,h) at or above the critical pressure
+	BRANCH_T_PH_3_LIQUID,        ///< Region 3 T(p,h) below the saturated liquid enthalpy
+	BRANCH_T_PH_3_SATURATED,     ///< Region 3 T(p,h) between the saturated enthalpies
+	BRANCH_T_PH_3_VAPOR,         ///< Region 3 T(p,h) above the saturated vapor enthalpy
+	BRANCH_POLISH_FALLBACK,      ///< a backward-equation Newton iteration gave way to the bracketing solver
+	BRANCH_BATCH_FALLBACK,       ///< a lock-step T(p,h) search gave way to the scalar calculation
+	BRANCH_COUNT
+};
+
+/// number of bins in the histograms of SolverStatistics
+#define SOLVER_BINS 32
+
+/////////////////////////////////////////////////////////////////////////
+/// counts of the runs of one iterative calculation, summed over all threads
+/////////////////////////////////////////////////////////////////////////
+struct SolverStatistics {
+	unsigned long long solves;                 ///< number of runs
+	unsigned long long failures;               ///< runs that found no root or did not converge
+	unsigned long long evaluations;            ///< property function evaluations over all runs
+	unsigned long long iterations[SOLVER_BINS]; ///< runs by number of iterations; the last bin holds SOLVER_BINS-1 or more
+	unsigned long long bracket[SOLVER_BINS];   ///< runs by initial bracket width; bin i holds widths in [2^(i-16), 2^(i-15)), with the end bins open
+};
+
+/// steam table functions counted by the call metrics (see FUNCTION_METRICS)
+enum SteamFunction {
+	FUNCTION_CP_PT,
+	FUNCTION_H_PT,
+	FUNCTION_K_PT,
+	FUNCTION_S_PT,
+	FUNCTION_V_PT,
+	FUNCTION_VIS_PT,
+	FUNCTION_W_PT,
+	FUNCTION_STATE_PT,
+	FUNCTION_P_T,
+	FUNCTION_HF_T,
+	FUNCTION_HG_T,
+	FUNCTION_SF_T,
+	FUNCTION_SG_T,
+	FUNCTION_VF_T,
+	FUNCTION_VG_T,
+	FUNCTION_T_P,
+	FUNCTION_HF_P,
+	FUNCTION_HG_P,
+	FUNCTION_SF_P,
+	FUNCTION_SG_P,
+	FUNCTION_VF_P,
+	FUNCTION_VG_P,
+	FUNCTION_T_PH,
+	FUNCTION_S_PH,
+	FUNCTION_V_PH,
+	FUNCTION_T_PS,
+	FUNCTION_H_PS,
+	FUNCTION_V_PS,
+	FUNCTION_P_HS,
+	FUNCTION_T_HS,
+	FUNCTION_COUNT
+};
+
+/// number of bins in the latency histograms of FunctionMetrics
+#define METRIC_BINS 40
+
+/////////////////////////////////////////////////////////////////////////
+/// counts of the calls of one steam table function, either one statepoint
+/// at a time or over arrays (BATCH1, BATCH2, STATE_PT_BATCH), summed over
+/// all threads
+/////////////////////////////////////////////////////////////////////////
+struct FunctionMetrics {
+	unsigned long long calls;                 ///< number of calls
+	unsigned long long errors;                ///< calls that raised an exception, or statepoints of the array calls that failed
+	unsigned long long points;                ///< statepoints evaluated
+	unsigned long long total_ns;              ///< time spent in the calls, in nanoseconds
+	unsigned long long latency[METRIC_BINS];  ///< calls by duration; bin i holds durations in [2^i, 2^(i+1)) ns, with the last bin open
+};
+
+/////////////////////////////////////////////////////////////////////////
+/// solver options; each thread has its own copy, which starts out with
+/// the default values
+/////////////////////////////////////////////////////////////////////////
+struct Settings {
+	DensitySolver density_solver; ///< Region 3 density solver (default DENSITY_NEWTON)
+	BackwardMode backward_ph;     ///< backward equations for T(p,h) (default BACKWARD_OFF)
+	BackwardMode backward_pt;     ///< Region 3 backward equations for v(p,T) (default BACKWARD_OFF)
+	SaturationMethod saturation;  ///< saturated properties (default SATURATION_EXACT)
+	PHMethod ph;                  ///< T(p,h), v(p,h), and s(p,h) (default PH_EXACT)
+	double relative_tolerance;    ///< relative tolerance added to the convergence tolerance of the iterative solvers (default 0)
+	int max_iterations;           ///< iteration limit of the iterative solvers, or 0 for none (default 0)
+};
+
 WATPROP_API const char * _WatpropPyVersion(void);
 
+WATPROP_API Settings // returns the solver options of the calling thread
+GET_SETTINGS(void);
+
+WATPROP_API void // changes the solver options of the calling thread
+SET_SETTINGS(Settings settings // new solver options
+	  );
+
+WATPROP_API double // returns the largest interpolation error of a property in the saturation table
+SATURATION_TABLE_ERROR(SaturatedProperty property // saturated property
+	  );
+
+WATPROP_API double // returns the largest interpolation error of a property in the (p,h) table
+PH_TABLE_ERROR(PHProperty property // tabulated property
+	  );
+
+WATPROP_API int // returns 1 if the library was built with the solver instrumentation (WATPROP_INSTRUMENT), otherwise 0
+SOLVER_INSTRUMENTED(void);
+
+WATPROP_API SolverStatistics // returns the counts of one iterative calculation since the last reset; all zero if not instrumented
+SOLVER_STATISTICS(Solver solver // iterative calculation
+	  );
+
+WATPROP_API unsigned long long // returns the number of times a branch was taken since the last reset; zero if not instrumented
+BRANCH_TAKEN(Branch branch // branch of an iterative calculation
+	  );
+
+WATPROP_API void // clears the solver instrumentation counts of all threads
+RESET_SOLVER_STATISTICS(void);
+
+WATPROP_API int // returns 1 if the call metrics are being collected (initially, if WATPROP_METRICS is set to other than 0)
+METRICS_ENABLED(void);
+
+WATPROP_API void // starts or stops collecting the call metrics
+SET_METRICS_ENABLED(int enabled // 1 to collect, 0 to stop
+	  );
+
+WATPROP_API const char * // returns the lowercase name of a steam table function (e.g. "h_pt")
+FUNCTION_NAME(SteamFunction function // steam table function
+	  );
+
+WATPROP_API FunctionMetrics // returns the counts of the calls of a function since the last reset
+FUNCTION_METRICS(SteamFunction function, // steam table function
+	int array  // 1 for the array calls, 0 for the calls of one statepoint
+	  );
+
+WATPROP_API unsigned long long // returns the number of errors with the index-th distinct message since the last reset; 0 past the last message
+FUNCTION_ERROR(SteamFunction function, // steam table function
+	int array, // 1 for the array calls, 0 for the calls of one statepoint
+	int index, // index of the message, from 0
+	char *message, // buffer that receives the message
+	int size  // size of the buffer
+	  );
+
+WATPROP_API void // clears the call metrics of all threads
+RESET_FUNCTION_METRICS(void);
+
+/////////////////////////////////////////////////////////////////////////
+
+WATPROP_API TablePT * // builds a table of h, v, and cp over a rectangle of pressure and temperature
+TABLE_PT_BUILD(double p_min // lowest pressure
+	, double p_max // highest pressure
+	, double t_min // lowest temperature
+	, double t_max // highest temperature
+	, int p_intervals // number of cells in pressure
+	, int t_intervals // number of cells in temperature
+	, Units iunits  // units of measure for inputs
+	  );
+
+WATPROP_API TablePT * // maps a table saved by TABLE_PT_SAVE read-only; returns 0 if the file is missing or does not match
+TABLE_PT_LOAD(const char *path // name of the table file
+	, double p_min // lowest pressure
+	, double p_max // highest pressure
+	, double t_min // lowest temperature
+	, double t_max // highest temperature
+	, int p_intervals // number of cells in pressure
+	, int t_intervals // number of cells in temperature
+	, Units iunits  // units of measure for inputs
+	  );
+
+WATPROP_API void // saves a table to a file that TABLE_PT_LOAD can map
+TABLE_PT_SAVE(const TablePT *table // property table
+	, const char *path // name of the table file
+	  );
+
+WATPROP_API bool // returns true if the cells of a table are mapped from a file
+TABLE_PT_MAPPED(const TablePT *table // property table
+	  );
+
+WATPROP_API void // releases a table built by TABLE_PT_BUILD or mapped by TABLE_PT_LOAD
+TABLE_PT_FREE(TablePT *table // property table
+	  );
+
+WATPROP_API double // returns the largest relative interpolation error of a property in a table
+TABLE_PT_ERROR(const TablePT *table // property table
+	, TableProperty property // tabulated property
+	  );
+
+WATPROP_API long // returns the number of cells of a table that are calculated from the region equations
+TABLE_PT_EXACT_CELLS(const TablePT *table // property table
+	  );
+
+WATPROP_API const TablePT * // makes a table active for H_PT, V_PT, and CP_PT in the calling thread; returns the previous one
+USE_TABLE_PT(const TablePT *table // property table, or 0 for none
+	  );
+
 /////////////////////////////////////////////////////////////////////////
 
 WATPROP_API LPXLOPER12 // returns isobaric heat capacity as a function of pressure and temperature 
@@ -86,6 +395,13 @@ W_PT(double p // pressure
 	 , Units ounits // units of measure for output
 	  );
 
+WATPROP_API StatePT // returns all of the properties above as a function of pressure and temperature
+STATE_PT(double p // pressure
+	 , double t // temperature
+	, Units iunits  // units of measure for inputs
+	, Units ounits  // units of measure for output
+	  );
+
 /////////////////////////////////////////////////////////////////////////
 
 WATPROP_API LPXLOPER12 // returns saturation pressure from saturation temperature
@@ -199,3 +515,113 @@ V_PH(double p // pressure
 	, Units iunits  // units of measure for inputs
 	, Units ounits  // units of measure for output
 	  );
+
+WATPROP_API LPXLOPER12 // returns temperature as a function of pressure and specific entropy 
+T_PS(double p // pressure
+	 , double s // entropy
+	, Units iunits  // units of measure for inputs
+	, Units ounits  // units of measure for output
+	  );
+
+WATPROP_API LPXLOPER12 // returns specific enthalpy as a function of pressure and specific entropy 
+H_PS(double p // pressure
+	 , double s // entropy
+	, Units iunits  // units of measure for inputs
+	, Units ounits  // units of measure for output
+	  );
+
+WATPROP_API LPXLOPER12 // returns specific volume as a function of pressure and specific entropy 
+V_PS(double p // pressure
+	 , double s // entropy
+	, Units iunits  // units of measure for inputs
+	, Units ounits  // units of measure for output
+	  );
+
+WATPROP_API LPXLOPER12 // returns pressure as a function of specific enthalpy and specific entropy 
+P_HS(double h // enthalpy
+	 , double s // entropy
+	, Units iunits  // units of measure for inputs
+	, Units ounits  // units of measure for output
+	  );
+
+WATPROP_API LPXLOPER12 // returns temperature as a function of specific enthalpy and specific entropy 
+T_HS(double h // enthalpy
+	 , double s // entropy
+	, Units iunits  // units of measure for inputs
+	, Units ounits  // units of measure for output
+	  );
+
+/////////////////////////////////////////////////////////////////////////
+
+// Each function above has a status version (e.g. H_PT_STATUS) that takes the same arguments
+// and a pointer to the result.  Instead of raising an exception it sets the result to NaN
+// and returns the reason that the property cannot be calculated.
+
+WATPROP_API Status H_PT_STATUS(double p, double t, Units iunits, Units ounits, double *h);
+WATPROP_API Status V_PT_STATUS(double p, double t, Units iunits, Units ounits, double *v);
+WATPROP_API Status W_PT_STATUS(double p, double t, Units iunits, Units ounits, double *w);
+WATPROP_API Status HF_T_STATUS(double t, Units iunits, Units ounits, double *h);
+WATPROP_API Status HG_T_STATUS(double t, Units iunits, Units ounits, double *h);
+WATPROP_API Status VF_T_STATUS(double t, Units iunits, Units ounits, double *v);
+WATPROP_API Status VG_T_STATUS(double t, Units iunits, Units ounits, double *v);
+WATPROP_API Status P_T_STATUS(double t, Units iunits, Units ounits, double *p);
+WATPROP_API Status T_P_STATUS(double p, Units iunits, Units ounits, double *t);
+WATPROP_API Status S_PT_STATUS(double p, double t, Units iunits, Units ounits, double *s);
+WATPROP_API Status CP_PT_STATUS(double p, double t, Units iunits, Units ounits, double *cp);
+WATPROP_API Status VIS_PT_STATUS(double p, double t, Units iunits, Units ounits, double *vis);
+WATPROP_API Status K_PT_STATUS(double p, double t, Units iunits, Units ounits, double *k);
+WATPROP_API Status STATE_PT_STATUS(double p, double t, Units iunits, Units ounits, StatePT *state);
+WATPROP_API Status SF_T_STATUS(double t, Units iunits, Units ounits, double *s);
+WATPROP_API Status SG_T_STATUS(double t, Units iunits, Units ounits, double *s);
+WATPROP_API Status HF_P_STATUS(double p, Units iunits, Units ounits, double *h);
+WATPROP_API Status HG_P_STATUS(double p, Units iunits, Units ounits, double *h);
+WATPROP_API Status VF_P_STATUS(double p, Units iunits, Units ounits, double *v);
+WATPROP_API Status VG_P_STATUS(double p, Units iunits, Units ounits, double *v);
+WATPROP_API Status SF_P_STATUS(double p, Units iunits, Units ounits, double *s);
+WATPROP_API Status SG_P_STATUS(double p, Units iunits, Units ounits, double *s);
+WATPROP_API Status T_PH_STATUS(double p, double h, Units iunits, Units ounits, double *t);
+WATPROP_API Status V_PH_STATUS(double p, double h, Units iunits, Units ounits, double *v);
+WATPROP_API Status S_PH_STATUS(double p, double h, Units iunits, Units ounits, double *s);
+WATPROP_API Status T_PS_STATUS(double p, double s, Units iunits, Units ounits, double *t);
+WATPROP_API Status H_PS_STATUS(double p, double s, Units iunits, Units ounits, double *h);
+WATPROP_API Status V_PS_STATUS(double p, double s, Units iunits, Units ounits, double *v);
+WATPROP_API Status P_HS_STATUS(double h, double s, Units iunits, Units ounits, double *p);
+WATPROP_API Status T_HS_STATUS(double h, double s, Units iunits, Units ounits, double *t);
+
+/////////////////////////////////////////////////////////////////////////
+
+WATPROP_API long // evaluates a function of one property over an array of statepoints, across threads; returns the number of statepoints that failed
+BATCH1(StatusFunction1 f // status version of a steam table function (e.g. P_T_STATUS)
+	, const double x[] // input values
+	, double result[] // array to receive the function values, NaN where they cannot be calculated
+	, Status status[] // array to receive the status of each statepoint, or 0
+	, long count // number of statepoints
+	, Units iunits  // units of measure for inputs
+	, Units ounits  // units of measure for output
+	, int threads // number of threads, or 0 for one per processor
+	  );
+
+WATPROP_API long // evaluates a function of two properties over arrays of statepoints, across threads; returns the number of statepoints that failed
+BATCH2(StatusFunction2 f // status version of a steam table function (e.g. H_PT_STATUS)
+	, const double x[] // values of the first argument
+	, const double y[] // values of the second argument
+	, double result[] // array to receive the function values, NaN where they cannot be calculated
+	, Status status[] // array to receive the status of each statepoint, or 0
+	, long count // number of statepoints
+	, Units iunits  // units of measure for inputs
+	, Units ounits  // units of measure for output
+	, int threads // number of threads, or 0 for one per processor
+	  );
+
+WATPROP_API long // evaluates STATE_PT over arrays of statepoints, across threads; returns the number of statepoints that failed
+STATE_PT_BATCH(const double p[] // pressures
+	, const double t[] // temperatures
+	, StatePT result[] // array to receive the properties, NaN where they cannot be calculated
+	, Status status[] // array to receive the status of each statepoint, or 0
+	, long count // number of statepoints
+	, Units iunits  // units of measure for inputs
+	, Units ounits  // units of measure for output
+	, int threads // number of threads, or 0 for one per processor
+	  );
+
+#endif // WAT_H
@@ -26,11 +26,191 @@
 # WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 ##
 
-cdef extern from "wat.h":
+cdef extern from "wat.h" nogil:
     enum Units:
         SI = 0
         ENGLISH = 1
 
+    enum DensitySolver:
+        DENSITY_NEWTON = 0
+        DENSITY_LEGACY = 1
+
+    enum BackwardMode:
+        BACKWARD_OFF = 0
+        BACKWARD_DIRECT = 1
+        BACKWARD_POLISH = 2
+
+    enum SaturationMethod:
+        SATURATION_EXACT = 0
+        SATURATION_TABLE = 1
+
+    enum SaturatedProperty:
+        SAT_HF = 0
+        SAT_HG = 1
+        SAT_SF = 2
+        SAT_SG = 3
+        SAT_VF = 4
+        SAT_VG = 5
+
+    enum PHMethod:
+        PH_EXACT = 0
+        PH_TABLE = 1
+
+    enum PHProperty:
+        PH_T = 0
+        PH_V = 1
+        PH_S = 2
+
+    enum TableProperty:
+        TABLE_H = 0
+        TABLE_V = 1
+        TABLE_CP = 2
+
+    ctypedef struct TablePT:
+        pass
+
+    enum Solver:
+        SOLVER_T_PH_1 = 0
+        SOLVER_T_PH_2 = 1
+        SOLVER_T_PH_3 = 2
+        SOLVER_T_PH_5 = 3
+        SOLVER_D_PT_3_BRENT = 4
+        SOLVER_D_PT_3_NEWTON = 5
+        SOLVER_POLISH = 6
+        SOLVER_T_PS_1 = 7
+        SOLVER_T_PS_2 = 8
+        SOLVER_T_PS_3 = 9
+        SOLVER_T_PS_5 = 10
+        SOLVER_P_HS = 11
+
+    enum Branch:
+        BRANCH_D_PT_3_SUPERCRITICAL = 0
+        BRANCH_D_PT_3_LIQUID = 1
+        BRANCH_D_PT_3_VAPOR = 2
+        BRANCH_D_PT_3_FALLBACK = 3
+        BRANCH_T_PH_3_SUPERCRITICAL = 4
+        BRANCH_T_PH_3_LIQUID = 5
+        BRANCH_T_PH_3_SATURATED = 6
+        BRANCH_T_PH_3_VAPOR = 7
+        BRANCH_POLISH_FALLBACK = 8
+        BRANCH_BATCH_FALLBACK = 9
+
+    enum: SOLVER_BINS
+
+    ctypedef struct SolverStatistics:
+        unsigned long long solves
+        unsigned long long failures
+        unsigned long long evaluations
+        unsigned long long iterations[SOLVER_BINS]
+        unsigned long long bracket[SOLVER_BINS]
+
+    enum SteamFunction:
+        FUNCTION_CP_PT = 0
+        FUNCTION_H_PT = 1
+        FUNCTION_K_PT = 2
+        FUNCTION_S_PT = 3
+        FUNCTION_V_PT = 4
+        FUNCTION_VIS_PT = 5
+        FUNCTION_W_PT = 6
+        FUNCTION_STATE_PT = 7
+        FUNCTION_P_T = 8
+        FUNCTION_HF_T = 9
+        FUNCTION_HG_T = 10
+        FUNCTION_SF_T = 11
+        FUNCTION_SG_T = 12
+        FUNCTION_VF_T = 13
+        FUNCTION_VG_T = 14
+        FUNCTION_T_P = 15
+        FUNCTION_HF_P = 16
+        FUNCTION_HG_P = 17
+        FUNCTION_SF_P = 18
+        FUNCTION_SG_P = 19
+        FUNCTION_VF_P = 20
+        FUNCTION_VG_P = 21
+        FUNCTION_T_PH = 22
+        FUNCTION_S_PH = 23
+        FUNCTION_V_PH = 24
+        FUNCTION_T_PS = 25
+        FUNCTION_H_PS = 26
+        FUNCTION_V_PS = 27
+        FUNCTION_P_HS = 28
+        FUNCTION_T_HS = 29
+        FUNCTION_COUNT = 30
+
+    enum: METRIC_BINS
+
+    ctypedef struct FunctionMetrics:
+        unsigned long long calls
+        unsigned long long errors
+        unsigned long long points
+        unsigned long long total_ns
+        unsigned long long latency[METRIC_BINS]
+
+    ctypedef struct Settings:
+        DensitySolver density_solver
+        BackwardMode backward_ph
+        BackwardMode backward_pt
+        SaturationMethod saturation
+        PHMethod ph
+        double relative_tolerance
+        int max_iterations
+
+    ctypedef struct StatePT:
+        double h
+        double s
+        double v
+        double cp
+        double cv
+        double w
+        double vis
+        double k
+
+    enum Status:
+        STATUS_OK = 0
+        STATUS_PRESSURE = 1
+        STATUS_TEMPERATURE = 2
+        STATUS_PRESSURE_TEMPERATURE = 3
+        STATUS_ENTHALPY = 4
+        STATUS_INVALID_PRESSURE = 5
+        STATUS_INVALID_TEMPERATURE = 6
+        STATUS_VISCOSITY = 7
+        STATUS_REGION = 8
+        STATUS_FAILED = 9
+        STATUS_INPUT_PRESSURE = 10
+        STATUS_INPUT_TEMPERATURE = 11
+        STATUS_ENTROPY = 12
+
+    ctypedef Status (*StatusFunction1)(double, Units, Units, double *)
+    ctypedef Status (*StatusFunction2)(double, double, Units, Units, double *)
+
+	# solver options
+
+    Settings GET_SETTINGS()
+    void SET_SETTINGS(Settings settings)
+    double SATURATION_TABLE_ERROR(SaturatedProperty property) except +
+    double PH_TABLE_ERROR(PHProperty property) except +
+    int SOLVER_INSTRUMENTED()
+    SolverStatistics SOLVER_STATISTICS(Solver solver)
+    unsigned long long BRANCH_TAKEN(Branch branch)
+    void RESET_SOLVER_STATISTICS()
+    int METRICS_ENABLED()
+    void SET_METRICS_ENABLED(int enabled)
+    const char *FUNCTION_NAME(SteamFunction function)
+    FunctionMetrics FUNCTION_METRICS(SteamFunction function, int array)
+    unsigned long long FUNCTION_ERROR(SteamFunction function, int array, int index, char *message, int size)
+    void RESET_FUNCTION_METRICS()
+
+	# property tables
+
+    TablePT *TABLE_PT_BUILD(double p_min, double p_max, double t_min, double t_max, int p_intervals, int t_intervals, Units iunits) except +
+    TablePT *TABLE_PT_LOAD(const char *path, double p_min, double p_max, double t_min, double t_max, int p_intervals, int t_intervals, Units iunits)
+    void TABLE_PT_SAVE(const TablePT *table, const char *path) except +
+    bint TABLE_PT_MAPPED(const TablePT *table)
+    void TABLE_PT_FREE(TablePT *table)
+    double TABLE_PT_ERROR(const TablePT *table, TableProperty property)
+    long TABLE_PT_EXACT_CELLS(const TablePT *table)
+    const TablePT *USE_TABLE_PT(const TablePT *table)
+
 	# functions of (p,t)
 
     double CP_PT(double p, double t, Units iunits, Units ounits) except +
@@ -40,6 +220,7 @@ cdef extern from "wat.h":
     double V_PT(double p, double t, Units iunits, Units ounits) except +
     double VIS_PT(double p, double t, Units iunits, Units ounits) except +
     double W_PT(double p, double t, Units iunits, Units ounits) except +
+    StatePT STATE_PT(double p, double t, Units iunits, Units ounits) except +
 
 	# functions of (t)
 
@@ -67,5 +248,49 @@ cdef extern from "wat.h":
     double S_PH(double p, double h, Units iunits, Units ounits) except +
     double V_PH(double p, double h, Units iunits, Units ounits) except +
 
+	# functions of (p,s) and (h,s)
+
+    double T_PS(double p, double s, Units iunits, Units ounits) except +
+    double H_PS(double p, double s, Units iunits, Units ounits) except +
+    double V_PS(double p, double s, Units iunits, Units ounits) except +
+    double P_HS(double h, double s, Units iunits, Units ounits) except +
+    double T_HS(double h, double s, Units iunits, Units ounits) except +
+
+	# status versions, returning NaN and the reason instead of raising an exception
+
+    Status H_PT_STATUS(double p, double t, Units iunits, Units ounits, double *h)
+    Status V_PT_STATUS(double p, double t, Units iunits, Units ounits, double *v)
+    Status W_PT_STATUS(double p, double t, Units iunits, Units ounits, double *w)
+    Status HF_T_STATUS(double t, Units iunits, Units ounits, double *h)
+    Status HG_T_STATUS(double t, Units iunits, Units ounits, double *h)
+    Status VF_T_STATUS(double t, Units iunits, Units ounits, double *v)
+    Status VG_T_STATUS(double t, Units iunits, Units ounits, double *v)
+    Status P_T_STATUS(double t, Units iunits, Units ounits, double *p)
+    Status T_P_STATUS(double p, Units iunits, Units ounits, double *t)
+    Status S_PT_STATUS(double p, double t, Units iunits, Units ounits, double *s)
+    Status CP_PT_STATUS(double p, double t, Units iunits, Units ounits, double *cp)
+    Status VIS_PT_STATUS(double p, double t, Units iunits, Units ounits, double *vis)
+    Status K_PT_STATUS(double p, double t, Units iunits, Units ounits, double *k)
+    Status STATE_PT_STATUS(double p, double t, Units iunits, Units ounits, StatePT *state)
+    Status SF_T_STATUS(double t, Units iunits, Units ounits, double *s)
+    Status SG_T_STATUS(double t, Units iunits, Units ounits, double *s)
+    Status HF_P_STATUS(double p, Units iunits, Units ounits, double *h)
+    Status HG_P_STATUS(double p, Units iunits, Units ounits, double *h)
+    Status VF_P_STATUS(double p, Units iunits, Units ounits, double *v)
+    Status VG_P_STATUS(double p, Units iunits, Units ounits, double *v)
+    Status SF_P_STATUS(double p, Units iunits, Units ounits, double *s)
+    Status SG_P_STATUS(double p, Units iunits, Units ounits, double *s)
+    Status T_PH_STATUS(double p, double h, Units iunits, Units ounits, double *t)
+    Status V_PH_STATUS(double p, double h, Units iunits, Units ounits, double *v)
+    Status S_PH_STATUS(double p, double h, Units iunits, Units ounits, double *s)
+    Status T_PS_STATUS(double p, double s, Units iunits, Units ounits, double *t)
+    Status H_PS_STATUS(double p, double s, Units iunits, Units ounits, double *h)
+    Status V_PS_STATUS(double p, double s, Units iunits, Units ounits, double *v)
+    Status P_HS_STATUS(double h, double s, Units iunits, Units ounits, double *p)
+    Status T_HS_STATUS(double h, double s, Units iunits, Units ounits, double *t)
 
+	# functions over arrays of statepoints
 
+    long BATCH1(StatusFunction1 f, const double x[], double result[], Status status[], long count, Units iunits, Units ounits, int threads)
+    long BATCH2(StatusFunction2 f, const double x[], const double y[], double result[], Status status[], long count, Units iunits, Units ounits, int threads)
+    long STATE_PT_BATCH(const double p[], const double t[], StatePT result[], Status status[], long count, Units iunits, Units ounits, int threads)
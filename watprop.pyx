@@ -27,11 +27,239 @@
 ##
 
 cimport wat
+import contextlib
+import numpy
+import os
 
 cpdef enum units:
 	si = wat.Units.SI
 	english = wat.Units.ENGLISH
 
+cpdef enum density_solver:
+	newton = wat.DensitySolver.DENSITY_NEWTON
+	legacy = wat.DensitySolver.DENSITY_LEGACY
+
+cpdef enum backward_mode:
+	off = wat.BackwardMode.BACKWARD_OFF
+	direct = wat.BackwardMode.BACKWARD_DIRECT
+	polish = wat.BackwardMode.BACKWARD_POLISH
+
+cpdef enum saturation_method:
+	exact = wat.SaturationMethod.SATURATION_EXACT
+	table = wat.SaturationMethod.SATURATION_TABLE
+
+# the member names are module-level in Cython, so they must differ from saturation_method's
+cpdef enum ph_method:
+	iterate = wat.PHMethod.PH_EXACT
+	interpolate = wat.PHMethod.PH_TABLE
+
+
+def get_settings():
+	'''Returns a dict of the solver options in effect for the calling thread'''
+	return wat.GET_SETTINGS()
+
+def set_settings(**options):
+	'''Changes solver options for the calling thread and returns a dict of the previous options.
+	Valid options are the keys of the dict returned by get_settings()'''
+	previous = wat.GET_SETTINGS()
+	unknown = set(options) - set(previous)
+	if unknown:
+		raise TypeError('unknown solver option(s): ' + ', '.join(sorted(unknown)))
+	if options.get('relative_tolerance', 0) < 0:
+		raise ValueError('relative_tolerance must not be negative')
+	if options.get('max_iterations', 0) < 0:
+		raise ValueError('max_iterations must not be negative')
+	updated = dict(previous)
+	updated.update(options)
+	wat.SET_SETTINGS(updated)
+	return previous
+
+@contextlib.contextmanager
+def settings(**options):
+	'''Context manager that applies solver options for the calling thread and restores
+	the previous options on exit, e.g. ``with settings(density_solver=legacy): ...``'''
+	previous = set_settings(**options)
+	try:
+		yield
+	finally:
+		wat.SET_SETTINGS(previous)
+
+def saturation_table_error():
+	'''Returns a dict of the largest interpolation errors in the saturation table (used when
+	saturation=saturation_method.table), building the table if necessary: in kJ/kg for hf and hg,
+	kJ/kg/K for sf and sg, and relative for vf and vg'''
+	return {'hf': wat.SATURATION_TABLE_ERROR(wat.SaturatedProperty.SAT_HF),
+		'hg': wat.SATURATION_TABLE_ERROR(wat.SaturatedProperty.SAT_HG),
+		'sf': wat.SATURATION_TABLE_ERROR(wat.SaturatedProperty.SAT_SF),
+		'sg': wat.SATURATION_TABLE_ERROR(wat.SaturatedProperty.SAT_SG),
+		'vf': wat.SATURATION_TABLE_ERROR(wat.SaturatedProperty.SAT_VF),
+		'vg': wat.SATURATION_TABLE_ERROR(wat.SaturatedProperty.SAT_VG)}
+
+def ph_table_error():
+	'''Returns a dict of the largest interpolation errors in the (p,h) table (used by t_ph, v_ph,
+	and s_ph when ph=ph_method.interpolate), building the table if necessary: in K for t, kJ/kg/K for s,
+	and relative for v'''
+	return {'t': wat.PH_TABLE_ERROR(wat.PHProperty.PH_T),
+		'v': wat.PH_TABLE_ERROR(wat.PHProperty.PH_V),
+		's': wat.PH_TABLE_ERROR(wat.PHProperty.PH_S)}
+
+_solvers = {
+	't_ph_1': wat.Solver.SOLVER_T_PH_1,
+	't_ph_2': wat.Solver.SOLVER_T_PH_2,
+	't_ph_3': wat.Solver.SOLVER_T_PH_3,
+	't_ph_5': wat.Solver.SOLVER_T_PH_5,
+	'd_pt_3_brent': wat.Solver.SOLVER_D_PT_3_BRENT,
+	'd_pt_3_newton': wat.Solver.SOLVER_D_PT_3_NEWTON,
+	'polish': wat.Solver.SOLVER_POLISH,
+	't_ps_1': wat.Solver.SOLVER_T_PS_1,
+	't_ps_2': wat.Solver.SOLVER_T_PS_2,
+	't_ps_3': wat.Solver.SOLVER_T_PS_3,
+	't_ps_5': wat.Solver.SOLVER_T_PS_5,
+	'p_hs': wat.Solver.SOLVER_P_HS}
+
+_branches = {
+	'd_pt_3_supercritical': wat.Branch.BRANCH_D_PT_3_SUPERCRITICAL,
+	'd_pt_3_liquid': wat.Branch.BRANCH_D_PT_3_LIQUID,
+	'd_pt_3_vapor': wat.Branch.BRANCH_D_PT_3_VAPOR,
+	'd_pt_3_fallback': wat.Branch.BRANCH_D_PT_3_FALLBACK,
+	't_ph_3_supercritical': wat.Branch.BRANCH_T_PH_3_SUPERCRITICAL,
+	't_ph_3_liquid': wat.Branch.BRANCH_T_PH_3_LIQUID,
+	't_ph_3_saturated': wat.Branch.BRANCH_T_PH_3_SATURATED,
+	't_ph_3_vapor': wat.Branch.BRANCH_T_PH_3_VAPOR,
+	'polish_fallback': wat.Branch.BRANCH_POLISH_FALLBACK,
+	'batch_fallback': wat.Branch.BRANCH_BATCH_FALLBACK}
+
+def solver_instrumented():
+	'''Returns True if the library was built with the solver instrumentation
+	(WATPROP_INSTRUMENT=1 in the environment of setup.py)'''
+	return wat.SOLVER_INSTRUMENTED() != 0
+
+def solver_statistics():
+	'''Returns the counts of the iterative calculations of all threads since the last reset:
+	a dict with 'solvers', mapping each solver to a dict of its number of runs ('solves'), failed
+	runs ('failures'), property function evaluations ('evaluations'), and histograms of the runs
+	by number of iterations ('iterations', the last bin holding all longer runs) and by initial
+	bracket width ('bracket', bin i holding widths from 2**(i-16) to 2**(i-15)); and 'branches',
+	mapping each branch to the number of times it was taken.  All counts are zero unless
+	solver_instrumented() is True.'''
+	cdef wat.SolverStatistics statistics
+	solvers = {}
+	for name, solver in _solvers.items():
+		statistics = wat.SOLVER_STATISTICS(solver)
+		solvers[name] = {'solves': statistics.solves,
+			'failures': statistics.failures,
+			'evaluations': statistics.evaluations,
+			'iterations': [statistics.iterations[i] for i in range(wat.SOLVER_BINS)],
+			'bracket': [statistics.bracket[i] for i in range(wat.SOLVER_BINS)]}
+	branches = {name: wat.BRANCH_TAKEN(branch) for name, branch in _branches.items()}
+	return {'solvers': solvers, 'branches': branches}
+
+def reset_solver_statistics():
+	'''Clears the counts returned by solver_statistics()'''
+	wat.RESET_SOLVER_STATISTICS()
+
+def metrics_enabled():
+	'''Returns True if the call metrics returned by function_metrics() are being collected, initially
+	if WATPROP_METRICS is set to other than 0 in the environment'''
+	return wat.METRICS_ENABLED() != 0
+
+def set_metrics_enabled(enabled):
+	'''Starts or stops collecting the call metrics in all threads, keeping the counts so far'''
+	wat.SET_METRICS_ENABLED(1 if enabled else 0)
+
+cdef dict _function_metrics(wat.SteamFunction function, int array):
+	cdef wat.FunctionMetrics metrics = wat.FUNCTION_METRICS(function, array)
+	cdef char message[256]
+	cdef unsigned long long count
+	cdef int index = 0
+	messages = {}
+	while True:
+		count = wat.FUNCTION_ERROR(function, array, index, message, sizeof(message))
+		if count == 0:
+			break
+		messages[message.decode()] = count
+		index += 1
+	return {'calls': metrics.calls,
+		'errors': metrics.errors,
+		'messages': messages,
+		'points': metrics.points,
+		'total_ns': metrics.total_ns,
+		'latency': [metrics.latency[i] for i in range(wat.METRIC_BINS)]}
+
+def function_metrics():
+	'''Returns the call metrics of all threads since the last reset: a dict mapping the name of each
+	steam table function to a dict with 'scalar', for the calls of one statepoint, and 'array', for the
+	*_array calls.  Each holds the number of calls ('calls'), of errors ('errors': calls that raised,
+	or statepoints of an array call that failed), the errors by message ('messages'), the number of
+	statepoints ('points'), the time spent in the calls in nanoseconds ('total_ns'), and a histogram of
+	the calls by duration ('latency', bin i holding durations from 2**i to 2**(i+1) ns).  All counts
+	are zero unless metrics_enabled() is True.'''
+	result = {}
+	for function in range(wat.SteamFunction.FUNCTION_COUNT):
+		name = wat.FUNCTION_NAME(<wat.SteamFunction> function).decode()
+		result[name] = {'scalar': _function_metrics(<wat.SteamFunction> function, 0),
+			'array': _function_metrics(<wat.SteamFunction> function, 1)}
+	return result
+
+def reset_function_metrics():
+	'''Clears the counts returned by function_metrics()'''
+	wat.RESET_FUNCTION_METRICS()
+
+cdef class TablePT:
+	'''Bicubic table of specific enthalpy, specific volume, and heat capacity over a rectangle of
+	pressure and temperature, used by h_pt, v_pt, and cp_pt within a use_table block'''
+	cdef wat.TablePT *table
+
+	def __cinit__(self, double p_min, double p_max, double t_min, double t_max, int p_intervals=100, int t_intervals=100, wat.Units iunits=wat.Units.ENGLISH, path=None):
+		# with a path, map the table saved there if it matches, otherwise build it and save it
+		cdef bytes name
+		if path is not None:
+			name = os.fsencode(path)
+			self.table = wat.TABLE_PT_LOAD(name, p_min, p_max, t_min, t_max, p_intervals, t_intervals, iunits)
+			if self.table != NULL:
+				return
+		self.table = wat.TABLE_PT_BUILD(p_min, p_max, t_min, t_max, p_intervals, t_intervals, iunits)
+		if path is not None:
+			# the file only spares later processes the build, so keep the table if it cannot be saved
+			try:
+				self.save(path)
+			except OSError:
+				pass
+
+	def __dealloc__(self):
+		wat.TABLE_PT_FREE(self.table)
+
+	def error(self):
+		'''Returns a dict of the largest relative interpolation errors found at the cell centres'''
+		return {'h': wat.TABLE_PT_ERROR(self.table, wat.TableProperty.TABLE_H),
+			'v': wat.TABLE_PT_ERROR(self.table, wat.TableProperty.TABLE_V),
+			'cp': wat.TABLE_PT_ERROR(self.table, wat.TableProperty.TABLE_CP)}
+
+	def exact_cells(self):
+		'''Returns the number of cells that straddle a region boundary or the saturation line,
+		which are calculated from the region equations instead'''
+		return wat.TABLE_PT_EXACT_CELLS(self.table)
+
+	def save(self, path):
+		'''Saves the table to a file that later processes map read-only by passing the same
+		arguments and path to TablePT'''
+		wat.TABLE_PT_SAVE(self.table, os.fsencode(path))
+
+	@property
+	def mapped(self):
+		'''True if the table was mapped from a file rather than built'''
+		return wat.TABLE_PT_MAPPED(self.table)
+
+@contextlib.contextmanager
+def use_table(TablePT table):
+	'''Context manager that makes h_pt, v_pt, and cp_pt interpolate in a TablePT for the calling
+	thread, wherever the table covers the statepoint'''
+	cdef const wat.TablePT *previous = wat.USE_TABLE_PT(table.table)
+	try:
+		yield table
+	finally:
+		wat.USE_TABLE_PT(previous)
+
 # functions of (p,t)
 
 def cp_pt(double p, double t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH):
@@ -62,6 +290,12 @@ def w_pt(double p, double t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounit
 	'''Returns the speed of sound in water/steam as a function of pressure and temperature'''
 	return wat.W_PT(p, t, iunits, ounits)
 
+def state_pt(double p, double t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH):
+	'''Returns a dict of the specific enthalpy (h), specific entropy (s), specific volume (v),
+	heat capacities (cp, cv), speed of sound (w), dynamic viscosity (vis), and thermal
+	conductivity (k) of water/steam as a function of pressure and temperature'''
+	return wat.STATE_PT(p, t, iunits, ounits)
+
 # functions of (t)
 
 def p_t(double t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH):
@@ -136,3 +370,217 @@ def v_ph(double p, double h, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounit
 	'''Returns the specific volume of water/steam as a function of pressure and specific enthalpy'''
 	return wat.V_PH(p, h, iunits, ounits)
 
+# functions of (p,s) and (h,s)
+
+def t_ps(double p, double s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH):
+	'''Returns the temperature of water/steam as a function of pressure and specific entropy'''
+	return wat.T_PS(p, s, iunits, ounits)
+
+def h_ps(double p, double s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH):
+	'''Returns the specific enthalpy of water/steam as a function of pressure and specific entropy'''
+	return wat.H_PS(p, s, iunits, ounits)
+
+def v_ps(double p, double s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH):
+	'''Returns the specific volume of water/steam as a function of pressure and specific entropy'''
+	return wat.V_PS(p, s, iunits, ounits)
+
+def p_hs(double h, double s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH):
+	'''Returns the pressure of water/steam as a function of specific enthalpy and specific entropy'''
+	return wat.P_HS(h, s, iunits, ounits)
+
+def t_hs(double h, double s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH):
+	'''Returns the temperature of water/steam as a function of specific enthalpy and specific entropy'''
+	return wat.T_HS(h, s, iunits, ounits)
+
+# functions over arrays of statepoints
+
+state_dtype = numpy.dtype([(name, numpy.float64) for name in ('h', 's', 'v', 'cp', 'cv', 'w', 'vis', 'k')])
+
+cdef object _batch_errors(object errors, long failures, object status, object scalar, tuple arguments, wat.Units iunits, wat.Units ounits):
+	'''Unless errors is 'nan', raises the exception of the first statepoint that failed by
+	calling the scalar function there'''
+	if errors == 'nan' or failures == 0:
+		return
+	i = numpy.flatnonzero(status)[0]
+	scalar(*[x[i] for x in arguments], iunits, ounits)
+	raise ValueError('calculation failed')
+
+cdef object _batch1(wat.StatusFunction1 f, object scalar, object x, wat.Units iunits, wat.Units ounits, int threads, object errors):
+	'''Evaluates f at every element of x, returning an array shaped like x, using the given
+	number of threads (0 for one per processor).  Statepoints that fail are NaN if errors is
+	'nan', and otherwise raise the exception of the scalar function'''
+	if errors not in ('raise', 'nan'):
+		raise ValueError("errors must be 'raise' or 'nan'")
+	x = numpy.asarray(x, dtype=numpy.float64)
+	result = numpy.empty(x.shape)
+	status = numpy.empty(x.size, dtype=numpy.intc)
+	cdef double[::1] xv = numpy.ascontiguousarray(x).reshape(-1)
+	cdef double[::1] rv = result.reshape(-1)
+	cdef int[::1] sv = status
+	cdef long count = xv.shape[0]
+	cdef long failures = 0
+	if count > 0:
+		with nogil:
+			failures = wat.BATCH1(f, &xv[0], &rv[0], <wat.Status *> &sv[0], count, iunits, ounits, threads)
+	_batch_errors(errors, failures, status, scalar, (xv,), iunits, ounits)
+	return result
+
+cdef object _batch2(wat.StatusFunction2 f, object scalar, object x, object y, wat.Units iunits, wat.Units ounits, int threads, object errors):
+	'''Evaluates f at every pair of elements of x and y (broadcast together), returning an array
+	with the broadcast shape (see _batch1)'''
+	if errors not in ('raise', 'nan'):
+		raise ValueError("errors must be 'raise' or 'nan'")
+	x, y = numpy.broadcast_arrays(numpy.asarray(x, dtype=numpy.float64), numpy.asarray(y, dtype=numpy.float64))
+	result = numpy.empty(x.shape)
+	status = numpy.empty(x.size, dtype=numpy.intc)
+	cdef double[::1] xv = numpy.ascontiguousarray(x).reshape(-1)
+	cdef double[::1] yv = numpy.ascontiguousarray(y).reshape(-1)
+	cdef double[::1] rv = result.reshape(-1)
+	cdef int[::1] sv = status
+	cdef long count = xv.shape[0]
+	cdef long failures = 0
+	if count > 0:
+		with nogil:
+			failures = wat.BATCH2(f, &xv[0], &yv[0], &rv[0], <wat.Status *> &sv[0], count, iunits, ounits, threads)
+	_batch_errors(errors, failures, status, scalar, (xv, yv), iunits, ounits)
+	return result
+
+def cp_pt_array(p, t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the heat capacity of water/steam as a function of arrays of pressure and temperature'''
+	return _batch2(wat.CP_PT_STATUS, cp_pt, p, t, iunits, ounits, threads, errors)
+
+def h_pt_array(p, t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific enthalpy of water/steam as a function of arrays of pressure and temperature'''
+	return _batch2(wat.H_PT_STATUS, h_pt, p, t, iunits, ounits, threads, errors)
+
+def k_pt_array(p, t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the thermal conductivity of water/steam as a function of arrays of pressure and temperature'''
+	return _batch2(wat.K_PT_STATUS, k_pt, p, t, iunits, ounits, threads, errors)
+
+def s_pt_array(p, t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific entropy of water/steam as a function of arrays of pressure and temperature'''
+	return _batch2(wat.S_PT_STATUS, s_pt, p, t, iunits, ounits, threads, errors)
+
+def v_pt_array(p, t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific volume of water/steam as a function of arrays of pressure and temperature'''
+	return _batch2(wat.V_PT_STATUS, v_pt, p, t, iunits, ounits, threads, errors)
+
+def vis_pt_array(p, t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the dynamic viscosity of water/steam as a function of arrays of pressure and temperature'''
+	return _batch2(wat.VIS_PT_STATUS, vis_pt, p, t, iunits, ounits, threads, errors)
+
+def w_pt_array(p, t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the speed of sound in water/steam as a function of arrays of pressure and temperature'''
+	return _batch2(wat.W_PT_STATUS, w_pt, p, t, iunits, ounits, threads, errors)
+
+
+def p_t_array(t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the saturation pressure of water/steam as a function of an array of temperatures'''
+	return _batch1(wat.P_T_STATUS, p_t, t, iunits, ounits, threads, errors)
+
+def hf_t_array(t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific enthalpy of water at saturation conditions as a function of an array of temperatures'''
+	return _batch1(wat.HF_T_STATUS, hf_t, t, iunits, ounits, threads, errors)
+
+def hg_t_array(t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific enthalpy of steam at saturation conditions as a function of an array of temperatures'''
+	return _batch1(wat.HG_T_STATUS, hg_t, t, iunits, ounits, threads, errors)
+
+def sf_t_array(t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific entropy of water at saturation conditions as a function of an array of temperatures'''
+	return _batch1(wat.SF_T_STATUS, sf_t, t, iunits, ounits, threads, errors)
+
+def sg_t_array(t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific entropy of steam at saturation conditions as a function of an array of temperatures'''
+	return _batch1(wat.SG_T_STATUS, sg_t, t, iunits, ounits, threads, errors)
+
+def vf_t_array(t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific volume of water at saturation conditions as a function of an array of temperatures'''
+	return _batch1(wat.VF_T_STATUS, vf_t, t, iunits, ounits, threads, errors)
+
+def vg_t_array(t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific volume of steam at saturation conditions as a function of an array of temperatures'''
+	return _batch1(wat.VG_T_STATUS, vg_t, t, iunits, ounits, threads, errors)
+
+
+def state_pt_array(p, t, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns a structured array with fields h, s, v, cp, cv, w, vis, and k (see state_pt)
+	as a function of arrays of pressure and temperature'''
+	if errors not in ('raise', 'nan'):
+		raise ValueError("errors must be 'raise' or 'nan'")
+	p, t = numpy.broadcast_arrays(numpy.asarray(p, dtype=numpy.float64), numpy.asarray(t, dtype=numpy.float64))
+	result = numpy.empty(p.shape, dtype=state_dtype)
+	status = numpy.empty(p.size, dtype=numpy.intc)
+	cdef double[::1] pv = numpy.ascontiguousarray(p).reshape(-1)
+	cdef double[::1] tv = numpy.ascontiguousarray(t).reshape(-1)
+	cdef wat.StatePT[::1] rv = result.reshape(-1)
+	cdef int[::1] sv = status
+	cdef long count = pv.shape[0]
+	cdef long failures = 0
+	if count > 0:
+		with nogil:
+			failures = wat.STATE_PT_BATCH(&pv[0], &tv[0], &rv[0], <wat.Status *> &sv[0], count, iunits, ounits, threads)
+	_batch_errors(errors, failures, status, state_pt, (pv, tv), iunits, ounits)
+	return result
+
+def t_p_array(p, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the saturation temperature of water/steam as a function of an array of pressures'''
+	return _batch1(wat.T_P_STATUS, t_p, p, iunits, ounits, threads, errors)
+
+def hf_p_array(p, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific enthalpy of water at saturation conditions as a function of an array of pressures'''
+	return _batch1(wat.HF_P_STATUS, hf_p, p, iunits, ounits, threads, errors)
+
+def hg_p_array(p, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific enthalpy of steam at saturation conditions as a function of an array of pressures'''
+	return _batch1(wat.HG_P_STATUS, hg_p, p, iunits, ounits, threads, errors)
+
+def sf_p_array(p, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific entropy of water at saturation conditions as a function of an array of pressures'''
+	return _batch1(wat.SF_P_STATUS, sf_p, p, iunits, ounits, threads, errors)
+
+def sg_p_array(p, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific entropy of steam at saturation conditions as a function of an array of pressures'''
+	return _batch1(wat.SG_P_STATUS, sg_p, p, iunits, ounits, threads, errors)
+
+def vf_p_array(p, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific volume of water at saturation conditions as a function of an array of pressures'''
+	return _batch1(wat.VF_P_STATUS, vf_p, p, iunits, ounits, threads, errors)
+
+def vg_p_array(p, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific volume of steam at saturation conditions as a function of an array of pressures'''
+	return _batch1(wat.VG_P_STATUS, vg_p, p, iunits, ounits, threads, errors)
+
+
+def t_ph_array(p, h, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the temperature of water/steam as a function of arrays of pressure and specific enthalpy'''
+	return _batch2(wat.T_PH_STATUS, t_ph, p, h, iunits, ounits, threads, errors)
+
+def s_ph_array(p, h, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific entropy of water/steam as a function of arrays of pressure and specific enthalpy'''
+	return _batch2(wat.S_PH_STATUS, s_ph, p, h, iunits, ounits, threads, errors)
+
+def v_ph_array(p, h, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific volume of water/steam as a function of arrays of pressure and specific enthalpy'''
+	return _batch2(wat.V_PH_STATUS, v_ph, p, h, iunits, ounits, threads, errors)
+
+
+def t_ps_array(p, s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the temperature of water/steam as a function of arrays of pressure and specific entropy'''
+	return _batch2(wat.T_PS_STATUS, t_ps, p, s, iunits, ounits, threads, errors)
+
+def h_ps_array(p, s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific enthalpy of water/steam as a function of arrays of pressure and specific entropy'''
+	return _batch2(wat.H_PS_STATUS, h_ps, p, s, iunits, ounits, threads, errors)
+
+def v_ps_array(p, s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the specific volume of water/steam as a function of arrays of pressure and specific entropy'''
+	return _batch2(wat.V_PS_STATUS, v_ps, p, s, iunits, ounits, threads, errors)
+
+def p_hs_array(h, s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the pressure of water/steam as a function of arrays of specific enthalpy and specific entropy'''
+	return _batch2(wat.P_HS_STATUS, p_hs, h, s, iunits, ounits, threads, errors)
+
+def t_hs_array(h, s, wat.Units iunits=wat.Units.ENGLISH, wat.Units ounits=wat.Units.ENGLISH, int threads=1, errors='raise'):
+	'''Returns the temperature of water/steam as a function of arrays of specific enthalpy and specific entropy'''
+	return _batch2(wat.T_HS_STATUS, t_hs, h, s, iunits, ounits, threads, errors)